@@ -0,0 +1,580 @@
+/**
+ * @file bench.c
+ * @project Certifiable-Quant
+ * @brief Microbenchmarks for the public primitives and modules
+ *
+ * Every case runs over a sweep of sizes. For each size the iteration
+ * count is grown until one sample lasts at least --min-ms, then --reps
+ * samples are taken. Results are written as JSON: ns/element (median,
+ * MAD, mean, variance, min) and GB/s at the median.
+ *
+ * The header records a machine fingerprint: the first 16 hex digits of
+ * SHA-256 over the CPU model, online CPU count, compiler version and
+ * pointer width. certifiable_quant_bench_compare keys baselines by it.
+ *
+ * Usage: certifiable_quant_bench [--reps N] [--min-ms M] [--max-n N]
+ *                                [--filter SUBSTR[,SUBSTR...]] [--out FILE]
+ *
+ * @traceability CQ-MATH-001 §6
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "cq_types.h"
+#include "dvm.h"
+#include "analyze.h"
+#include "calibrate.h"
+#include "convert.h"
+#include "verify.h"
+#include "sha256.h"
+#include "profile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define BENCH_MAX_REPS      101u
+#define BENCH_COLS          64u     /* Matrix width for norms and BN folding */
+
+static const size_t SIZES[] = { 256u, 4096u, 65536u, 1048576u };
+#define SIZE_COUNT          (sizeof(SIZES) / sizeof(SIZES[0]))
+
+/* ============================================================================
+ * Inputs
+ * ============================================================================ */
+
+/* Shared inputs, allocated and filled once for the largest size */
+typedef struct {
+    int64_t *x64;
+    cq_fixed16_t *a;
+    cq_fixed16_t *b;
+    cq_fixed16_t *q;
+    float *f;
+    float *g;
+    float *h;
+    uint8_t *bytes;
+    float *gamma;
+    float *beta;
+    float *mean;
+    float *var;
+    float *bias;
+    uint32_t *arg;
+} bench_data_t;
+
+/* Results are folded in here so no call can be optimised away */
+static volatile int64_t g_sink;
+
+static uint32_t lcg(uint32_t *state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state;
+}
+
+static void *alloc_or_die(size_t bytes)
+{
+    void *p = malloc(bytes);
+    if (p == NULL) {
+        fprintf(stderr, "bench: out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+static void data_init(bench_data_t *d, size_t n)
+{
+    const size_t rows = n / BENCH_COLS;
+    uint32_t s = 0x5eed1234u;
+
+    d->x64 = alloc_or_die(n * sizeof(int64_t));
+    d->a = alloc_or_die(n * sizeof(cq_fixed16_t));
+    d->b = alloc_or_die(n * sizeof(cq_fixed16_t));
+    d->q = alloc_or_die(n * sizeof(cq_fixed16_t));
+    d->f = alloc_or_die(n * sizeof(float));
+    d->g = alloc_or_die(n * sizeof(float));
+    d->h = alloc_or_die(n * sizeof(float));
+    d->bytes = alloc_or_die(n);
+    d->gamma = alloc_or_die(rows * sizeof(float));
+    d->beta = alloc_or_die(rows * sizeof(float));
+    d->mean = alloc_or_die(rows * sizeof(float));
+    d->var = alloc_or_die(rows * sizeof(float));
+    d->bias = alloc_or_die(rows * sizeof(float));
+    d->arg = alloc_or_die(rows * sizeof(uint32_t));
+
+    for (size_t i = 0; i < n; i++) {
+        const int32_t r = (int32_t)(lcg(&s) >> 1) - 0x40000000;
+
+        /* Products and quotients stay in range: |a|,|b| < 2^16 in Q16.16 */
+        d->x64[i] = (int64_t)r * 4096;
+        d->a[i] = r >> 14;
+        d->b[i] = (r >> 13) | 1;
+        d->f[i] = (float)r / (float)0x40000000;
+        d->g[i] = d->f[i] + (float)(lcg(&s) & 0xffu) * 1e-6f;
+        d->q[i] = (cq_fixed16_t)(d->g[i] * 65536.0f);
+        d->bytes[i] = (uint8_t)(lcg(&s) >> 24);
+    }
+    for (size_t r = 0; r < rows; r++) {
+        d->gamma[r] = 1.0f + (float)(r % 7u) * 0.01f;
+        d->beta[r] = (float)(r % 5u) * 0.1f;
+        d->mean[r] = (float)(r % 3u) * 0.05f;
+        d->var[r] = 0.5f + (float)(r % 11u) * 0.1f;
+        d->bias[r] = 0.0f;
+    }
+}
+
+static void data_free(bench_data_t *d)
+{
+    free(d->x64);
+    free(d->a);
+    free(d->b);
+    free(d->q);
+    free(d->f);
+    free(d->g);
+    free(d->h);
+    free(d->bytes);
+    free(d->gamma);
+    free(d->beta);
+    free(d->mean);
+    free(d->var);
+    free(d->bias);
+    free(d->arg);
+}
+
+/* ============================================================================
+ * Cases
+ * ============================================================================ */
+
+static void run_round_shift_rne(bench_data_t *d, size_t n)
+{
+    cq_fault_flags_t faults = {0};
+    for (size_t i = 0; i < n; i++) {
+        d->q[i] = cq_round_shift_rne(d->x64[i], 16, &faults);
+    }
+    g_sink += d->q[n - 1];
+}
+
+static void run_mul_q16(bench_data_t *d, size_t n)
+{
+    cq_fault_flags_t faults = {0};
+    for (size_t i = 0; i < n; i++) {
+        d->q[i] = cq_mul_q16(d->a[i], d->b[i], &faults);
+    }
+    g_sink += d->q[n - 1];
+}
+
+static void run_div_q16(bench_data_t *d, size_t n)
+{
+    cq_fault_flags_t faults = {0};
+    for (size_t i = 0; i < n; i++) {
+        d->q[i] = cq_div_q16(d->a[i], d->b[i], &faults);
+    }
+    g_sink += d->q[n - 1];
+}
+
+static void run_div_q16_array(bench_data_t *d, size_t n)
+{
+    cq_fault_flags_t faults = {0};
+    cq_divisor_t div;
+    cq_divisor_init(&div, d->b[0]);
+    cq_div_q16_array(d->a, &div, d->q, n, &faults);
+    g_sink += d->q[n - 1];
+}
+
+static void run_mac_q16(bench_data_t *d, size_t n)
+{
+    cq_fault_flags_t faults = {0};
+    cq_accum64_t acc = 0;
+    for (size_t i = 0; i < n; i++) {
+        cq_mac_q16(&acc, d->a[i], d->b[i], &faults);
+    }
+    g_sink += acc;
+}
+
+static void run_quantize_weight_rne(bench_data_t *d, size_t n)
+{
+    cq_fault_flags_t faults = {0};
+    for (size_t i = 0; i < n; i++) {
+        d->q[i] = cq_quantize_weight_rne(d->f[i], 65536.0, &faults);
+    }
+    g_sink += d->q[n - 1];
+}
+
+static void run_convert_weights(bench_data_t *d, size_t n)
+{
+    cq_fault_flags_t faults = {0};
+    cq_tensor_spec_t spec;
+
+    memset(&spec, 0, sizeof(spec));
+    spec.scale_exp = 16;
+    spec.is_symmetric = true;
+    g_sink += cq_convert_weights(d->f, d->q, n, &spec, &faults);
+    g_sink += d->q[n - 1];
+}
+
+static void run_quantize_input(bench_data_t *d, size_t n)
+{
+    cq_fault_flags_t faults = {0};
+    cq_tensor_spec_t spec;
+
+    memset(&spec, 0, sizeof(spec));
+    spec.scale_exp = 16;
+    spec.is_symmetric = true;
+    g_sink += cq_quantize_input(d->f, d->q, n, &spec, NULL, &faults);
+    g_sink += d->q[n - 1];
+}
+
+static void run_sha256(bench_data_t *d, size_t n)
+{
+    uint8_t digest[CQ_SHA256_DIGEST_SIZE];
+    cq_sha256(d->bytes, n, digest);
+    g_sink += digest[0];
+}
+
+static void run_tensor_stats_update(bench_data_t *d, size_t n)
+{
+    cq_tensor_stats_t stats;
+    cq_tensor_stats_init(&stats, 0, 0, -1.0f, 1.0f);
+    cq_tensor_stats_update(&stats, d->f, n);
+    g_sink += (int64_t)(stats.max_observed * 1e6f);
+}
+
+static void run_linf_norm(bench_data_t *d, size_t n)
+{
+    g_sink += (int64_t)(cq_linf_norm(d->f, d->g, n) * 1e9);
+}
+
+static void run_linf_norm_q16(bench_data_t *d, size_t n)
+{
+    g_sink += (int64_t)(cq_linf_norm_q16(d->g, d->q, n) * 1e9);
+}
+
+static void run_dequantize_f32(bench_data_t *d, size_t n)
+{
+    g_sink += cq_dequantize_f32(d->q, d->h, n);
+    g_sink += (int64_t)d->h[n - 1];
+}
+
+static void run_dequantize_argmax(bench_data_t *d, size_t n)
+{
+    g_sink += cq_dequantize_argmax(d->q, d->h, n / BENCH_COLS, BENCH_COLS, d->arg);
+    g_sink += d->arg[n / BENCH_COLS - 1];
+}
+
+static void run_frobenius_norm(bench_data_t *d, size_t n)
+{
+    g_sink += (int64_t)cq_frobenius_norm(d->f, n / BENCH_COLS, BENCH_COLS);
+}
+
+static void run_row_sum_norm(bench_data_t *d, size_t n)
+{
+    g_sink += (int64_t)cq_row_sum_norm(d->f, n / BENCH_COLS, BENCH_COLS);
+}
+
+static void run_fold_batchnorm(bench_data_t *d, size_t n)
+{
+    const size_t rows = n / BENCH_COLS;
+    cq_fault_flags_t faults = {0};
+    cq_bn_folding_record_t record;
+    cq_bn_params_t bn;
+
+    bn.gamma = d->gamma;
+    bn.beta = d->beta;
+    bn.mean = d->mean;
+    bn.var = d->var;
+    bn.epsilon = 1e-5f;
+    bn.channel_count = rows;
+    g_sink += cq_fold_batchnorm(d->f, NULL, &bn, d->h, d->bias, rows, BENCH_COLS,
+                                &record, &faults);
+    g_sink += record.folded_weights_hash[0];
+}
+
+typedef struct {
+    const char *name;
+    double bytes_per_elem;          /* Compulsory traffic per element */
+    void (*run)(bench_data_t *d, size_t n);
+} bench_case_t;
+
+static const bench_case_t CASES[] = {
+    { "round_shift_rne",      12.0, run_round_shift_rne },
+    { "mul_q16",              12.0, run_mul_q16 },
+    { "div_q16",              12.0, run_div_q16 },
+    { "div_q16_array",        12.0, run_div_q16_array },
+    { "mac_q16",               8.0, run_mac_q16 },
+    { "quantize_weight_rne",   8.0, run_quantize_weight_rne },
+    { "convert_weights",       8.0, run_convert_weights },
+    { "quantize_input",        8.0, run_quantize_input },
+    { "sha256",                1.0, run_sha256 },
+    { "tensor_stats_update",   4.0, run_tensor_stats_update },
+    { "linf_norm",             8.0, run_linf_norm },
+    { "linf_norm_q16",         8.0, run_linf_norm_q16 },
+    { "dequantize_f32",        8.0, run_dequantize_f32 },
+    { "dequantize_argmax",     8.0, run_dequantize_argmax },
+    { "frobenius_norm",        4.0, run_frobenius_norm },
+    { "row_sum_norm",          4.0, run_row_sum_norm },
+    { "fold_batchnorm",        8.0, run_fold_batchnorm },
+};
+#define CASE_COUNT          (sizeof(CASES) / sizeof(CASES[0]))
+
+/* ============================================================================
+ * Statistics
+ * ============================================================================ */
+
+typedef struct {
+    double median;
+    double mad;                     /* Median absolute deviation */
+    double mean;
+    double variance;                /* Unbiased sample variance */
+    double min;
+} bench_stats_t;
+
+static int cmp_double(const void *pa, const void *pb)
+{
+    const double a = *(const double *)pa;
+    const double b = *(const double *)pb;
+    return (a > b) - (a < b);
+}
+
+static double median_of(double *v, uint32_t n)
+{
+    qsort(v, n, sizeof(double), cmp_double);
+    return (n % 2u) ? v[n / 2u] : 0.5 * (v[n / 2u - 1u] + v[n / 2u]);
+}
+
+static void compute_stats(const double *samples, uint32_t n, bench_stats_t *st)
+{
+    double tmp[BENCH_MAX_REPS];
+    double sum = 0.0, sq = 0.0;
+
+    for (uint32_t i = 0; i < n; i++) {
+        sum += samples[i];
+    }
+    st->mean = sum / (double)n;
+    for (uint32_t i = 0; i < n; i++) {
+        sq += (samples[i] - st->mean) * (samples[i] - st->mean);
+    }
+    st->variance = (n > 1u) ? sq / (double)(n - 1u) : 0.0;
+
+    memcpy(tmp, samples, n * sizeof(double));
+    st->median = median_of(tmp, n);
+    st->min = tmp[0];
+    for (uint32_t i = 0; i < n; i++) {
+        tmp[i] = (samples[i] > st->median) ? samples[i] - st->median : st->median - samples[i];
+    }
+    st->mad = median_of(tmp, n);
+}
+
+/* ============================================================================
+ * Machine Fingerprint
+ * ============================================================================ */
+
+#if defined(__GNUC__) || defined(__clang__)
+#define BENCH_COMPILER      __VERSION__
+#else
+#define BENCH_COMPILER      "unknown"
+#endif
+
+typedef struct {
+    char cpu[128];
+    long cpus;
+    char fingerprint[17];
+} bench_machine_t;
+
+/* "model name" from /proc/cpuinfo, with JSON-unsafe characters replaced */
+static void read_cpu_model(char *cpu, size_t size)
+{
+    char line[256];
+    FILE *f = fopen("/proc/cpuinfo", "r");
+
+    snprintf(cpu, size, "unknown");
+    if (f == NULL) {
+        return;
+    }
+    while (fgets(line, sizeof(line), f) != NULL) {
+        const char *colon = strchr(line, ':');
+        if (strncmp(line, "model name", 10) == 0 && colon != NULL) {
+            snprintf(cpu, size, "%s", colon + (colon[1] == ' ' ? 2 : 1));
+            break;
+        }
+    }
+    fclose(f);
+
+    for (char *c = cpu; *c != '\0'; c++) {
+        if (*c == '\n') {
+            *c = '\0';
+            break;
+        }
+        if (*c == '"' || *c == '\\' || (unsigned char)*c < 0x20u) {
+            *c = '_';
+        }
+    }
+}
+
+static void machine_identify(bench_machine_t *m)
+{
+    static const char hex[] = "0123456789abcdef";
+    uint8_t digest[CQ_SHA256_DIGEST_SIZE];
+    char id[512];
+    int len;
+
+    read_cpu_model(m->cpu, sizeof(m->cpu));
+    m->cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    len = snprintf(id, sizeof(id), "%s|%ld|%s|%u", m->cpu, m->cpus, BENCH_COMPILER,
+                   (unsigned)sizeof(void *));
+    cq_sha256(id, (len > 0 && (size_t)len < sizeof(id)) ? (size_t)len : sizeof(id) - 1u,
+              digest);
+    for (int i = 0; i < 8; i++) {
+        m->fingerprint[2 * i] = hex[digest[i] >> 4];
+        m->fingerprint[2 * i + 1] = hex[digest[i] & 0x0fu];
+    }
+    m->fingerprint[16] = '\0';
+}
+
+/* ============================================================================
+ * Driver
+ * ============================================================================ */
+
+typedef struct {
+    uint32_t reps;
+    uint64_t min_ns;
+    size_t max_n;
+    const char *filter;
+    const char *out;
+} bench_opts_t;
+
+/* Comma-separated substrings; NULL selects everything */
+static bool selected(const char *name, const char *filter)
+{
+    char pat[64];
+
+    if (filter == NULL) {
+        return true;
+    }
+    while (*filter != '\0') {
+        const size_t len = strcspn(filter, ",");
+        if (len > 0 && len < sizeof(pat)) {
+            memcpy(pat, filter, len);
+            pat[len] = '\0';
+            if (strstr(name, pat) != NULL) {
+                return true;
+            }
+        }
+        filter += len + (filter[len] == ',' ? 1u : 0u);
+    }
+    return false;
+}
+
+static uint64_t time_iters(const bench_case_t *c, bench_data_t *d, size_t n, uint64_t iters)
+{
+    const uint64_t t0 = cq_profile_now_ns();
+    for (uint64_t k = 0; k < iters; k++) {
+        c->run(d, n);
+    }
+    return cq_profile_now_ns() - t0;
+}
+
+static void bench_one(const bench_case_t *c, bench_data_t *d, size_t n,
+                      const bench_opts_t *o, FILE *out, bool first)
+{
+    double samples[BENCH_MAX_REPS];
+    bench_stats_t st;
+    uint64_t iters = 1;
+
+    /* Warm up, then double until one sample is long enough */
+    (void)time_iters(c, d, n, 1);
+    while (time_iters(c, d, n, iters) < o->min_ns && iters < (UINT64_C(1) << 40)) {
+        iters *= 2u;
+    }
+    for (uint32_t r = 0; r < o->reps; r++) {
+        samples[r] = (double)time_iters(c, d, n, iters) / ((double)iters * (double)n);
+    }
+    compute_stats(samples, o->reps, &st);
+
+    fprintf(out,
+            "%s    {\"name\":\"%s\",\"n\":%lu,\"iters\":%llu,\"reps\":%u,"
+            "\"bytes_per_elem\":%.1f,\"ns_per_elem\":{\"median\":%.6f,\"mad\":%.6f,"
+            "\"mean\":%.6f,\"variance\":%.9f,\"min\":%.6f},\"gbps\":%.4f}",
+            first ? "" : ",\n", c->name, (unsigned long)n, (unsigned long long)iters,
+            (unsigned)o->reps, c->bytes_per_elem, st.median, st.mad, st.mean,
+            st.variance, st.min, (st.median > 0.0) ? c->bytes_per_elem / st.median : 0.0);
+    fprintf(stderr, "%-22s n=%-8lu %10.3f ns/elem  (MAD %.3f)\n",
+            c->name, (unsigned long)n, st.median, st.mad);
+}
+
+static int parse_args(int argc, char **argv, bench_opts_t *o)
+{
+    o->reps = 15;
+    o->min_ns = 2000000u;
+    o->max_n = SIZES[SIZE_COUNT - 1u];
+    o->filter = NULL;
+    o->out = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        const char *v = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (v == NULL) {
+            return -1;
+        } else if (strcmp(argv[i], "--reps") == 0) {
+            o->reps = (uint32_t)strtoul(v, NULL, 10);
+        } else if (strcmp(argv[i], "--min-ms") == 0) {
+            o->min_ns = (uint64_t)(strtod(v, NULL) * 1e6);
+        } else if (strcmp(argv[i], "--max-n") == 0) {
+            o->max_n = (size_t)strtoul(v, NULL, 10);
+        } else if (strcmp(argv[i], "--filter") == 0) {
+            o->filter = v;
+        } else if (strcmp(argv[i], "--out") == 0) {
+            o->out = v;
+        } else {
+            return -1;
+        }
+        i++;
+    }
+    return (o->reps == 0 || o->reps > BENCH_MAX_REPS || o->max_n < SIZES[0]) ? -1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+    bench_opts_t opts;
+    bench_data_t data;
+    bench_machine_t machine;
+    FILE *out = stdout;
+    bool first = true;
+
+    if (parse_args(argc, argv, &opts) != 0) {
+        fprintf(stderr, "usage: %s [--reps N<=%u] [--min-ms M] [--max-n N>=%lu] "
+                "[--filter SUBSTR[,SUBSTR...]] [--out FILE]\n",
+                argv[0], BENCH_MAX_REPS, (unsigned long)SIZES[0]);
+        return 2;
+    }
+    if (opts.out != NULL && (out = fopen(opts.out, "w")) == NULL) {
+        fprintf(stderr, "bench: cannot open %s\n", opts.out);
+        return 1;
+    }
+
+    data_init(&data, SIZES[SIZE_COUNT - 1u]);
+    machine_identify(&machine);
+
+    fprintf(out, "{\"suite\":\"certifiable-quant\",\"format\":1,\"reps\":%u,"
+            "\"min_ms\":%.3f,\n \"machine\":{\"fingerprint\":\"%s\",\"cpu\":\"%s\","
+            "\"cpus\":%ld,\"compiler\":\"%s\"},\n \"results\":[\n",
+            (unsigned)opts.reps, (double)opts.min_ns / 1e6, machine.fingerprint,
+            machine.cpu, machine.cpus, BENCH_COMPILER);
+    for (size_t c = 0; c < CASE_COUNT; c++) {
+        if (!selected(CASES[c].name, opts.filter)) {
+            continue;
+        }
+        for (size_t s = 0; s < SIZE_COUNT && SIZES[s] <= opts.max_n; s++) {
+            bench_one(&CASES[c], &data, SIZES[s], &opts, out, first);
+            first = false;
+        }
+    }
+    fputs("\n]}\n", out);
+
+    data_free(&data);
+    if (out != stdout && fclose(out) != 0) {
+        return 1;
+    }
+    return 0;
+}
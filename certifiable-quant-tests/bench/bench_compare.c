@@ -0,0 +1,326 @@
+/**
+ * @file bench_compare.c
+ * @project Certifiable-Quant
+ * @brief Performance regression gate over certifiable_quant_bench results
+ *
+ * Compares one or more result files from the same machine against the
+ * baseline stored as <baseline-dir>/<fingerprint>.json. Per kernel and
+ * size the statistic is the median ns/element; with several runs, the
+ * median of the run medians. Noise is the larger of the median in-run
+ * MAD and the MAD of the run medians.
+ *
+ * A kernel regresses when it is slower than the baseline by more than
+ * --threshold percent AND by more than 3 scaled MADs (1.4826 · MAD
+ * estimates σ) of the noisier side, so a jittery machine does not fail
+ * the gate on noise alone.
+ *
+ * With no baseline for the fingerprint, or with --update, the combined
+ * results become the baseline. Everything runs offline.
+ *
+ * Usage: certifiable_quant_bench_compare [--baseline-dir DIR]
+ *            [--threshold PCT] [--update] RESULT.json [RESULT.json...]
+ * Exit:  0 no regression (or baseline written), 1 regression,
+ *        2 usage or I/O error.
+ *
+ * @traceability CQ-MATH-001 §6
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define MAX_RUNS            32u
+#define MAX_RESULTS         256u
+#define NAME_LEN            48u
+#define FP_LEN              16u
+#define SIGMA_PER_MAD       1.4826
+#define NOISE_SIGMAS        3.0
+
+typedef struct {
+    char name[NAME_LEN];
+    unsigned long n;
+    double median;
+    double mad;
+} result_t;
+
+typedef struct {
+    char fingerprint[FP_LEN + 1u];
+    result_t results[MAX_RESULTS];
+    unsigned count;
+} run_t;
+
+/* ============================================================================
+ * Parsing
+ * ============================================================================ */
+
+static char *read_file(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    char *buf = NULL;
+    long size;
+
+    if (f == NULL) {
+        return NULL;
+    }
+    if (fseek(f, 0, SEEK_END) == 0 && (size = ftell(f)) >= 0 && fseek(f, 0, SEEK_SET) == 0) {
+        buf = malloc((size_t)size + 1u);
+        if (buf != NULL) {
+            if (fread(buf, 1, (size_t)size, f) != (size_t)size) {
+                free(buf);
+                buf = NULL;
+            } else {
+                buf[size] = '\0';
+            }
+        }
+    }
+    fclose(f);
+    return buf;
+}
+
+/* Value following "key": inside [p, end), or NULL */
+static const char *find_key(const char *p, const char *end, const char *key)
+{
+    const char *v = strstr(p, key);
+    return (v != NULL && (end == NULL || v < end)) ? v + strlen(key) : NULL;
+}
+
+/* Reads a bench or baseline file; returns 0 or -1 */
+static int parse_run(const char *path, run_t *run)
+{
+    static const char OBJ[] = "{\"name\":\"";
+    char *buf = read_file(path);
+    const char *p;
+    const char *fp;
+
+    if (buf == NULL) {
+        fprintf(stderr, "compare: cannot read %s\n", path);
+        return -1;
+    }
+    memset(run, 0, sizeof(*run));
+
+    fp = find_key(buf, NULL, "\"fingerprint\":\"");
+    if (fp == NULL || strspn(fp, "0123456789abcdef") != FP_LEN) {
+        fprintf(stderr, "compare: %s has no machine fingerprint\n", path);
+        free(buf);
+        return -1;
+    }
+    memcpy(run->fingerprint, fp, FP_LEN);
+
+    for (p = strstr(buf, OBJ); p != NULL && run->count < MAX_RESULTS; ) {
+        const char *name = p + strlen(OBJ);
+        const char *next = strstr(name, OBJ);
+        const size_t len = strcspn(name, "\"");
+        result_t *r = &run->results[run->count];
+        const char *n = find_key(name, next, "\"n\":");
+        const char *med = find_key(name, next, "\"median\":");
+        const char *mad = find_key(name, next, "\"mad\":");
+
+        if (len > 0 && len < NAME_LEN && n != NULL && med != NULL && mad != NULL) {
+            memcpy(r->name, name, len);
+            r->name[len] = '\0';
+            r->n = strtoul(n, NULL, 10);
+            r->median = strtod(med, NULL);
+            r->mad = strtod(mad, NULL);
+            run->count++;
+        }
+        p = next;
+    }
+    free(buf);
+    return 0;
+}
+
+/* ============================================================================
+ * Statistics
+ * ============================================================================ */
+
+static int cmp_double(const void *pa, const void *pb)
+{
+    const double a = *(const double *)pa;
+    const double b = *(const double *)pb;
+    return (a > b) - (a < b);
+}
+
+static double median_of(double *v, unsigned n)
+{
+    qsort(v, n, sizeof(double), cmp_double);
+    return (n % 2u) ? v[n / 2u] : 0.5 * (v[n / 2u - 1u] + v[n / 2u]);
+}
+
+static const result_t *lookup(const run_t *run, const char *name, unsigned long n)
+{
+    for (unsigned i = 0; i < run->count; i++) {
+        if (run->results[i].n == n && strcmp(run->results[i].name, name) == 0) {
+            return &run->results[i];
+        }
+    }
+    return NULL;
+}
+
+/* Combine the kernels of runs[0] across every run that measured them */
+static void combine(const run_t *runs, unsigned run_count, run_t *out)
+{
+    double med[MAX_RUNS], mad[MAX_RUNS];
+
+    memset(out, 0, sizeof(*out));
+    memcpy(out->fingerprint, runs[0].fingerprint, sizeof(out->fingerprint));
+
+    for (unsigned i = 0; i < runs[0].count; i++) {
+        const result_t *first = &runs[0].results[i];
+        result_t *r = &out->results[out->count++];
+        unsigned k = 0;
+
+        for (unsigned j = 0; j < run_count; j++) {
+            const result_t *x = lookup(&runs[j], first->name, first->n);
+            if (x != NULL) {
+                med[k] = x->median;
+                mad[k] = x->mad;
+                k++;
+            }
+        }
+        *r = *first;
+        r->median = median_of(med, k);
+        r->mad = median_of(mad, k);
+        for (unsigned j = 0; j < k; j++) {
+            med[j] = (med[j] > r->median) ? med[j] - r->median : r->median - med[j];
+        }
+        if (median_of(med, k) > r->mad) {
+            r->mad = median_of(med, k);
+        }
+    }
+}
+
+/* ============================================================================
+ * Baselines
+ * ============================================================================ */
+
+static int write_baseline(const char *path, const run_t *base, unsigned runs)
+{
+    FILE *f = fopen(path, "w");
+
+    if (f == NULL) {
+        return -1;
+    }
+    fprintf(f, "{\"suite\":\"certifiable-quant\",\"format\":1,\"runs\":%u,\n"
+            " \"machine\":{\"fingerprint\":\"%s\"},\n \"results\":[\n",
+            runs, base->fingerprint);
+    for (unsigned i = 0; i < base->count; i++) {
+        const result_t *r = &base->results[i];
+        fprintf(f, "    {\"name\":\"%s\",\"n\":%lu,\"ns_per_elem\":{\"median\":%.6f,\"mad\":%.6f}}%s\n",
+                r->name, r->n, r->median, r->mad, (i + 1u < base->count) ? "," : "");
+    }
+    fputs("]}\n", f);
+    return (fclose(f) == 0) ? 0 : -1;
+}
+
+static int report(const run_t *base, const run_t *cur, double threshold)
+{
+    int regressions = 0;
+
+    printf("%-22s %9s %12s %12s %9s  %s\n", "kernel", "n", "base ns/el", "cur ns/el",
+           "delta", "status");
+    for (unsigned i = 0; i < cur->count; i++) {
+        const result_t *c = &cur->results[i];
+        const result_t *b = lookup(base, c->name, c->n);
+        const char *status = "ok";
+
+        if (b == NULL || b->median <= 0.0) {
+            printf("%-22s %9lu %12s %12.3f %9s  new\n", c->name, c->n, "-", c->median, "-");
+            continue;
+        }
+
+        const double delta = c->median - b->median;
+        const double noise = NOISE_SIGMAS * SIGMA_PER_MAD * ((b->mad > c->mad) ? b->mad : c->mad);
+        const double rel = delta / b->median;
+
+        if (rel > threshold && delta > noise) {
+            status = "REGRESSION";
+            regressions++;
+        } else if (-rel > threshold && -delta > noise) {
+            status = "improved";
+        }
+        printf("%-22s %9lu %12.3f %12.3f %+8.1f%%  %s\n", c->name, c->n, b->median,
+               c->median, 100.0 * rel, status);
+    }
+    return regressions;
+}
+
+/* ============================================================================
+ * Driver
+ * ============================================================================ */
+
+static int usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [--baseline-dir DIR] [--threshold PCT] [--update] "
+            "RESULT.json [RESULT.json...]\n", argv0);
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    static run_t runs[MAX_RUNS];
+    static run_t cur, base;
+    const char *dir = "baselines";
+    double threshold = 0.10;
+    bool update = false;
+    unsigned run_count = 0;
+    char path[1024];
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--baseline-dir") == 0 && i + 1 < argc) {
+            dir = argv[++i];
+        } else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+            threshold = strtod(argv[++i], NULL) / 100.0;
+        } else if (strcmp(argv[i], "--update") == 0) {
+            update = true;
+        } else if (argv[i][0] == '-' || run_count == MAX_RUNS) {
+            return usage(argv[0]);
+        } else if (parse_run(argv[i], &runs[run_count++]) != 0) {
+            return 2;
+        }
+    }
+    if (run_count == 0 || threshold < 0.0) {
+        return usage(argv[0]);
+    }
+    for (unsigned j = 1; j < run_count; j++) {
+        if (strcmp(runs[j].fingerprint, runs[0].fingerprint) != 0) {
+            fprintf(stderr, "compare: results come from different machines\n");
+            return 2;
+        }
+    }
+    combine(runs, run_count, &cur);
+
+    if (snprintf(path, sizeof(path), "%s/%s.json", dir, cur.fingerprint) >= (int)sizeof(path)) {
+        return usage(argv[0]);
+    }
+    if (!update && access(path, F_OK) == 0) {
+        if (parse_run(path, &base) != 0) {
+            return 2;
+        }
+    } else {
+        if (mkdir(dir, 0777) != 0 && errno != EEXIST) {
+            fprintf(stderr, "compare: cannot create %s\n", dir);
+            return 2;
+        }
+        if (write_baseline(path, &cur, run_count) != 0) {
+            fprintf(stderr, "compare: cannot write %s\n", path);
+            return 2;
+        }
+        printf("baseline for %s written to %s (%u kernels, %u runs)\n",
+               cur.fingerprint, path, cur.count, run_count);
+        return 0;
+    }
+
+    const int regressions = report(&base, &cur, threshold);
+    printf("%d regression(s) beyond %.1f%% against %s\n", regressions, 100.0 * threshold, path);
+    return (regressions > 0) ? 1 : 0;
+}
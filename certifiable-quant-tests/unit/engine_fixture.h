@@ -0,0 +1,131 @@
+/**
+ * @file engine_fixture.h
+ * @project Certifiable-Quant
+ * @brief Shared model builders for the engine-level unit tests
+ *
+ * Layer/shape constructors, a deterministic Q16.16 generator and the
+ * reference MLP used by test_engine, test_profile, test_pipeline,
+ * test_codegen and test_thread_pool. Everything is static to the including
+ * test; define ENGINE_FIXTURE_BLOB_WORDS before the include to enlarge the
+ * weight blob.
+ *
+ * @traceability CQ-MATH-001 §3.4-§3.5
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#ifndef CQ_ENGINE_FIXTURE_H
+#define CQ_ENGINE_FIXTURE_H
+
+#include "engine.h"
+#include <string.h>
+
+#define ONE     65536
+
+#ifndef ENGINE_FIXTURE_BLOB_WORDS
+#define ENGINE_FIXTURE_BLOB_WORDS   4096
+#endif
+
+/* 8-byte aligned weight/bias blob */
+static uint64_t blob_words[ENGINE_FIXTURE_BLOB_WORDS];
+#define BLOB    ((uint8_t *)blob_words)
+
+/* ============================================================================
+ * Layers
+ * ============================================================================ */
+
+static inline cq_tensor_spec_t spec(int8_t exp)
+{
+    cq_tensor_spec_t s;
+    memset(&s, 0, sizeof(s));
+    s.scale_exp = exp;
+    s.format = CQ_FORMAT_Q16_16;
+    s.is_symmetric = true;
+    return s;
+}
+
+/* Q16.16 weights and activations, bias at 2^32, weights at blob offset 0 */
+static inline cq_layer_header_t layer(uint32_t type, uint32_t rows, uint32_t cols)
+{
+    cq_layer_header_t h;
+    memset(&h, 0, sizeof(h));
+    h.layer_type = type;
+    h.weight_spec = spec(16);
+    h.input_spec = spec(16);
+    h.bias_spec = spec(32);
+    h.output_spec = spec(16);
+    h.weight_rows = rows;
+    h.weight_cols = cols;
+    return h;
+}
+
+static inline cq_layer_header_t layer_at(uint32_t type, uint32_t rows, uint32_t cols,
+                                         uint64_t w_off)
+{
+    cq_layer_header_t h = layer(type, rows, cols);
+    h.weight_offset = w_off;
+    return h;
+}
+
+static inline cq_layer_shape_t shape(uint32_t c, uint32_t h, uint32_t w)
+{
+    cq_layer_shape_t s;
+    memset(&s, 0, sizeof(s));
+    s.in_channels = c;
+    s.in_height = h;
+    s.in_width = w;
+    return s;
+}
+
+/* ============================================================================
+ * Data
+ * ============================================================================ */
+
+/* Tests that need their own sequence reseed this before building */
+static uint32_t lcg_state = 12345u;
+
+/* Uniform integer in [-range, range] */
+static inline cq_fixed16_t lcg_q16(int32_t range)
+{
+    lcg_state = lcg_state * 1103515245u + 12345u;
+    return (cq_fixed16_t)((int32_t)((lcg_state >> 8) % (uint32_t)(2 * range + 1)) - range);
+}
+
+/* ============================================================================
+ * Models
+ * ============================================================================ */
+
+/* Linear(16→32) → ReLU → Linear(32→10) → Softmax */
+static inline void build_mlp(cq_layer_header_t h[4], cq_layer_shape_t sh[4], size_t *blob_size)
+{
+    int32_t *w1 = (int32_t *)BLOB;
+    int32_t *b1 = w1 + 16 * 32;
+    int32_t *w2 = b1 + 32;
+    int32_t *b2 = w2 + 32 * 10;
+
+    for (int i = 0; i < 16 * 32; i++) w1[i] = lcg_q16(ONE / 2);
+    for (int i = 0; i < 32; i++) b1[i] = lcg_q16(ONE);
+    for (int i = 0; i < 32 * 10; i++) w2[i] = lcg_q16(ONE / 4);
+    for (int i = 0; i < 10; i++) b2[i] = lcg_q16(ONE);
+
+    /* Bias at 2^32 stored as int32 (|b| ≤ 2^-16) keeps the dyadic rule */
+    h[0] = layer(CQ_LAYER_LINEAR, 32, 16);
+    h[0].bias_len = 32;
+    h[0].bias_offset = (uint64_t)((uint8_t *)b1 - BLOB);
+    h[1] = layer(CQ_LAYER_RELU, 0, 0);
+    h[2] = layer_at(CQ_LAYER_LINEAR, 10, 32, (uint64_t)((uint8_t *)w2 - BLOB));
+    h[2].bias_len = 10;
+    h[2].bias_offset = (uint64_t)((uint8_t *)b2 - BLOB);
+    h[3] = layer(CQ_LAYER_SOFTMAX, 0, 0);
+
+    sh[0] = shape(16, 1, 1);
+    sh[1] = shape(32, 1, 1);
+    sh[2] = shape(32, 1, 1);
+    sh[3] = shape(10, 1, 1);
+
+    *blob_size = (size_t)((uint8_t *)(b2 + 10) - BLOB);
+}
+
+#endif /* CQ_ENGINE_FIXTURE_H */
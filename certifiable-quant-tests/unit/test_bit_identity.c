@@ -14,11 +14,16 @@
  * @traceability CQ-MATH-001 §6 (Determinism)
  */
 
+#define _POSIX_C_SOURCE 200809L
+
 #include "dvm.h"
 #include "convert.h"
 #include "sha256.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
+#include <unistd.h>
 
 static int tests_run = 0;
 static int tests_passed = 0;
@@ -102,6 +107,97 @@ int test_sha256_vector(void) {
     return 0;
 }
 
+/* ============================================================================
+ * Test: Streaming File Hash
+ * ============================================================================ */
+
+typedef struct {
+    int fd;
+    const uint8_t *data;
+    size_t len;
+} pipe_writer_t;
+
+static void *pipe_writer_main(void *arg) {
+    pipe_writer_t *w = (pipe_writer_t *)arg;
+    size_t off = 0;
+    while (off < w->len) {
+        ssize_t n = write(w->fd, w->data + off, w->len - off);
+        if (n <= 0) break;
+        off += (size_t)n;
+    }
+    close(w->fd);
+    return NULL;
+}
+
+static int hash_temp_file_with(int (*hash)(int, uint8_t *), const uint8_t *data,
+                               size_t len, uint8_t digest[32]) {
+    char path[] = "/tmp/cq_sha256_XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) return -1;
+    unlink(path);
+    if (write(fd, data, len) != (ssize_t)len) {
+        close(fd);
+        return -1;
+    }
+    /* Leave the offset mid-file: regular files hash from offset 0 */
+    lseek(fd, (off_t)(len / 2), SEEK_SET);
+    int ret = hash(fd, digest);
+    close(fd);
+    return ret;
+}
+
+static int hash_temp_file(const uint8_t *data, size_t len, uint8_t digest[32]) {
+    return hash_temp_file_with(cq_sha256_fd, data, len, digest);
+}
+
+int test_sha256_file(void) {
+    printf("\n=== Test: Streaming File Hash ===\n");
+
+    /* Odd sizes so chunk and block boundaries never line up */
+    static uint8_t data[3 * CQ_SHA256_IO_CHUNK + 1237];
+    const size_t big = sizeof(data);
+    for (size_t i = 0; i < big; i++) {
+        data[i] = (uint8_t)((i * 2654435761u) >> 13);
+    }
+
+    uint8_t expected[32], digest[32];
+
+    cq_sha256(data, 1000, expected);
+    TEST(hash_temp_file(data, 1000, digest) == 0 &&
+         memcmp(digest, expected, 32) == 0, "small file matches cq_sha256");
+
+    cq_sha256(data, big, expected);
+    TEST(hash_temp_file(data, big, digest) == 0 &&
+         memcmp(digest, expected, 32) == 0, "mapped file matches cq_sha256");
+    TEST(hash_temp_file_with(cq_sha256_fd_read, data, big, digest) == 0 &&
+         memcmp(digest, expected, 32) == 0, "pread reader matches cq_sha256");
+
+    int fds[2];
+    TEST(pipe(fds) == 0, "create pipe");
+    pipe_writer_t w = { fds[1], data, big };
+    pthread_t writer;
+    TEST(pthread_create(&writer, NULL, pipe_writer_main, &w) == 0, "start writer");
+    int ret = cq_sha256_fd(fds[0], digest);
+    pthread_join(writer, NULL);
+    close(fds[0]);
+    TEST(ret == 0 && memcmp(digest, expected, 32) == 0,
+         "streamed pipe matches cq_sha256");
+
+    cq_sha256("", 0, expected);
+    TEST(hash_temp_file(data, 0, digest) == 0 &&
+         memcmp(digest, expected, 32) == 0, "empty file matches SHA-256('')");
+
+    TEST(cq_sha256_file("/nonexistent/cq_model.bin", digest) == CQ_ERROR_IO,
+         "missing file reports CQ_ERROR_IO");
+    TEST(cq_sha256_fd(0, NULL) == CQ_ERROR_NULL_POINTER &&
+         cq_sha256_fd_read(0, NULL) == CQ_ERROR_NULL_POINTER,
+         "NULL digest reports CQ_ERROR_NULL_POINTER");
+    TEST(cq_sha256_fd(-1, digest) == CQ_ERROR_IO,
+         "bad descriptor reports CQ_ERROR_IO");
+
+    return 0;
+}
+
 /* ============================================================================
  * Test: Quantization Bit Patterns
  * ============================================================================ */
@@ -134,6 +230,7 @@ int main(void) {
     failed += test_rne_bit_patterns();
     failed += test_mul_bit_patterns();
     failed += test_sha256_vector();
+    failed += test_sha256_file();
     failed += test_quantization_bit_patterns();
 
     printf("\n============================================\n");
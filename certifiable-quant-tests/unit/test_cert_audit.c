@@ -0,0 +1,237 @@
+/**
+ * @file test_cert_audit.c
+ * @project Certifiable-Quant
+ * @brief Unit tests for parallel bulk certificate verification
+ *
+ * @traceability SRS-005-CERTIFICATE
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "cert_audit.h"
+#include "ed25519.h"
+#include "sha256.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define TEST(name) static int name(void)
+#define ASSERT(cond, msg) do { \
+    if (!(cond)) { \
+        printf("  FAIL: %s\n", msg); \
+        return 0; \
+    } \
+} while(0)
+#define RUN_TEST(test) do { \
+    printf("Running %s...\n", #test); \
+    tests_run++; \
+    if (test()) { \
+        tests_passed++; \
+        printf("  PASS\n"); \
+    } \
+} while(0)
+
+#define AUDIT_N 200
+
+static uint8_t records[AUDIT_N][CQ_CERTIFICATE_SIZE];
+static uint8_t pk[32], sk[64];
+static char work_dir[64];
+
+/* ============================================================================
+ * Helpers
+ * ============================================================================ */
+
+/* Certificate i references a model whose content is "model-<i>" */
+static void make_model(uint32_t i, char *content, size_t size)
+{
+    snprintf(content, size, "model-%u", (unsigned)i);
+}
+
+static void make_records(void)
+{
+    uint8_t seed[32];
+    memset(seed, 0x33, sizeof(seed));
+    cq_ed25519_keypair_from_seed(seed, pk, sk);
+
+    for (uint32_t i = 0; i < AUDIT_N; i++) {
+        cq_certificate_t cert;
+        char model[32];
+        size_t size;
+
+        memset(&cert, 0, sizeof(cert));
+        memcpy(cert.magic, CQ_CERTIFICATE_MAGIC, 4);
+        cert.scope_symmetric_only = CQ_SCOPE_SYMMETRIC_ONLY;
+        cert.scope_format = CQ_FORMAT_Q16_16_CODE;
+        cert.epsilon_total_claimed = 1.0e-4;
+        cert.epsilon_max_measured = 5.0e-5;
+        make_model(i, model, sizeof(model));
+        cq_sha256(model, strlen(model), cert.target_model_hash);
+        cert.target_param_count = i;
+        cq_certificate_compute_merkle(&cert, cert.merkle_root);
+        cq_certificate_sign(&cert, sk);
+        cq_certificate_serialise(&cert, records[i], &size);
+    }
+}
+
+static void reseal(uint8_t *record)
+{
+    cq_certificate_t cert;
+    size_t size;
+    memcpy(&cert, record, sizeof(cert));
+    cq_certificate_compute_merkle(&cert, cert.merkle_root);
+    cq_certificate_sign(&cert, sk);
+    cq_certificate_serialise(&cert, record, &size);
+}
+
+static void hash_name(const uint8_t hash[32], char out[65])
+{
+    for (int i = 0; i < 32; i++) {
+        sprintf(out + 2 * i, "%02x", hash[i]);
+    }
+}
+
+static int write_file(const char *path, const void *data, size_t len)
+{
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        return 0;
+    }
+    size_t n = fwrite(data, 1, len, f);
+    fclose(f);
+    return n == len;
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+TEST(test_audit_all_valid)
+{
+    static uint32_t status[AUDIT_N];
+    cq_cert_audit_opts_t opts = { 4, NULL, NULL };
+
+    make_records();
+    ASSERT(cq_cert_audit_records(&records[0][0], AUDIT_N, &opts, status) == AUDIT_N,
+           "all records pass");
+
+    opts.public_key = pk;
+    ASSERT(cq_cert_audit_records(&records[0][0], AUDIT_N, &opts, status) == AUDIT_N,
+           "all signatures pass");
+    return 1;
+}
+
+TEST(test_audit_failure_reasons)
+{
+    static uint32_t status[AUDIT_N], single[AUDIT_N];
+    cq_cert_audit_opts_t opts = { 8, NULL, pk };
+
+    make_records();
+    records[3][CQ_CERT_OFF_MAGIC] = 'X';                        /* Header */
+    records[40][CQ_CERT_OFF_PARAM_COUNT] ^= 0x01;               /* Integrity */
+    records[77][CQ_CERT_OFF_SIGNATURE + 9] ^= 0x01;             /* Signature */
+    memset(records[150] + CQ_CERT_OFF_EPSILON_MAX, 0x7F, 8);    /* Bounds (huge ε_max) */
+    reseal(records[150]);
+
+    ASSERT(cq_cert_audit_records(&records[0][0], AUDIT_N, &opts, status) == AUDIT_N - 4,
+           "four failures");
+    ASSERT(status[3] == CQ_AUDIT_FAIL_HEADER, "header failure");
+    ASSERT(status[40] == CQ_AUDIT_FAIL_INTEGRITY, "integrity failure");
+    ASSERT(status[77] == CQ_AUDIT_FAIL_SIGNATURE, "signature failure");
+    ASSERT(status[150] == CQ_AUDIT_FAIL_BOUNDS, "bounds failure");
+    ASSERT(status[0] == 0 && status[199] == 0, "others pass");
+
+    /* Thread count does not change results */
+    opts.threads = 1;
+    cq_cert_audit_records(&records[0][0], AUDIT_N, &opts, single);
+    ASSERT(memcmp(status, single, sizeof(status)) == 0, "single thread agrees");
+    ASSERT(cq_cert_audit_threads(&opts, AUDIT_N) == 1, "one thread as asked");
+    opts.threads = 1000;
+    ASSERT(cq_cert_audit_threads(&opts, AUDIT_N) ==
+           (AUDIT_N + CQ_AUDIT_CLAIM - 1) / CQ_AUDIT_CLAIM, "clamped to claims");
+    ASSERT(cq_cert_audit_threads(NULL, 1) == 1, "default for one record");
+
+    ASSERT(strcmp(cq_cert_audit_reason(CQ_AUDIT_FAIL_INTEGRITY), "integrity") == 0,
+           "reason name");
+    return 1;
+}
+
+TEST(test_audit_files_and_models)
+{
+    static char paths[AUDIT_N][96];
+    static const char *path_ptrs[AUDIT_N + 1];
+    static uint32_t status[AUDIT_N + 1];
+    char model_dir[96], name[65], model[32];
+    cq_cert_audit_opts_t opts = { 4, NULL, pk };
+
+    make_records();
+    snprintf(model_dir, sizeof(model_dir), "%s/models", work_dir);
+    ASSERT(mkdir(model_dir, 0755) == 0, "create model dir");
+
+    for (uint32_t i = 0; i < AUDIT_N; i++) {
+        char model_path[192];
+        snprintf(paths[i], sizeof(paths[i]), "%s/%u.cqcr", work_dir, (unsigned)i);
+        ASSERT(write_file(paths[i], records[i], CQ_CERTIFICATE_SIZE), "write certificate");
+        path_ptrs[i] = paths[i];
+
+        make_model(i, model, sizeof(model));
+        if (i == 20) {
+            model[0] = 'M';     /* Model changed after certification */
+        }
+        hash_name(records[i] + CQ_CERT_OFF_TARGET_HASH, name);
+        snprintf(model_path, sizeof(model_path), "%s/%s", model_dir, name);
+        if (i != 21) {          /* Model missing */
+            ASSERT(write_file(model_path, model, strlen(model)), "write model");
+        }
+    }
+    path_ptrs[AUDIT_N] = "/nonexistent/cert.cqcr";
+
+    ASSERT(cq_cert_audit_files(path_ptrs, AUDIT_N + 1, &opts, status) == AUDIT_N,
+           "files without model check");
+    ASSERT(status[AUDIT_N] == CQ_AUDIT_FAIL_READ, "missing certificate file");
+
+    opts.model_dir = model_dir;
+    ASSERT(cq_cert_audit_files(path_ptrs, AUDIT_N + 1, &opts, status) == AUDIT_N - 2,
+           "model re-hash finds two failures");
+    ASSERT(status[20] == CQ_AUDIT_FAIL_MODEL_HASH, "changed model");
+    ASSERT(status[21] == CQ_AUDIT_FAIL_MODEL_IO, "missing model");
+    ASSERT(status[19] == 0, "unchanged model");
+    return 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("=== Certifiable-Quant Certificate Audit Tests ===\n\n");
+
+    snprintf(work_dir, sizeof(work_dir), "/tmp/cq_audit_%ld", (long)getpid());
+    if (mkdir(work_dir, 0755) != 0) {
+        printf("cannot create %s\n", work_dir);
+        return 1;
+    }
+
+    RUN_TEST(test_audit_all_valid);
+    RUN_TEST(test_audit_failure_reasons);
+    RUN_TEST(test_audit_files_and_models);
+
+    char cmd[128];
+    snprintf(cmd, sizeof(cmd), "rm -rf %s", work_dir);
+    if (system(cmd) != 0) {
+        printf("cleanup of %s failed\n", work_dir);
+    }
+
+    printf("\n=== Results: %d/%d tests passed ===\n", tests_passed, tests_run);
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
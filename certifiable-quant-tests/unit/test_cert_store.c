@@ -0,0 +1,382 @@
+/**
+ * @file test_cert_store.c
+ * @project Certifiable-Quant
+ * @brief Unit tests for the indexed certificate store
+ *
+ * @traceability SRS-005-CERTIFICATE
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "cert_store.h"
+#include "sha256.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define TEST(name) static int name(void)
+#define ASSERT(cond, msg) do { \
+    if (!(cond)) { \
+        printf("  FAIL: %s\n", msg); \
+        return 0; \
+    } \
+} while(0)
+#define RUN_TEST(test) do { \
+    printf("Running %s...\n", #test); \
+    tests_run++; \
+    if (test()) { \
+        tests_passed++; \
+        printf("  PASS\n"); \
+    } \
+} while(0)
+
+#define STORE_N 3000    /* Forces two index growths past the initial 1024 slots */
+
+static char store_path[64];
+static char index_path[80];
+
+/* ============================================================================
+ * Helpers
+ * ============================================================================ */
+
+static void remove_store(void)
+{
+    unlink(store_path);
+    unlink(index_path);
+}
+
+static void make_hash(uint8_t hash[32], uint8_t kind, uint32_t id)
+{
+    memset(hash, kind, 32);
+    hash[0] = (uint8_t)id;
+    hash[1] = (uint8_t)(id >> 8);
+    hash[2] = (uint8_t)(id >> 16);
+}
+
+static void make_cert(cq_certificate_t *cert, uint32_t target_id, uint32_t source_id)
+{
+    memset(cert, 0, sizeof(*cert));
+    memcpy(cert->magic, CQ_CERTIFICATE_MAGIC, 4);
+    cert->timestamp = 1700000000u + target_id;
+    cert->scope_symmetric_only = CQ_SCOPE_SYMMETRIC_ONLY;
+    cert->scope_format = CQ_FORMAT_Q16_16_CODE;
+    make_hash(cert->target_model_hash, 0xA0, target_id);
+    make_hash(cert->source_model_hash, 0x50, source_id);
+    cert->target_param_count = target_id;
+    cq_certificate_compute_merkle(cert, cert->merkle_root);
+}
+
+static int fill_store(cq_cert_store_t *store, uint32_t n)
+{
+    cq_certificate_t cert;
+    for (uint32_t i = 0; i < n; i++) {
+        make_cert(&cert, i, i / 2);     /* Two targets per source */
+        if (cq_cert_store_append(store, &cert, NULL) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int check_lookups(const cq_cert_store_t *store, uint32_t n)
+{
+    cq_certificate_view_t view;
+    uint8_t hash[32];
+
+    for (uint32_t i = 0; i < n; i++) {
+        make_hash(hash, 0xA0, i);
+        if (cq_cert_store_find_target(store, hash, &view) != 0 ||
+            cq_certificate_view_param_count(&view) != i) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Overwrite every index slot (record, tag pairs at the end of the file) */
+static int corrupt_slots(uint32_t capacity, uint32_t record, uint32_t tag)
+{
+    const uint32_t slot[2] = { record, tag };
+    int fd = open(index_path, O_WRONLY);
+    if (fd < 0) {
+        return 0;
+    }
+
+    off_t end = lseek(fd, 0, SEEK_END);
+    off_t pos = end - (off_t)capacity * 2 * (off_t)sizeof(slot);
+    for (; pos >= 0 && pos < end; pos += (off_t)sizeof(slot)) {
+        if (pwrite(fd, slot, sizeof(slot), pos) != (ssize_t)sizeof(slot)) {
+            break;
+        }
+    }
+    close(fd);
+    return pos == end;
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+TEST(test_store_append_and_find)
+{
+    cq_cert_store_t store;
+    cq_certificate_view_t view;
+    uint8_t hash[32];
+
+    remove_store();
+    ASSERT(cq_cert_store_open(&store, store_path) == 0, "open should create store");
+    ASSERT(store.record_count == 0, "new store is empty");
+    ASSERT(fill_store(&store, STORE_N), "appends should succeed");
+    ASSERT(store.record_count == STORE_N, "record count");
+    ASSERT(store.capacity >= 2 * STORE_N, "index grown to half load");
+    ASSERT(check_lookups(&store, STORE_N), "every target found");
+
+    /* Source lookup returns the newer of the two certificates */
+    make_hash(hash, 0x50, 7);
+    ASSERT(cq_cert_store_find_source(&store, hash, &view) == 0, "source found");
+    ASSERT(cq_certificate_view_param_count(&view) == 15, "newest source record");
+
+    make_hash(hash, 0xA0, STORE_N + 1);
+    ASSERT(cq_cert_store_find_target(&store, hash, &view) == CQ_CERT_STORE_NOT_FOUND,
+           "absent target");
+    ASSERT(cq_cert_store_get(&store, STORE_N, &view) == CQ_CERT_STORE_NOT_FOUND,
+           "out of range record");
+
+    cq_cert_store_close(&store);
+    return 1;
+}
+
+TEST(test_store_shadowing)
+{
+    cq_cert_store_t store;
+    cq_certificate_t cert;
+    cq_certificate_view_t view;
+    uint32_t idx;
+
+    remove_store();
+    ASSERT(cq_cert_store_open(&store, store_path) == 0, "open");
+    make_cert(&cert, 42, 1);
+    ASSERT(cq_cert_store_append(&store, &cert, &idx) == 0 && idx == 0, "first append");
+
+    /* Re-issued certificate for the same target */
+    cert.timestamp += 100;
+    cq_certificate_compute_merkle(&cert, cert.merkle_root);
+    ASSERT(cq_cert_store_append(&store, &cert, &idx) == 0 && idx == 1, "second append");
+
+    ASSERT(cq_cert_store_find_target(&store, cert.target_model_hash, &view) == 0, "found");
+    ASSERT(cq_certificate_view_timestamp(&view) == cert.timestamp, "newest wins");
+
+    cq_cert_store_close(&store);
+    return 1;
+}
+
+TEST(test_store_rejects_invalid)
+{
+    cq_cert_store_t store;
+    cq_certificate_t cert;
+
+    remove_store();
+    ASSERT(cq_cert_store_open(&store, store_path) == 0, "open");
+    make_cert(&cert, 1, 1);
+    cert.target_layer_count = 3;    /* Stale root */
+    ASSERT(cq_cert_store_append(&store, &cert, NULL) == CQ_ERROR_MERKLE_MISMATCH, "stale root rejected");
+    ASSERT(store.record_count == 0, "nothing appended");
+    ASSERT(cq_cert_store_open(NULL, store_path) == CQ_ERROR_NULL_POINTER, "NULL store");
+
+    cq_cert_store_close(&store);
+    return 1;
+}
+
+TEST(test_store_reopen_and_rebuild)
+{
+    cq_cert_store_t store;
+
+    remove_store();
+    ASSERT(cq_cert_store_open(&store, store_path) == 0, "open");
+    ASSERT(fill_store(&store, STORE_N), "fill");
+    ASSERT(cq_cert_store_sync(&store) == 0, "sync");
+    cq_cert_store_close(&store);
+
+    /* Persisted index is reused */
+    ASSERT(cq_cert_store_open(&store, store_path) == 0, "reopen");
+    ASSERT(store.record_count == STORE_N, "records persisted");
+    ASSERT(check_lookups(&store, STORE_N), "lookups after reopen");
+    cq_cert_store_close(&store);
+
+    /* Missing index is rebuilt */
+    unlink(index_path);
+    ASSERT(cq_cert_store_open(&store, store_path) == 0, "reopen without index");
+    ASSERT(check_lookups(&store, STORE_N), "lookups after rebuild");
+    cq_cert_store_close(&store);
+
+    /* Torn trailing record is dropped */
+    int fd = open(store_path, O_WRONLY | O_APPEND);
+    ASSERT(fd >= 0, "open data file");
+    ASSERT(write(fd, "CQCR", 4) == 4, "append torn bytes");
+    close(fd);
+    ASSERT(cq_cert_store_open(&store, store_path) == 0, "reopen with torn tail");
+    ASSERT(store.record_count == STORE_N, "torn record dropped");
+    ASSERT(check_lookups(&store, STORE_N), "lookups after truncation");
+    cq_cert_store_close(&store);
+    return 1;
+}
+
+TEST(test_store_corrupt_index)
+{
+    cq_cert_store_t store;
+    uint32_t capacity;
+
+    remove_store();
+    ASSERT(cq_cert_store_open(&store, store_path) == 0, "open");
+    ASSERT(fill_store(&store, STORE_N), "fill");
+    ASSERT(cq_cert_store_sync(&store) == 0, "sync");
+    capacity = store.capacity;
+    cq_cert_store_close(&store);
+
+    /* Slots naming records past the end are rebuilt on open */
+    ASSERT(corrupt_slots(capacity, 0xFFFFFFFFu, 0), "corrupt slots");
+    ASSERT(cq_cert_store_open(&store, store_path) == 0, "reopen with bad slots");
+    ASSERT(check_lookups(&store, STORE_N), "lookups after rebuild");
+    cq_cert_store_close(&store);
+
+    /* Full tables would never end a probe */
+    ASSERT(corrupt_slots(capacity, 1, 0), "fill every slot");
+    ASSERT(cq_cert_store_open(&store, store_path) == 0, "reopen with full tables");
+    ASSERT(check_lookups(&store, STORE_N), "lookups after rebuild");
+
+    /* Damaged while open: lookups still answer, the next append rebuilds */
+    ASSERT(corrupt_slots(capacity, 1, 0), "fill every slot while open");
+    ASSERT(check_lookups(&store, STORE_N), "lookups fall back to the records");
+    cq_certificate_t cert;
+    make_cert(&cert, STORE_N, STORE_N);
+    ASSERT(cq_cert_store_append(&store, &cert, NULL) == 0, "append rebuilds");
+    ASSERT(check_lookups(&store, STORE_N + 1), "lookups after append");
+    cq_cert_store_close(&store);
+
+    ASSERT(corrupt_slots(capacity, 1, 0), "fill every slot again");
+    ASSERT(cq_cert_store_open(&store, store_path) == 0, "reopen");
+    uint8_t hash[32];
+    cq_certificate_view_t view;
+    make_hash(hash, 0xA0, STORE_N + 7);
+    ASSERT(cq_cert_store_find_target(&store, hash, &view) == CQ_CERT_STORE_NOT_FOUND, "miss");
+    ASSERT(CQ_CERT_STORE_NOT_FOUND != CQ_ERROR_DYADIC_VIOLATION, "distinct not-found code");
+    cq_cert_store_close(&store);
+    return 1;
+}
+
+TEST(test_store_read_only)
+{
+    cq_cert_store_t store;
+    cq_certificate_t cert;
+    struct stat before, after;
+    uint8_t index_before[32], index_after[32];
+    uint32_t capacity;
+
+    remove_store();
+    ASSERT(cq_cert_store_open_readonly(&store, store_path) == CQ_ERROR_IO, "missing store");
+    ASSERT(access(store_path, F_OK) != 0, "missing store not created");
+
+    ASSERT(cq_cert_store_open(&store, store_path) == 0, "open");
+    ASSERT(fill_store(&store, STORE_N), "fill");
+    capacity = store.capacity;
+    cq_cert_store_close(&store);
+
+    /* Torn tail and a damaged index: both must survive untouched */
+    int fd = open(store_path, O_WRONLY | O_APPEND);
+    ASSERT(fd >= 0, "open data file");
+    ASSERT(write(fd, "CQCR", 4) == 4, "append torn bytes");
+    close(fd);
+    ASSERT(corrupt_slots(capacity, 0xFFFFFFFFu, 0), "corrupt slots");
+    ASSERT(stat(store_path, &before) == 0, "stat data");
+    ASSERT(cq_sha256_file(index_path, index_before) == 0, "hash index");
+
+    ASSERT(cq_cert_store_open_readonly(&store, store_path) == 0, "open read-only");
+    ASSERT(store.record_count == STORE_N, "whole records counted");
+    ASSERT(store.torn_tail_bytes == 4, "torn tail reported");
+    ASSERT(check_lookups(&store, STORE_N), "lookups from the in-memory index");
+    ASSERT(cq_cert_store_verify_all(&store, 2, NULL) == STORE_N, "all valid");
+    make_cert(&cert, STORE_N, STORE_N);
+    ASSERT(cq_cert_store_append(&store, &cert, NULL) == CQ_ERROR_IO, "append refused");
+    ASSERT(cq_cert_store_sync(&store) == 0, "sync is a no-op");
+    cq_cert_store_close(&store);
+
+    ASSERT(stat(store_path, &after) == 0 && after.st_size == before.st_size, "tail kept");
+    ASSERT(cq_sha256_file(index_path, index_after) == 0 &&
+           memcmp(index_before, index_after, 32) == 0, "index not rewritten");
+
+    /* The writable open repairs both */
+    ASSERT(cq_cert_store_open(&store, store_path) == 0, "open read-write");
+    ASSERT(store.torn_tail_bytes == 4, "torn tail reported");
+    ASSERT(check_lookups(&store, STORE_N), "lookups after repair");
+    cq_cert_store_close(&store);
+    ASSERT(stat(store_path, &after) == 0 &&
+           after.st_size == (off_t)STORE_N * CQ_CERTIFICATE_SIZE, "tail truncated");
+    return 1;
+}
+
+TEST(test_store_verify_all)
+{
+    cq_cert_store_t store;
+    cq_certificate_view_t view;
+    uint8_t hash[32];
+    static bool results[STORE_N];
+
+    remove_store();
+    ASSERT(cq_cert_store_open(&store, store_path) == 0, "open");
+    ASSERT(fill_store(&store, STORE_N), "fill");
+    ASSERT(cq_cert_store_verify_all(&store, 4, results) == STORE_N, "all valid");
+
+    /* Corrupt one record on disk behind the store's back */
+    int fd = open(store_path, O_WRONLY);
+    ASSERT(fd >= 0, "open data file");
+    uint8_t bad = 0xFF;
+    ASSERT(pwrite(fd, &bad, 1, 1234 * CQ_CERTIFICATE_SIZE + CQ_CERT_OFF_PARAM_COUNT) == 1,
+           "corrupt record");
+    close(fd);
+
+    ASSERT(cq_cert_store_verify_all(&store, 0, results) == STORE_N - 1, "one invalid");
+    ASSERT(!results[1234] && results[1233] && results[1235], "invalid record located");
+    ASSERT(cq_cert_store_verify_all(&store, 1, NULL) == STORE_N - 1, "single thread agrees");
+
+    make_hash(hash, 0xA0, 1234);
+    ASSERT(cq_cert_store_find_target(&store, hash, &view) == CQ_ERROR_MERKLE_MISMATCH, "corrupt hit reported");
+
+    cq_cert_store_close(&store);
+    return 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("=== Certifiable-Quant Certificate Store Tests ===\n\n");
+
+    snprintf(store_path, sizeof(store_path), "/tmp/cq_store_%ld.dat", (long)getpid());
+    snprintf(index_path, sizeof(index_path), "%s%s", store_path, CQ_CERT_STORE_INDEX_SUFFIX);
+
+    RUN_TEST(test_store_append_and_find);
+    RUN_TEST(test_store_shadowing);
+    RUN_TEST(test_store_rejects_invalid);
+    RUN_TEST(test_store_reopen_and_rebuild);
+    RUN_TEST(test_store_corrupt_index);
+    RUN_TEST(test_store_read_only);
+    RUN_TEST(test_store_verify_all);
+
+    remove_store();
+
+    printf("\n=== Results: %d/%d tests passed ===\n", tests_passed, tests_run);
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
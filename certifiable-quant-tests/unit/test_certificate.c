@@ -11,6 +11,9 @@
  */
 
 #include "certificate.h"
+#include "ed25519.h"
+#include "sha256.h"
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -453,7 +456,7 @@ TEST(test_deserialise_too_small)
 
     int result = cq_certificate_deserialise(buffer, 10, &cert);
 
-    ASSERT(result != 0, "too small buffer should fail");
+    ASSERT(result == CQ_ERROR_BUFFER_TOO_SMALL, "too small buffer should fail");
     return 1;
 }
 
@@ -468,7 +471,7 @@ TEST(test_deserialise_bad_header)
 
     int result = cq_certificate_deserialise(buffer, CQ_CERTIFICATE_SIZE, &cert);
 
-    ASSERT(result != 0, "bad header should fail deserialise");
+    ASSERT(result == CQ_ERROR_INVALID_HEADER, "bad header should fail deserialise");
     return 1;
 }
 
@@ -553,6 +556,443 @@ TEST(test_timestamp)
     return 1;
 }
 
+/* ============================================================================
+ * Signature Tests
+ * ============================================================================ */
+
+static void setup_signing_key(uint8_t pk[32], uint8_t sk[64])
+{
+    uint8_t seed[32];
+    memset(seed, 0x5A, sizeof(seed));
+    cq_ed25519_keypair_from_seed(seed, pk, sk);
+}
+
+TEST(test_sign_and_verify)
+{
+    cq_certificate_builder_t builder;
+    cq_certificate_t cert;
+    cq_fault_flags_t faults;
+    uint8_t pk[32], sk[64], zeros[64] = {0};
+
+    setup_complete_builder(&builder);
+    setup_signing_key(pk, sk);
+    cq_fault_clear(&faults);
+    cq_certificate_build(&builder, &cert, &faults);
+
+    ASSERT(cq_certificate_sign(&cert, sk) == 0, "sign should succeed");
+    ASSERT(memcmp(cert.signature, zeros, 64) != 0, "signature should be set");
+    ASSERT(cq_certificate_verify_integrity(&cert), "signing keeps integrity");
+    ASSERT(cq_certificate_verify_signature(&cert, pk), "signature should verify");
+    return 1;
+}
+
+TEST(test_verify_signature_tampered)
+{
+    cq_certificate_builder_t builder;
+    cq_certificate_t cert;
+    cq_fault_flags_t faults;
+    uint8_t pk[32], sk[64];
+
+    setup_complete_builder(&builder);
+    setup_signing_key(pk, sk);
+    cq_fault_clear(&faults);
+    cq_certificate_build(&builder, &cert, &faults);
+    cq_certificate_sign(&cert, sk);
+
+    /* Re-rooted forgery: content and root changed, signature kept */
+    cert.epsilon_max_measured = 0.0;
+    cq_certificate_compute_merkle(&cert, cert.merkle_root);
+
+    ASSERT(cq_certificate_verify_integrity(&cert), "forged root is self-consistent");
+    ASSERT(!cq_certificate_verify_signature(&cert, pk), "forged root should fail signature");
+    return 1;
+}
+
+TEST(test_sign_stale_root)
+{
+    cq_certificate_builder_t builder;
+    cq_certificate_t cert;
+    cq_fault_flags_t faults;
+    uint8_t pk[32], sk[64];
+
+    setup_complete_builder(&builder);
+    setup_signing_key(pk, sk);
+    cq_fault_clear(&faults);
+    cq_certificate_build(&builder, &cert, &faults);
+    cert.target_layer_count = 99;
+
+    ASSERT(cq_certificate_sign(&cert, sk) == CQ_ERROR_MERKLE_MISMATCH, "stale root should not be signed");
+    ASSERT(cq_certificate_sign(NULL, sk) == CQ_ERROR_NULL_POINTER, "NULL cert");
+    return 1;
+}
+
+TEST(test_verify_signatures_batch)
+{
+    cq_certificate_builder_t builder;
+    cq_certificate_t certs[40];
+    uint8_t keys[40][32];
+    bool results[40];
+    cq_fault_flags_t faults;
+    uint8_t pk[32], sk[64];
+
+    setup_complete_builder(&builder);
+    setup_signing_key(pk, sk);
+    for (uint32_t i = 0; i < 40; i++) {
+        cq_fault_clear(&faults);
+        builder.target_param_count = 1000 + i;
+        cq_certificate_build(&builder, &certs[i], &faults);
+        cq_certificate_sign(&certs[i], sk);
+        memcpy(keys[i], pk, 32);
+    }
+
+    ASSERT(cq_certificate_verify_signatures(certs, (const uint8_t (*)[32])keys, 40, results) == 40,
+           "all certificates should verify");
+
+    certs[3].signature[0] ^= 1;         /* Bad signature */
+    certs[33].target_layer_count = 7;   /* Bad integrity */
+    ASSERT(cq_certificate_verify_signatures(certs, (const uint8_t (*)[32])keys, 40, results) == 38,
+           "two certificates should fail");
+    ASSERT(!results[3] && !results[33] && results[0] && results[39],
+           "failures should be located");
+    return 1;
+}
+
+/* ============================================================================
+ * Zero-Copy View Tests
+ * ============================================================================ */
+
+TEST(test_view_wire_offsets)
+{
+    /* Wire offsets match the struct on the reference ABI */
+    ASSERT(offsetof(cq_certificate_t, timestamp) == CQ_CERT_OFF_TIMESTAMP, "timestamp offset");
+    ASSERT(offsetof(cq_certificate_t, bn_folding_status) == CQ_CERT_OFF_BN_STATUS, "bn status offset");
+    ASSERT(offsetof(cq_certificate_t, epsilon_0_claimed) == CQ_CERT_OFF_EPSILON_0, "epsilon_0 offset");
+    ASSERT(offsetof(cq_certificate_t, target_param_count) == CQ_CERT_OFF_PARAM_COUNT, "param count offset");
+    ASSERT(offsetof(cq_certificate_t, merkle_root) == CQ_CERT_OFF_MERKLE_ROOT, "merkle root offset");
+    ASSERT(offsetof(cq_certificate_t, signature) == CQ_CERT_OFF_SIGNATURE, "signature offset");
+    ASSERT(sizeof(cq_certificate_t) == CQ_CERTIFICATE_SIZE, "certificate size");
+    return 1;
+}
+
+TEST(test_view_open_and_accessors)
+{
+    cq_certificate_builder_t builder;
+    cq_certificate_t cert, decoded;
+    cq_certificate_view_t view;
+    cq_fault_flags_t faults;
+    uint8_t buffer[CQ_CERTIFICATE_SIZE];
+    size_t size;
+
+    setup_complete_builder(&builder);
+    cq_fault_clear(&faults);
+    cq_certificate_build(&builder, &cert, &faults);
+    cq_certificate_serialise(&cert, buffer, &size);
+
+    ASSERT(cq_certificate_view_open(&view, buffer, size) == 0, "view should open");
+    ASSERT(view.data == buffer, "view should not copy");
+    ASSERT(cq_certificate_view_timestamp(&view) == cert.timestamp, "timestamp");
+    ASSERT(cq_certificate_view_scope_format(&view) == CQ_FORMAT_Q16_16_CODE, "format");
+    ASSERT(cq_certificate_view_bn_folding_status(&view) == 0x01, "bn status");
+    ASSERT(memcmp(cq_certificate_view_version(&view), cert.version, 4) == 0, "version");
+    ASSERT(memcmp(cq_certificate_view_source_hash(&view), cert.source_model_hash, 32) == 0, "source hash");
+    ASSERT(memcmp(cq_certificate_view_analysis_digest(&view), cert.analysis_digest, 32) == 0, "analysis digest");
+    ASSERT(cq_certificate_view_epsilon_0(&view) == cert.epsilon_0_claimed, "epsilon_0");
+    ASSERT(cq_certificate_view_epsilon_total(&view) == cert.epsilon_total_claimed, "epsilon_total");
+    ASSERT(cq_certificate_view_epsilon_max(&view) == cert.epsilon_max_measured, "epsilon_max");
+    ASSERT(memcmp(cq_certificate_view_target_hash(&view), cert.target_model_hash, 32) == 0, "target hash");
+    ASSERT(cq_certificate_view_param_count(&view) == cert.target_param_count, "param count");
+    ASSERT(cq_certificate_view_layer_count(&view) == cert.target_layer_count, "layer count");
+    ASSERT(memcmp(cq_certificate_view_merkle_root(&view), cert.merkle_root, 32) == 0, "merkle root");
+
+    ASSERT(cq_certificate_view_decode(&view, &decoded) == 0, "decode should succeed");
+    ASSERT(memcmp(&decoded, &cert, sizeof(cert)) == 0, "decode should match original");
+    ASSERT(cq_certificate_verify_integrity(&decoded), "decoded certificate verifies");
+    return 1;
+}
+
+TEST(test_view_explicit_little_endian)
+{
+    cq_certificate_t cert;
+    cq_certificate_view_t view;
+    uint8_t buffer[CQ_CERTIFICATE_SIZE];
+
+    /* Hand-built wire image, independent of host byte order */
+    memset(buffer, 0, sizeof(buffer));
+    memcpy(buffer, CQ_CERTIFICATE_MAGIC, 4);
+    buffer[CQ_CERT_OFF_SCOPE_SYMMETRIC] = CQ_SCOPE_SYMMETRIC_ONLY;
+    buffer[CQ_CERT_OFF_SCOPE_FORMAT] = CQ_FORMAT_Q8_24_CODE;
+    buffer[CQ_CERT_OFF_TIMESTAMP + 0] = 0x01;
+    buffer[CQ_CERT_OFF_TIMESTAMP + 7] = 0x02;
+    buffer[CQ_CERT_OFF_LAYER_COUNT + 0] = 0x34;
+    buffer[CQ_CERT_OFF_LAYER_COUNT + 1] = 0x12;
+    buffer[CQ_CERT_OFF_EPSILON_TOTAL + 7] = 0x3F;   /* 1.0 = 0x3FF0000000000000 */
+    buffer[CQ_CERT_OFF_EPSILON_TOTAL + 6] = 0xF0;
+    cq_sha256(buffer, CQ_CERT_OFF_MERKLE_ROOT, buffer + CQ_CERT_OFF_MERKLE_ROOT);
+
+    ASSERT(cq_certificate_view_open(&view, buffer, sizeof(buffer)) == 0, "view should open");
+    ASSERT(cq_certificate_view_timestamp(&view) == 0x0200000000000001ULL, "LE timestamp");
+    ASSERT(cq_certificate_view_layer_count(&view) == 0x1234u, "LE layer count");
+    ASSERT(cq_certificate_view_epsilon_total(&view) == 1.0, "LE double");
+    ASSERT(cq_certificate_view_scope_format(&view) == CQ_FORMAT_Q8_24_CODE, "format");
+
+    cq_certificate_view_decode(&view, &cert);
+    ASSERT(cert.target_layer_count == 0x1234u, "decoded layer count");
+    return 1;
+}
+
+TEST(test_serialise_explicit_little_endian)
+{
+    cq_certificate_builder_t builder;
+    cq_certificate_t cert, restored;
+    cq_certificate_view_t view;
+    cq_fault_flags_t faults;
+    uint8_t buffer[CQ_CERTIFICATE_SIZE];
+    size_t size;
+
+    setup_complete_builder(&builder);
+    cq_fault_clear(&faults);
+    cq_certificate_build(&builder, &cert, &faults);
+    cert.timestamp = 0x0200000000000001ULL;
+    cert.target_layer_count = 0x1234u;
+    cert.epsilon_total_claimed = 1.0;
+    cq_certificate_compute_merkle(&cert, cert.merkle_root);
+
+    ASSERT(cq_certificate_serialise(&cert, buffer, &size) == 0, "serialise should succeed");
+    ASSERT(size == CQ_CERTIFICATE_SIZE, "wire size");
+    ASSERT(buffer[CQ_CERT_OFF_TIMESTAMP] == 0x01 &&
+           buffer[CQ_CERT_OFF_TIMESTAMP + 7] == 0x02, "timestamp written LE");
+    ASSERT(buffer[CQ_CERT_OFF_LAYER_COUNT] == 0x34 &&
+           buffer[CQ_CERT_OFF_LAYER_COUNT + 1] == 0x12, "layer count written LE");
+    ASSERT(buffer[CQ_CERT_OFF_EPSILON_TOTAL + 7] == 0x3F &&
+           buffer[CQ_CERT_OFF_EPSILON_TOTAL + 6] == 0xF0, "double written LE");
+
+    /* The root is over the wire bytes, so the view accepts it as written */
+    ASSERT(cq_certificate_view_open(&view, buffer, size) == 0, "view should open");
+    ASSERT(cq_certificate_deserialise(buffer, size, &restored) == 0, "deserialise should succeed");
+    ASSERT(restored.timestamp == cert.timestamp, "timestamp restored");
+    ASSERT(cq_certificate_verify_integrity(&restored), "restored root verifies");
+    return 1;
+}
+
+TEST(test_view_rejects_invalid)
+{
+    cq_certificate_builder_t builder;
+    cq_certificate_t cert;
+    cq_certificate_view_t view;
+    cq_fault_flags_t faults;
+    uint8_t buffer[CQ_CERTIFICATE_SIZE];
+    size_t size;
+
+    setup_complete_builder(&builder);
+    cq_fault_clear(&faults);
+    cq_certificate_build(&builder, &cert, &faults);
+    cq_certificate_serialise(&cert, buffer, &size);
+
+    ASSERT(cq_certificate_view_open(NULL, buffer, size) == CQ_ERROR_NULL_POINTER, "NULL view");
+    ASSERT(cq_certificate_view_open(&view, buffer, size - 1) == CQ_ERROR_BUFFER_TOO_SMALL, "short buffer");
+    ASSERT(view.data == NULL, "failed open leaves no view");
+
+    buffer[CQ_CERT_OFF_SCOPE_FORMAT] = 0x07;
+    ASSERT(cq_certificate_view_open(&view, buffer, size) == CQ_ERROR_INVALID_HEADER, "bad format");
+    buffer[CQ_CERT_OFF_SCOPE_FORMAT] = CQ_FORMAT_Q16_16_CODE;
+
+    buffer[CQ_CERT_OFF_PARAM_COUNT] ^= 0x01;
+    ASSERT(cq_certificate_view_open(&view, buffer, size) == CQ_ERROR_MERKLE_MISMATCH, "tampered content");
+    buffer[CQ_CERT_OFF_PARAM_COUNT] ^= 0x01;
+
+    /* The signature is outside the Merkle root */
+    buffer[CQ_CERT_OFF_SIGNATURE] ^= 0x01;
+    ASSERT(cq_certificate_view_open(&view, buffer, size) == 0, "signature not covered by root");
+    return 1;
+}
+
+TEST(test_view_verify_signature)
+{
+    cq_certificate_builder_t builder;
+    cq_certificate_t cert;
+    cq_certificate_view_t view;
+    cq_fault_flags_t faults;
+    uint8_t buffer[CQ_CERTIFICATE_SIZE];
+    uint8_t pk[32], sk[64];
+    size_t size;
+
+    setup_complete_builder(&builder);
+    setup_signing_key(pk, sk);
+    cq_fault_clear(&faults);
+    cq_certificate_build(&builder, &cert, &faults);
+    cq_certificate_sign(&cert, sk);
+    cq_certificate_serialise(&cert, buffer, &size);
+
+    ASSERT(cq_certificate_view_open(&view, buffer, size) == 0, "view should open");
+    ASSERT(cq_certificate_view_verify_signature(&view, pk), "signature verifies in place");
+
+    buffer[CQ_CERT_OFF_SIGNATURE + 5] ^= 0x10;
+    ASSERT(!cq_certificate_view_verify_signature(&view, pk), "tampered signature fails");
+    return 1;
+}
+
+/* ============================================================================
+ * Builder Cache Tests
+ * ============================================================================ */
+
+#define CACHE_PATH "cq_builder_cache.test"
+
+TEST(test_builder_cache_roundtrip)
+{
+    cq_certificate_builder_t builder, restored;
+    cq_certificate_t cert_orig, cert_reissued;
+    cq_fault_flags_t faults;
+
+    setup_complete_builder(&builder);
+    cq_fault_clear(&faults);
+    cq_certificate_build(&builder, &cert_orig, &faults);
+
+    ASSERT(cq_certificate_builder_save(&builder, CACHE_PATH) == 0, "save should succeed");
+    ASSERT(cq_certificate_builder_load(&restored, CACHE_PATH) == 0, "load should succeed");
+    ASSERT(cq_certificate_builder_missing(&restored) == 0, "restored builder complete");
+
+    cq_fault_clear(&faults);
+    ASSERT(cq_certificate_build(&restored, &cert_reissued, &faults) == 0, "re-issue");
+
+    /* Identical apart from the timestamp */
+    cert_reissued.timestamp = cert_orig.timestamp;
+    cq_certificate_compute_merkle(&cert_reissued, cert_reissued.merkle_root);
+    ASSERT(memcmp(&cert_orig, &cert_reissued, sizeof(cert_orig)) == 0,
+           "re-issued certificate matches original");
+
+    remove(CACHE_PATH);
+    return 1;
+}
+
+TEST(test_builder_cache_direct_edit)
+{
+    cq_certificate_builder_t builder, restored;
+    cq_certificate_t cert_orig, cert;
+    cq_fault_flags_t faults;
+    uint8_t expected[32];
+
+    setup_complete_builder(&builder);
+    cq_fault_clear(&faults);
+    cq_certificate_build(&builder, &cert_orig, &faults);
+    cq_certificate_builder_save(&builder, CACHE_PATH);
+    cq_certificate_builder_load(&builder, CACHE_PATH);
+
+    /* A direct edit bypasses the setter and still reaches the certificate */
+    builder.calibration_digest.sample_count = 1;
+    cq_sha256(&builder.calibration_digest, sizeof(builder.calibration_digest), expected);
+    cq_fault_clear(&faults);
+    cq_certificate_build(&builder, &cert, &faults);
+    ASSERT(memcmp(cert.calibration_digest, expected, 32) == 0,
+           "edited calibration digest rehashed");
+
+    /* ... and survives a save/load round trip */
+    ASSERT(cq_certificate_builder_save(&builder, CACHE_PATH) == 0, "save edited");
+    ASSERT(cq_certificate_builder_load(&restored, CACHE_PATH) == 0, "load edited");
+    cq_fault_clear(&faults);
+    cq_certificate_build(&restored, &cert, &faults);
+    ASSERT(memcmp(cert.calibration_digest, expected, 32) == 0,
+           "edited digest hash persisted");
+
+    /* Setting a new digest changes only that hash */
+    cq_analysis_digest_t analysis = builder.analysis_digest;
+    analysis.overflow_safe_count = 4;
+    cq_certificate_builder_set_analysis(&builder, &analysis);
+    cq_certificate_builder_set_version(&builder, 1, 1, 0, 0);
+    cq_fault_clear(&faults);
+    cq_certificate_build(&builder, &cert, &faults);
+    ASSERT(memcmp(cert.analysis_digest, cert_orig.analysis_digest, 32) != 0,
+           "analysis hash recomputed");
+    ASSERT(memcmp(cert.verification_digest, cert_orig.verification_digest, 32) == 0,
+           "verification hash unchanged");
+    ASSERT(cert.version[1] == 1, "new tool version");
+    ASSERT(cq_certificate_verify_integrity(&cert), "re-issued certificate verifies");
+
+    remove(CACHE_PATH);
+    return 1;
+}
+
+TEST(test_builder_cache_invalidate)
+{
+    cq_certificate_builder_t builder;
+    cq_certificate_t cert;
+    cq_fault_flags_t faults;
+
+    setup_complete_builder(&builder);
+    cq_certificate_builder_invalidate(&builder, CQ_CERT_INPUT_ANALYSIS | CQ_CERT_INPUT_TARGET);
+    ASSERT(cq_certificate_builder_missing(&builder) ==
+           (CQ_CERT_INPUT_ANALYSIS | CQ_CERT_INPUT_TARGET), "invalidated inputs missing");
+
+    /* Partial builders persist too */
+    ASSERT(cq_certificate_builder_save(&builder, CACHE_PATH) == 0, "save partial");
+    ASSERT(cq_certificate_builder_load(&builder, CACHE_PATH) == 0, "load partial");
+    ASSERT(cq_certificate_builder_missing(&builder) ==
+           (CQ_CERT_INPUT_ANALYSIS | CQ_CERT_INPUT_TARGET), "mask survives reload");
+
+    cq_fault_clear(&faults);
+    ASSERT(cq_certificate_build(&builder, &cert, &faults) != 0, "incomplete build refused");
+
+    remove(CACHE_PATH);
+    return 1;
+}
+
+TEST(test_builder_cache_corrupt)
+{
+    cq_certificate_builder_t builder;
+    uint8_t buf[1024];
+
+    setup_complete_builder(&builder);
+    ASSERT(cq_certificate_builder_save(&builder, "/tmp/" CACHE_PATH) == 0, "save to a directory");
+    remove("/tmp/" CACHE_PATH);
+    ASSERT(cq_certificate_builder_save(&builder, CACHE_PATH) == 0, "save");
+
+    FILE *f = fopen(CACHE_PATH, "rb");
+    ASSERT(f != NULL, "open cache");
+    size_t len = fread(buf, 1, sizeof(buf), f);
+    fclose(f);
+
+    buf[100] ^= 0x01;
+    f = fopen(CACHE_PATH, "wb");
+    ASSERT(f != NULL, "rewrite cache");
+    fwrite(buf, 1, len, f);
+    fclose(f);
+    ASSERT(cq_certificate_builder_load(&builder, CACHE_PATH) == CQ_ERROR_CORRUPT, "corrupt cache rejected");
+
+    buf[100] ^= 0x01;
+    buf[8] ^= 0x01;     /* Different digest layout */
+    f = fopen(CACHE_PATH, "wb");
+    ASSERT(f != NULL, "rewrite cache");
+    fwrite(buf, 1, len, f);
+    fclose(f);
+    ASSERT(cq_certificate_builder_load(&builder, CACHE_PATH) == CQ_ERROR_INVALID_HEADER, "foreign layout rejected");
+
+    /* Well-formed file whose recorded calibration hash is stale */
+    buf[8] ^= 0x01;
+    buf[176] ^= 0x01;
+    cq_sha256(buf, len - 32, buf + len - 32);
+    f = fopen(CACHE_PATH, "wb");
+    ASSERT(f != NULL, "rewrite cache");
+    fwrite(buf, 1, len, f);
+    fclose(f);
+    ASSERT(cq_certificate_builder_load(&builder, CACHE_PATH) == CQ_ERROR_CORRUPT, "stale digest hash rejected");
+
+    f = fopen(CACHE_PATH, "wb");
+    ASSERT(f != NULL, "rewrite cache");
+    fwrite(buf, 1, len - 1, f);
+    fclose(f);
+    ASSERT(cq_certificate_builder_load(&builder, CACHE_PATH) == CQ_ERROR_CORRUPT, "truncated cache rejected");
+
+    buf[0] = 'X';
+    f = fopen(CACHE_PATH, "wb");
+    ASSERT(f != NULL, "rewrite cache");
+    fwrite(buf, 1, len, f);
+    fclose(f);
+    ASSERT(cq_certificate_builder_load(&builder, CACHE_PATH) == CQ_ERROR_INVALID_HEADER, "not a cache");
+
+    remove(CACHE_PATH);
+    ASSERT(cq_certificate_builder_load(&builder, CACHE_PATH) == CQ_ERROR_IO, "missing cache");
+    return 1;
+}
+
 /* ============================================================================
  * Main
  * ============================================================================ */
@@ -588,6 +1028,26 @@ int main(void)
     RUN_TEST(test_verify_header_valid);
     RUN_TEST(test_verify_header_bad_magic);
 
+    /* Signature tests */
+    RUN_TEST(test_sign_and_verify);
+    RUN_TEST(test_verify_signature_tampered);
+    RUN_TEST(test_sign_stale_root);
+    RUN_TEST(test_verify_signatures_batch);
+
+    /* Zero-copy view tests */
+    RUN_TEST(test_view_wire_offsets);
+    RUN_TEST(test_view_open_and_accessors);
+    RUN_TEST(test_view_explicit_little_endian);
+    RUN_TEST(test_serialise_explicit_little_endian);
+    RUN_TEST(test_view_rejects_invalid);
+    RUN_TEST(test_view_verify_signature);
+
+    /* Builder cache tests */
+    RUN_TEST(test_builder_cache_roundtrip);
+    RUN_TEST(test_builder_cache_direct_edit);
+    RUN_TEST(test_builder_cache_invalidate);
+    RUN_TEST(test_builder_cache_corrupt);
+
     /* Serialisation tests */
     RUN_TEST(test_serialise_deserialise_roundtrip);
     RUN_TEST(test_deserialise_too_small);
@@ -0,0 +1,514 @@
+/**
+ * @file test_codegen.c
+ * @project Certifiable-Quant
+ * @brief Bit-identity tests of generated model code against the engine
+ *
+ * Each model is emitted with cq_codegen_emit(), compiled with the host C
+ * compiler ($CC, default cc) in harness mode, and run on the same inputs
+ * as cq_engine_run(); outputs and fault bits must match exactly. Without
+ * a host compiler only the generator itself is checked.
+ *
+ * @traceability CQ-MATH-001 §3-§4
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "codegen.h"
+#include "engine_fixture.h"
+#include "convert.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define TEST(name) static int name(void)
+#define ASSERT(cond, msg) do { \
+    if (!(cond)) { \
+        printf("  FAIL: %s\n", msg); \
+        return 0; \
+    } \
+} while(0)
+#define RUN_TEST(test) do { \
+    printf("Running %s...\n", #test); \
+    tests_run++; \
+    if (test()) { \
+        tests_passed++; \
+        printf("  PASS\n"); \
+    } \
+} while(0)
+
+#define SAMPLES     64
+#define MAX_IN      256
+#define MAX_OUT     64
+
+static cq_fixed16_t workspace[4096];
+static cq_fixed16_t inputs[SAMPLES][MAX_IN];
+static char work_dir[64];
+static bool have_cc = false;
+
+/* ============================================================================
+ * Helpers
+ * ============================================================================ */
+
+static uint32_t fault_bits(const cq_fault_flags_t *f)
+{
+    return (f->overflow ? (uint32_t)CQ_FAULT_OVERFLOW : 0u) |
+           (f->underflow ? (uint32_t)CQ_FAULT_UNDERFLOW : 0u);
+}
+
+static int emit_to(const cq_engine_t *engine, const cq_codegen_opts_t *opts, const char *path)
+{
+    FILE *f = fopen(path, "w");
+    if (f == NULL) {
+        return CQ_ERROR_IO;
+    }
+    int ret = cq_codegen_emit(engine, opts, f);
+    return (fclose(f) != 0 && ret == 0) ? CQ_ERROR_IO : ret;
+}
+
+/*
+ * Generate, compile and run the model on inputs[0..count); compare every
+ * output and fault word with cq_engine_run(). Returns 1 on a match.
+ */
+static int check_identity(cq_engine_t *engine, const cq_codegen_opts_t *opts,
+                          uint32_t count, uint32_t *fast_runs)
+{
+    const char *prefix = (opts != NULL && opts->prefix != NULL) ?
+                         opts->prefix : CQ_CODEGEN_DEFAULT_PREFIX;
+    const char *cc = getenv("CC");
+    const uint32_t in_len = engine->state[0].in_len;
+    const uint32_t out_len = engine->state[engine->layer_count - 1].out_len;
+    char src[128], bin[128], in_path[128], out_path[128], macro[64], cmd[768];
+
+    snprintf(src, sizeof(src), "%s/%s.c", work_dir, prefix);
+    snprintf(bin, sizeof(bin), "%s/%s", work_dir, prefix);
+    snprintf(in_path, sizeof(in_path), "%s/%s.in", work_dir, prefix);
+    snprintf(out_path, sizeof(out_path), "%s/%s.out", work_dir, prefix);
+    for (size_t k = 0; k <= strlen(prefix); k++) {
+        char c = prefix[k];
+        macro[k] = (c >= 'a' && c <= 'z') ? (char)(c - 'a' + 'A') : c;
+    }
+
+    if (emit_to(engine, opts, src) != 0) {
+        printf("  emit failed\n");
+        return 0;
+    }
+    if (!have_cc) {
+        printf("  SKIP: no host C compiler, bit identity not checked\n");
+        return 1;
+    }
+
+    snprintf(cmd, sizeof(cmd),
+             "%s -std=c99 -O2 -Wall -Wextra -Werror -pedantic -D%s_HARNESS -o %s %s",
+             (cc != NULL) ? cc : "cc", macro, bin, src);
+    if (system(cmd) != 0) {
+        printf("  generated code does not compile: %s\n", cmd);
+        return 0;
+    }
+
+    FILE *f = fopen(in_path, "wb");
+    if (f == NULL) {
+        return 0;
+    }
+    for (uint32_t s = 0; s < count; s++) {
+        if (fwrite(inputs[s], sizeof(int32_t), in_len, f) != in_len) {
+            fclose(f);
+            return 0;
+        }
+    }
+    fclose(f);
+
+    snprintf(cmd, sizeof(cmd), "%s < %s > %s", bin, in_path, out_path);
+    if (system(cmd) != 0) {
+        printf("  harness failed\n");
+        return 0;
+    }
+
+    f = fopen(out_path, "rb");
+    if (f == NULL) {
+        return 0;
+    }
+    int ok = 1;
+    for (uint32_t s = 0; s < count && ok; s++) {
+        cq_fixed16_t ref[MAX_OUT], got[MAX_OUT];
+        cq_fault_flags_t faults;
+        uint32_t got_faults;
+
+        if (cq_engine_run(engine, inputs[s], ref, workspace, &faults) != 0 ||
+            fread(got, sizeof(int32_t), out_len, f) != out_len ||
+            fread(&got_faults, sizeof(got_faults), 1, f) != 1) {
+            printf("  sample %u: run or read failed\n", (unsigned)s);
+            ok = 0;
+        } else if (memcmp(ref, got, out_len * sizeof(int32_t)) != 0) {
+            printf("  sample %u: outputs differ\n", (unsigned)s);
+            ok = 0;
+        } else if (got_faults != fault_bits(&faults)) {
+            printf("  sample %u: faults 0x%x, engine 0x%x\n", (unsigned)s,
+                   (unsigned)got_faults, (unsigned)fault_bits(&faults));
+            ok = 0;
+        }
+        if (fast_runs != NULL && engine->state[0].fast_path) {
+            (*fast_runs)++;
+        }
+    }
+    fclose(f);
+    return ok;
+}
+
+/* Linear(24→16, int64 bias) → ReLU → Linear(16→10, int32 bias) → Softmax */
+static void build_mlp_wide_bias(cq_layer_header_t h[4], cq_layer_shape_t sh[4], size_t *blob_size)
+{
+    int32_t *w1 = (int32_t *)BLOB;
+    int64_t *b1 = (int64_t *)(w1 + 24 * 16);
+    int32_t *w2 = (int32_t *)(b1 + 16);
+    int32_t *b2 = w2 + 16 * 10;
+
+    for (int i = 0; i < 24 * 16; i++) w1[i] = lcg_q16(ONE / 2);
+    for (int i = 0; i < 16; i++) b1[i] = (int64_t)lcg_q16(ONE) * ONE;
+    for (int i = 0; i < 16 * 10; i++) w2[i] = (i % 3 == 0) ? 0 : lcg_q16(ONE / 4);
+    for (int i = 0; i < 10; i++) b2[i] = lcg_q16(ONE);
+
+    h[0] = layer(CQ_LAYER_LINEAR, 16, 24);
+    h[0].bias_spec.format = CQ_FORMAT_Q32_32;
+    h[0].bias_len = 16;
+    h[0].bias_offset = (uint64_t)((uint8_t *)b1 - BLOB);
+    h[1] = layer(CQ_LAYER_RELU, 0, 0);
+    h[2] = layer(CQ_LAYER_LINEAR, 10, 16);
+    h[2].bias_len = 10;
+    h[2].weight_offset = (uint64_t)((uint8_t *)w2 - BLOB);
+    h[2].bias_offset = (uint64_t)((uint8_t *)b2 - BLOB);
+    h[3] = layer(CQ_LAYER_SOFTMAX, 0, 0);
+
+    sh[0] = shape(24, 1, 1);
+    sh[1] = shape(16, 1, 1);
+    sh[2] = shape(16, 1, 1);
+    sh[3] = shape(10, 1, 1);
+
+    *blob_size = (size_t)((uint8_t *)(b2 + 10) - BLOB);
+}
+
+/*
+ * Conv(2×8×8 → 4, 3×3, pad 1) → ReLU (2^16 → 2^15) → MaxPool 2×2/2 →
+ * ReLU → AvgPool 2×2/1 (2^15 → 2^16) → Linear(36→6, output exp 12) →
+ * Softmax at input exp 12.
+ */
+static void build_cnn(cq_layer_header_t h[7], cq_layer_shape_t sh[7], size_t *blob_size)
+{
+    int32_t *w1 = (int32_t *)BLOB;
+    int32_t *b1 = w1 + 4 * 2 * 9;
+    int32_t *w2 = b1 + 4;
+
+    for (int i = 0; i < 4 * 2 * 9; i++) w1[i] = lcg_q16(ONE / 2);
+    for (int i = 0; i < 4; i++) b1[i] = lcg_q16(ONE);
+    for (int i = 0; i < 6 * 36; i++) w2[i] = lcg_q16(ONE);
+
+    h[0] = layer(CQ_LAYER_CONV2D, 4, 2 * 9);
+    h[0].bias_len = 4;
+    h[0].bias_offset = (uint64_t)((uint8_t *)b1 - BLOB);
+    sh[0] = shape(2, 8, 8);
+    sh[0].kernel_h = 3;
+    sh[0].kernel_w = 3;
+    sh[0].stride = 1;
+    sh[0].padding = 1;
+
+    h[1] = layer(CQ_LAYER_RELU, 0, 0);
+    h[1].output_spec = spec(15);
+    sh[1] = shape(4, 8, 8);
+
+    h[2] = layer(CQ_LAYER_MAXPOOL, 0, 0);
+    h[2].input_spec = spec(15);
+    h[2].output_spec = spec(15);
+    sh[2] = shape(4, 8, 8);
+    sh[2].kernel_h = 2;
+    sh[2].kernel_w = 2;
+    sh[2].stride = 2;
+
+    h[3] = layer(CQ_LAYER_RELU, 0, 0);
+    h[3].input_spec = spec(15);
+    h[3].output_spec = spec(15);
+    sh[3] = shape(4, 4, 4);
+
+    h[4] = layer(CQ_LAYER_AVGPOOL, 0, 0);
+    h[4].input_spec = spec(15);
+    sh[4] = shape(4, 4, 4);
+    sh[4].kernel_h = 2;
+    sh[4].kernel_w = 2;
+    sh[4].stride = 1;
+
+    h[5] = layer(CQ_LAYER_LINEAR, 6, 36);
+    h[5].weight_offset = (uint64_t)((uint8_t *)w2 - BLOB);
+    h[5].output_spec = spec(12);
+    sh[5] = shape(4, 3, 3);
+
+    h[6] = layer(CQ_LAYER_SOFTMAX, 0, 0);
+    h[6].input_spec = spec(12);
+    sh[6] = shape(6, 1, 1);
+
+    *blob_size = (size_t)((uint8_t *)(w2 + 6 * 36) - BLOB);
+}
+
+static void fill_inputs(uint32_t in_len, int32_t range)
+{
+    for (int s = 0; s < SAMPLES; s++) {
+        for (uint32_t i = 0; i < in_len; i++) {
+            inputs[s][i] = lcg_q16(range);
+        }
+    }
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+TEST(test_codegen_api)
+{
+    cq_layer_header_t h[4];
+    cq_layer_shape_t sh[4];
+    cq_layer_state_t st[4];
+    cq_engine_t engine;
+    cq_codegen_opts_t opts;
+    size_t blob_size;
+    char line[256];
+
+    build_mlp_wide_bias(h, sh, &blob_size);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) == 0, "init");
+
+    FILE *f = tmpfile();
+    ASSERT(f != NULL, "tmpfile");
+    ASSERT(cq_codegen_emit(NULL, NULL, f) == CQ_ERROR_NULL_POINTER, "NULL engine");
+    ASSERT(cq_codegen_emit(&engine, NULL, NULL) == CQ_ERROR_NULL_POINTER, "NULL stream");
+
+    memset(&opts, 0, sizeof(opts));
+    opts.prefix = "9lives";
+    ASSERT(cq_codegen_emit(&engine, &opts, f) == CQ_ERROR_DIMENSION_MISMATCH, "bad prefix");
+    opts.prefix = "net-1";
+    ASSERT(cq_codegen_emit(&engine, &opts, f) == CQ_ERROR_DIMENSION_MISMATCH, "bad character");
+    opts.prefix = "net";
+    opts.unroll = CQ_CODEGEN_MAX_UNROLL + 1;
+    ASSERT(cq_codegen_emit(&engine, &opts, f) == CQ_ERROR_DIMENSION_MISMATCH, "bad unroll");
+
+    opts.unroll = 0;
+    ASSERT(cq_codegen_emit(&engine, &opts, f) == 0, "emit");
+    rewind(f);
+
+    /* Standalone: only <stdint.h> outside the harness; constants inlined */
+    int includes = 0, run_found = 0, in_harness = 0, dims = 0;
+    while (fgets(line, sizeof(line), f) != NULL) {
+        if (strncmp(line, "#ifdef NET_HARNESS", 18) == 0) in_harness = 1;
+        if (strncmp(line, "#include", 8) == 0 && !in_harness) {
+            includes++;
+            ASSERT(strstr(line, "<stdint.h>") != NULL, "only stdint.h");
+        }
+        if (strstr(line, "void net_run(const int32_t *input") != NULL) run_found = 1;
+        if (strstr(line, "#define NET_INPUT_LEN   24u") != NULL) dims++;
+        if (strstr(line, "#define NET_OUTPUT_LEN  10u") != NULL) dims++;
+        ASSERT(strstr(line, "hdr->") == NULL && strstr(line, "shape->") == NULL,
+               "no run-time model description");
+    }
+    fclose(f);
+    ASSERT(includes == 1 && run_found && dims == 2, "generated interface");
+    return 1;
+}
+
+TEST(test_codegen_mlp_identity)
+{
+    cq_layer_header_t h[4];
+    cq_layer_shape_t sh[4];
+    cq_layer_state_t st[4];
+    cq_engine_t engine;
+    cq_codegen_opts_t opts;
+    size_t blob_size;
+
+    build_mlp_wide_bias(h, sh, &blob_size);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) == 0, "init");
+    fill_inputs(24, 4 * ONE);
+    inputs[0][3] = INT32_MAX;           /* Saturates a hidden unit */
+    inputs[1][0] = INT32_MIN;
+
+    memset(&opts, 0, sizeof(opts));
+    opts.prefix = "mlp";
+    ASSERT(check_identity(&engine, &opts, SAMPLES, NULL), "default unroll");
+
+    /* 24 inputs with unroll 5: four blocks and a remainder of 4 */
+    opts.prefix = "mlp_u5";
+    opts.unroll = 5;
+    ASSERT(check_identity(&engine, &opts, SAMPLES, NULL), "unroll 5");
+
+    opts.prefix = "mlp_u32";
+    opts.unroll = 32;
+    ASSERT(check_identity(&engine, &opts, SAMPLES, NULL), "fully unrolled");
+
+    /* Panel-packed weights are emitted row-major */
+    uint64_t count = cq_weight_layout_count(CQ_WEIGHT_LAYOUT_PANEL, 10, 16);
+    ASSERT(cq_pack_weights((const cq_fixed16_t *)(BLOB + h[2].weight_offset), 10, 16,
+                           CQ_WEIGHT_LAYOUT_PANEL, (cq_fixed16_t *)(BLOB + blob_size)) == 0,
+           "pack");
+    h[2].weight_offset = blob_size;
+    h[2].weight_layout = CQ_WEIGHT_LAYOUT_PANEL;
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB,
+                          blob_size + (size_t)count * sizeof(cq_fixed16_t)) == 0, "init packed");
+    opts.prefix = "mlp_panel";
+    opts.unroll = 0;
+    ASSERT(check_identity(&engine, &opts, SAMPLES, NULL), "panel layout");
+    return 1;
+}
+
+TEST(test_codegen_cnn_identity)
+{
+    cq_layer_header_t h[7];
+    cq_layer_shape_t sh[7];
+    cq_layer_state_t st[7];
+    cq_engine_t engine;
+    cq_codegen_opts_t opts;
+    size_t blob_size;
+
+    build_cnn(h, sh, &blob_size);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 7, BLOB, blob_size) == 0, "init");
+    fill_inputs(2 * 8 * 8, 2 * ONE);
+
+    memset(&opts, 0, sizeof(opts));
+    opts.prefix = "cnn";
+    ASSERT(check_identity(&engine, &opts, SAMPLES, NULL), "unrolled taps");
+
+    /* Kernel rows as loops (unroll below the kernel width) */
+    opts.prefix = "cnn_loop";
+    opts.unroll = 1;
+    ASSERT(check_identity(&engine, &opts, SAMPLES, NULL), "tap loops");
+
+    /* Int16 conv weights are emitted as int16_t */
+    int32_t *w1 = (int32_t *)BLOB;
+    for (int i = 0; i < 4 * 2 * 9; i++) {
+        w1[i] = (w1[i] > INT16_MAX) ? INT16_MAX : w1[i];
+    }
+    ASSERT(cq_narrow_weights(w1, 4 * 2 * 9, (int16_t *)(BLOB + blob_size)) == 0, "narrow");
+    h[0].weight_offset = blob_size;
+    h[0].weight_spec.storage = CQ_STORAGE_INT16;
+    ASSERT(cq_engine_init(&engine, h, sh, st, 7, BLOB,
+                          blob_size + 4 * 2 * 9 * sizeof(int16_t)) == 0, "init int16");
+    opts.prefix = "cnn_i16";
+    opts.unroll = 0;
+    ASSERT(check_identity(&engine, &opts, SAMPLES, NULL), "int16 storage");
+    return 1;
+}
+
+TEST(test_codegen_overflow_proof)
+{
+    cq_layer_header_t h[1];
+    cq_layer_shape_t sh[1];
+    cq_layer_state_t st[1];
+    cq_engine_t engine;
+    cq_codegen_opts_t opts;
+    int32_t *w = (int32_t *)BLOB;
+    uint32_t fast_runs = 0;
+
+    /* |w| near 2^31: the proof holds only for small inputs */
+    for (int i = 0; i < 3 * 12; i++) {
+        w[i] = (i % 2 == 0) ? INT32_MAX - i : INT32_MIN + i;
+    }
+    h[0] = layer(CQ_LAYER_LINEAR, 3, 12);
+    h[0].output_spec = spec(0);
+    sh[0] = shape(12, 1, 1);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 1, BLOB, 3 * 12 * 4) == 0, "init");
+
+    fill_inputs(12, 1 << 20);
+    for (int s = 0; s < SAMPLES / 2; s++) {
+        inputs[s][s % 12] = (s % 4 == 0) ? INT32_MIN : INT32_MAX - s;
+    }
+
+    memset(&opts, 0, sizeof(opts));
+    opts.prefix = "sat";
+    ASSERT(check_identity(&engine, &opts, SAMPLES, &fast_runs), "checked fast path");
+    if (have_cc) {
+        ASSERT(fast_runs > 0 && fast_runs < SAMPLES, "both paths exercised");
+    }
+
+    engine.fast_path_enabled = false;
+    opts.prefix = "sat_ref";
+    ASSERT(check_identity(&engine, &opts, SAMPLES, NULL), "reference path only");
+    return 1;
+}
+
+TEST(test_codegen_wide_accumulator)
+{
+    cq_layer_header_t h[4];
+    cq_layer_shape_t sh[4];
+    cq_layer_state_t st[4];
+    cq_engine_t engine;
+    cq_codegen_opts_t opts;
+    size_t blob_size;
+    int32_t *w = (int32_t *)BLOB;
+
+    memset(&opts, 0, sizeof(opts));
+    opts.prefix = "wide";
+
+    /* Proof holds for every input: nothing to widen, emitted as usual */
+    build_mlp_wide_bias(h, sh, &blob_size);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) == 0, "init mlp");
+    engine.wide_acc_enabled = true;
+    FILE *f = tmpfile();
+    ASSERT(f != NULL, "tmpfile");
+    ASSERT(cq_codegen_emit(&engine, &opts, f) == 0, "proven model emitted");
+    fclose(f);
+
+    /* |w| near 2^31: the engine would widen where the generated code saturates */
+    for (int i = 0; i < 3 * 12; i++) {
+        w[i] = (i % 2 == 0) ? INT32_MAX - i : INT32_MIN + i;
+    }
+    h[0] = layer(CQ_LAYER_LINEAR, 3, 12);
+    h[0].output_spec = spec(0);
+    sh[0] = shape(12, 1, 1);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 1, BLOB, 3 * 12 * 4) == 0, "init");
+    engine.wide_acc_enabled = true;
+    f = tmpfile();
+    ASSERT(f != NULL, "tmpfile");
+    ASSERT(cq_codegen_emit(&engine, &opts, f) == CQ_ERROR_DIMENSION_MISMATCH,
+           "widening engine refused");
+    engine.wide_acc_enabled = false;
+    ASSERT(cq_codegen_emit(&engine, &opts, f) == 0, "saturating engine emitted");
+    fclose(f);
+    return 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("=== Certifiable-Quant Code Generator Tests ===\n\n");
+    lcg_state = 2024u;
+
+    snprintf(work_dir, sizeof(work_dir), "/tmp/cq_codegen_%ld", (long)getpid());
+    if (mkdir(work_dir, 0755) != 0) {
+        printf("cannot create %s\n", work_dir);
+        return 1;
+    }
+
+    const char *cc = getenv("CC");
+    char cmd[256];
+    snprintf(cmd, sizeof(cmd), "%s --version > /dev/null 2>&1", (cc != NULL) ? cc : "cc");
+    have_cc = (system(cmd) == 0);
+
+    RUN_TEST(test_codegen_api);
+    RUN_TEST(test_codegen_mlp_identity);
+    RUN_TEST(test_codegen_cnn_identity);
+    RUN_TEST(test_codegen_overflow_proof);
+    RUN_TEST(test_codegen_wide_accumulator);
+
+    snprintf(cmd, sizeof(cmd), "rm -rf %s", work_dir);
+    if (system(cmd) != 0) {
+        printf("cleanup of %s failed\n", work_dir);
+    }
+
+    printf("\n=== Results: %d/%d tests passed ===\n", tests_passed, tests_run);
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
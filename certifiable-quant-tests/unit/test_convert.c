@@ -148,6 +148,250 @@ int test_batch_convert(void) {
     return 0;
 }
 
+/* ============================================================================
+ * Test: Sparse Conversion
+ * ============================================================================ */
+
+int test_sparse_convert(void) {
+    printf("\n=== Test: Sparse Conversion ===\n");
+
+    /* 1e-6 rounds to zero in Q16.16 and counts as sparse */
+    float w[] = {0.0f, 1.0f, 0.0f, 1e-6f,
+                 -2.0f, 0.0f, 0.0f, 0.0f,
+                 0.0f, 0.0f, 0.0f, 0.5f};
+    cq_fixed16_t q[12];
+    uint32_t row_ptr[4], col_idx[12];
+    cq_fixed16_t values[12];
+    cq_csr_q16_t csr = {0};
+    cq_fault_flags_t f = {0};
+    cq_tensor_spec_t s = {.scale_exp = 16, .is_symmetric = true};
+    bool sparse = false;
+
+    csr.row_ptr = row_ptr;
+    csr.col_idx = col_idx;
+    csr.values = values;
+    csr.capacity = 12;
+
+    int r = cq_convert_weights_sparse(w, q, 3, 4, &s, CQ_SPARSE_MIN_SPARSITY,
+                                      &csr, &sparse, &f);
+    TEST(r == 0 && sparse, "75% zeros -> CSR");
+    TEST(q[3] == 0, "Sub-LSB weight quantizes to zero");
+    TEST(csr.nnz == 3 && csr.max_row_nnz == 1, "Non-zero counts");
+    TEST(row_ptr[0] == 0 && row_ptr[1] == 1 && row_ptr[2] == 2 && row_ptr[3] == 3,
+         "Row pointers");
+    TEST(col_idx[0] == 1 && values[0] == 65536, "Row 0 entry");
+    TEST(col_idx[1] == 0 && values[1] == -131072, "Row 1 entry");
+    TEST(col_idx[2] == 3 && values[2] == 32768, "Row 2 entry");
+
+    r = cq_convert_weights_sparse(w, q, 3, 4, &s, 0.9, &csr, &sparse, &f);
+    TEST(r == 0 && !sparse, "Below threshold stays dense");
+
+    csr.capacity = 2;
+    TEST(cq_csr_from_dense(q, 3, 4, &csr) == CQ_ERROR_DIMENSION_MISMATCH && csr.nnz == 3,
+         "Capacity check reports required size");
+
+    return 0;
+}
+
+int test_pack_convert(void) {
+    printf("\n=== Test: Panel Prepacking ===\n");
+
+    /* 5 x 3: one full panel of 4 rows, one panel with 3 padding rows */
+    float w[15];
+    cq_fixed16_t q[15], packed[24], direct[24];
+    cq_fault_flags_t f = {0};
+    cq_tensor_spec_t s = {.scale_exp = 16, .is_symmetric = true};
+
+    for (int i = 0; i < 15; i++) {
+        w[i] = (float)(i + 1) * 0.25f;
+    }
+    TEST(cq_weight_layout_count(CQ_WEIGHT_LAYOUT_PANEL, 5, 3) == 24, "Padded to whole panels");
+    TEST(cq_weight_layout_count(CQ_WEIGHT_LAYOUT_ROW_MAJOR, 5, 3) == 15, "Row-major count");
+    TEST(cq_weight_layout_count(9, 5, 3) == 0, "Unknown layout");
+
+    cq_convert_weights(w, q, 15, &s, &f);
+    TEST(cq_pack_weights(q, 5, 3, CQ_WEIGHT_LAYOUT_PANEL, packed) == 0, "Pack");
+    /* Panel 0 column 1 holds rows 0..3 of column 1 */
+    TEST(packed[4] == q[1] && packed[5] == q[4] && packed[6] == q[7] && packed[7] == q[10],
+         "Column-interleaved panel");
+    TEST(packed[12] == q[12] && packed[13] == 0 && packed[23] == 0, "Zero padding rows");
+
+    memset(direct, 0x55, sizeof(direct));
+    TEST(cq_convert_weights_packed(w, direct, 5, 3, CQ_WEIGHT_LAYOUT_PANEL, &s, &f) == 0 &&
+         memcmp(direct, packed, sizeof(packed)) == 0, "Direct conversion equals pack");
+    TEST(cq_pack_weights(q, 5, 3, 9, packed) == CQ_ERROR_DIMENSION_MISMATCH,
+         "Unknown layout rejected");
+
+    /* The layout is part of the model digest */
+    uint8_t blob[96], d_row[32], d_panel[32], d_again[32];
+    cq_layer_header_t h;
+    cq_layer_shape_t sh;
+    memset(&h, 0, sizeof(h));
+    memset(&sh, 0, sizeof(sh));
+    memset(blob, 0, sizeof(blob));
+    memcpy(blob, packed, sizeof(packed));
+    h.layer_type = CQ_LAYER_LINEAR;
+    h.weight_rows = 5;
+    h.weight_cols = 3;
+    TEST(cq_model_hash(&h, &sh, 1, blob, sizeof(blob), d_row) == 0, "Hash");
+    h.weight_layout = CQ_WEIGHT_LAYOUT_PANEL;
+    cq_model_hash(&h, &sh, 1, blob, sizeof(blob), d_panel);
+    cq_model_hash(&h, &sh, 1, blob, sizeof(blob), d_again);
+    TEST(memcmp(d_row, d_panel, 32) != 0, "Layout changes the target hash");
+    TEST(memcmp(d_panel, d_again, 32) == 0, "Hash is deterministic");
+
+    /* So is the conv geometry, which lives in the shape */
+    h.layer_type = CQ_LAYER_CONV2D;
+    sh.in_channels = 1;
+    sh.in_height = 8;
+    sh.in_width = 8;
+    sh.kernel_h = 3;
+    sh.kernel_w = 3;
+    sh.stride = 1;
+    cq_model_hash(&h, &sh, 1, blob, sizeof(blob), d_row);
+    sh.stride = 2;
+    cq_model_hash(&h, &sh, 1, blob, sizeof(blob), d_panel);
+    sh.stride = 1;
+    sh.padding = 1;
+    cq_model_hash(&h, &sh, 1, blob, sizeof(blob), d_again);
+    TEST(memcmp(d_row, d_panel, 32) != 0 && memcmp(d_row, d_again, 32) != 0 &&
+         memcmp(d_panel, d_again, 32) != 0, "Stride and padding change the target hash");
+    TEST(cq_model_hash(&h, NULL, 1, blob, sizeof(blob), d_row) == CQ_ERROR_NULL_POINTER,
+         "Shapes required");
+
+    return 0;
+}
+
+int test_compact_convert(void) {
+    printf("\n=== Test: Int16 Weight Storage ===\n");
+
+    /* 0.49998 quantizes to 32767, the int16 limit; 0.5 to 32768 */
+    float w[4] = {0.25f, -0.5f, 0.49998f, 0.0f};
+    cq_fixed16_t q[4];
+    int16_t w16[4];
+    cq_fault_flags_t f = {0};
+    cq_tensor_spec_t s = {.scale_exp = 16, .is_symmetric = true};
+
+    TEST(cq_convert_weights_compact(w, q, w16, 4, &s, &f) == 0 &&
+         s.storage == CQ_STORAGE_INT16, "All weights fit -> int16");
+    TEST(q[2] == 32767 && w16[0] == q[0] && w16[1] == -32768 && w16[2] == 32767,
+         "Same integers at the same exponent");
+    TEST(s.scale_exp == 16, "Exponent unchanged");
+
+    w[2] = 0.5f;
+    TEST(cq_convert_weights_compact(w, q, w16, 4, &s, &f) == 0 &&
+         s.storage == CQ_STORAGE_INT32 && q[2] == 32768, "2^15 stays int32");
+    TEST(!cq_weights_fit_int16(q, 4) &&
+         cq_narrow_weights(q, 4, w16) == CQ_ERROR_DIMENSION_MISMATCH, "Narrowing rejected");
+
+    /* Storage is part of the model digest */
+    uint8_t blob[16] = {0}, d32[32], d16[32];
+    cq_layer_header_t h;
+    cq_layer_shape_t sh;
+    memset(&h, 0, sizeof(h));
+    memset(&sh, 0, sizeof(sh));
+    h.layer_type = CQ_LAYER_LINEAR;
+    cq_model_hash(&h, &sh, 1, blob, sizeof(blob), d32);
+    h.weight_spec.storage = CQ_STORAGE_INT16;
+    cq_model_hash(&h, &sh, 1, blob, sizeof(blob), d16);
+    TEST(memcmp(d32, d16, 32) != 0, "Storage changes the target hash");
+
+    return 0;
+}
+
+/* ============================================================================
+ * Test: Input Ingress (CQ-MATH-001 §3.6.1)
+ * ============================================================================ */
+
+/* Float with the given bit pattern */
+static float float_from_bits(uint32_t bits) {
+    union { uint32_t u; float f; } v;
+    v.u = bits;
+    return v.f;
+}
+
+int test_input_quantize(void) {
+    printf("\n=== Test: Input Quantization ===\n");
+
+    static const int8_t exps[] = { 16, 0, -3, 8, 24, 31, 40, -128, 127 };
+    static const float edges[] = {
+        0.5f, -0.5f, 1.5f, -2.5f, 0.0f, -0.0f, 32767.5f, -32768.5f,
+        32767.99999f, 1e-45f, -1e-45f, 3.4e38f, -3.4e38f, 1.00000012f,
+        2147483520.0f, -2147483648.0f, 1.0f / 3.0f, -7.75f
+    };
+    float x[67];
+    cq_fixed16_t q[67];
+    uint32_t state = 42u;
+    bool same = true;
+    bool faults_same = true;
+
+    /* Every element and fault against the scalar weight reference */
+    for (size_t e = 0; e < sizeof(exps) / sizeof(exps[0]); e++) {
+        cq_tensor_spec_t s = {.scale_exp = exps[e], .is_symmetric = true};
+        const double scale = ldexp(1.0, exps[e]);
+
+        for (int round = 0; round < 60; round++) {
+            cq_fault_flags_t f = {0}, g = {0};
+            for (int i = 0; i < 67; i++) {
+                float v;
+                state = state * 1664525u + 1013904223u;
+                if (i < 18 && round == 0) {
+                    v = edges[i];
+                } else if (round & 1) {
+                    /* Halves and quarters: ties at every exponent */
+                    v = ldexpf((float)((int32_t)state >> 20), -exps[e] - 1 - (int)(state % 3u));
+                } else {
+                    uint32_t bits = state & 0xBFFFFFFFu;   /* |x| < 2 */
+                    bits |= (round % 4 == 0) ? 0x40000000u : 0u;
+                    v = float_from_bits(bits);
+                }
+                x[i] = isfinite(v) ? v : 1.0f;
+            }
+            same = same && cq_quantize_input(x, q, 67, &s, NULL, &f) == 0;
+            for (int i = 0; i < 67; i++) {
+                same = same && q[i] == cq_quantize_weight_rne(x[i], scale, &g);
+            }
+            faults_same = faults_same && memcmp(&f, &g, sizeof(f)) == 0;
+        }
+    }
+    TEST(same, "Bit-identical to cq_quantize_weight_rne");
+    TEST(faults_same, "Same saturation faults");
+
+    /* Non-finite values: NaN -> 0, Inf saturates, both fatal */
+    cq_tensor_spec_t s16 = {.scale_exp = 16, .is_symmetric = true};
+    cq_fault_flags_t f = {0};
+    float nf[6] = {1.0f, NAN, 2.0f, INFINITY, -INFINITY, 0.25f};
+    TEST(cq_quantize_input(nf, q, 6, &s16, NULL, &f) == 0 && q[1] == 0 &&
+         q[3] == INT32_MAX && q[4] == INT32_MIN && q[5] == 16384, "NaN/Inf handled");
+    TEST(f.range_exceed && f.overflow && f.underflow, "Non-finite raises range_exceed");
+
+    /* Range veto against the calibrated safe range */
+    cq_tensor_stats_t safe;
+    memset(&safe, 0, sizeof(safe));
+    safe.min_safe = -4.0f;
+    safe.max_safe = 4.0f;
+    for (int i = 0; i < 67; i++) x[i] = (float)(i % 9) - 4.0f;
+    memset(&f, 0, sizeof(f));
+    TEST(cq_quantize_input(x, q, 67, &s16, &safe, &f) == 0 && !cq_has_fault(&f),
+         "Inside the safe range");
+    x[66] = 4.5f;
+    TEST(cq_quantize_input(x, q, 67, &s16, &safe, &f) == 0 && f.range_exceed &&
+         q[66] == 9 * 32768, "Veto on the tail, value still quantized");
+    memset(&f, 0, sizeof(f));
+    x[66] = 0.0f;
+    x[5] = -4.25f;
+    TEST(cq_quantize_input(x, q, 67, &s16, &safe, &f) == 0 && f.range_exceed,
+         "Veto inside a vector group");
+
+    cq_tensor_spec_t asym = {.scale_exp = 16, .is_symmetric = false};
+    TEST(cq_quantize_input(x, q, 67, &asym, NULL, &f) == CQ_FAULT_ASYMMETRIC_PARAMS,
+         "Asymmetric spec rejected");
+    TEST(cq_quantize_input(NULL, q, 1, &s16, NULL, &f) == CQ_ERROR_NULL_POINTER,
+         "NULL input rejected");
+
+    return 0;
+}
+
 /* ============================================================================
  * Main
  * ============================================================================ */
@@ -163,6 +407,10 @@ int main(void) {
     failed += test_symmetric();
     failed += test_bn_folding();
     failed += test_batch_convert();
+    failed += test_sparse_convert();
+    failed += test_pack_convert();
+    failed += test_compact_convert();
+    failed += test_input_quantize();
 
     printf("\n============================================\n");
     printf("Results: %d/%d passed\n", tests_passed, tests_run);
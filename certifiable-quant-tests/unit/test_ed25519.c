@@ -0,0 +1,182 @@
+/**
+ * @file test_ed25519.c
+ * @project Certifiable-Quant
+ * @brief Unit tests for Ed25519 signing and batch verification.
+ *
+ * @traceability SRS-005-CERTIFICATE, RFC 8032 §7.1 (Test Vectors)
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include "ed25519.h"
+#include <stdio.h>
+#include <string.h>
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define TEST(cond, msg) do { \
+    tests_run++; \
+    if (!(cond)) { printf("  FAIL: %s\n", msg); return 1; } \
+    else { tests_passed++; printf("  PASS: %s\n", msg); } \
+} while(0)
+
+static void from_hex(const char *hex, uint8_t *out, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        unsigned hi = (unsigned)(hex[2 * i] <= '9' ? hex[2 * i] - '0' : hex[2 * i] - 'a' + 10);
+        unsigned lo = (unsigned)(hex[2 * i + 1] <= '9' ? hex[2 * i + 1] - '0' : hex[2 * i + 1] - 'a' + 10);
+        out[i] = (uint8_t)((hi << 4) | lo);
+    }
+}
+
+/* ============================================================================
+ * Test: RFC 8032 Vectors
+ * ============================================================================ */
+
+int test_rfc8032_vectors(void) {
+    printf("\n=== Test: RFC 8032 Vectors ===\n");
+    uint8_t seed[32], pk[32], sk[64], sig[64], expected_pk[32], expected_sig[64];
+    const uint8_t msg2[1] = { 0x72 };
+
+    /* TEST 1: empty message */
+    from_hex("9d61b19deffd5a60ba844af492ec2cc44449c5697b326919703bac031cae7f60", seed, 32);
+    from_hex("d75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a", expected_pk, 32);
+    from_hex("e5564300c360ac729086e2cc806e828a84877f1eb8e5d974d873e06522490155"
+             "5fb8821590a33bacc61e39701cf9b46bd25bf5f0595bbe24655141438e7a100b", expected_sig, 64);
+
+    cq_ed25519_keypair_from_seed(seed, pk, sk);
+    TEST(memcmp(pk, expected_pk, 32) == 0, "TEST 1 public key");
+    cq_ed25519_sign(sk, NULL, 0, sig);
+    TEST(memcmp(sig, expected_sig, 64) == 0, "TEST 1 signature");
+    TEST(cq_ed25519_verify(pk, NULL, 0, sig), "TEST 1 verifies");
+
+    /* TEST 2: one-byte message */
+    from_hex("4ccd089b28ff96da9db6c346ec114e0f5b8a319f35aba624da8cf6ed4fb8a6fb", seed, 32);
+    from_hex("3d4017c3e843895a92b70aa74d1b7ebc9c982ccf2ec4968cc0cd55f12af4660c", expected_pk, 32);
+    from_hex("92a009a9f0d4cab8720e820b5f642540a2b27b5416503f8fb3762223ebdb69da"
+             "085ac1e43e15996e458f3613d0f11d8c387b2eaeb4302aeeb00d291612bb0c00", expected_sig, 64);
+
+    cq_ed25519_keypair_from_seed(seed, pk, sk);
+    TEST(memcmp(pk, expected_pk, 32) == 0, "TEST 2 public key");
+    cq_ed25519_sign(sk, msg2, 1, sig);
+    TEST(memcmp(sig, expected_sig, 64) == 0, "TEST 2 signature");
+    TEST(cq_ed25519_verify(pk, msg2, 1, sig), "TEST 2 verifies");
+
+    return 0;
+}
+
+/* ============================================================================
+ * Test: Rejection
+ * ============================================================================ */
+
+int test_rejection(void) {
+    printf("\n=== Test: Rejection ===\n");
+    uint8_t seed[32], pk[32], sk[64], sig[64], bad[64];
+    const uint8_t msg[4] = { 'C', 'Q', 'C', 'R' };
+
+    memset(seed, 0x42, sizeof(seed));
+    cq_ed25519_keypair_from_seed(seed, pk, sk);
+    cq_ed25519_sign(sk, msg, sizeof(msg), sig);
+
+    memcpy(bad, sig, 64);
+    bad[10] ^= 0x01;
+    TEST(!cq_ed25519_verify(pk, msg, sizeof(msg), bad), "corrupted R rejected");
+
+    memcpy(bad, sig, 64);
+    bad[40] ^= 0x01;
+    TEST(!cq_ed25519_verify(pk, msg, sizeof(msg), bad), "corrupted S rejected");
+
+    TEST(!cq_ed25519_verify(pk, msg, sizeof(msg) - 1, sig), "different message rejected");
+
+    /* S + L is the same scalar but non-canonical (malleability) */
+    static const uint8_t L[32] = {
+        0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58,
+        0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x10
+    };
+    memcpy(bad, sig, 64);
+    unsigned carry = 0;
+    for (int i = 0; i < 32; i++) {
+        unsigned v = (unsigned)bad[32 + i] + L[i] + carry;
+        bad[32 + i] = (uint8_t)v;
+        carry = v >> 8;
+    }
+    TEST(!cq_ed25519_verify(pk, msg, sizeof(msg), bad), "non-canonical S rejected");
+
+    return 0;
+}
+
+/* ============================================================================
+ * Test: Batch Verification
+ * ============================================================================ */
+
+#define BATCH_N 70  /* Spans three chunks */
+
+int test_batch_verification(void) {
+    printf("\n=== Test: Batch Verification ===\n");
+    static uint8_t pk[3][32], sk[3][64], sig[BATCH_N][64], msg[BATCH_N][32];
+    cq_ed25519_item_t items[BATCH_N];
+    bool results[BATCH_N];
+
+    for (int k = 0; k < 3; k++) {
+        uint8_t seed[32];
+        memset(seed, 0x10 + k, sizeof(seed));
+        cq_ed25519_keypair_from_seed(seed, pk[k], sk[k]);
+    }
+    for (int i = 0; i < BATCH_N; i++) {
+        memset(msg[i], i, sizeof(msg[i]));
+        cq_ed25519_sign(sk[i % 3], msg[i], sizeof(msg[i]), sig[i]);
+        items[i].public_key = pk[i % 3];
+        items[i].signature = sig[i];
+        items[i].message = msg[i];
+        items[i].message_len = sizeof(msg[i]);
+    }
+
+    TEST(cq_ed25519_verify_batch(items, BATCH_N, results) == BATCH_N,
+         "all valid signatures accepted");
+
+    sig[5][50] ^= 0x02;
+    sig[64][1] ^= 0x80;
+    size_t valid = cq_ed25519_verify_batch(items, BATCH_N, results);
+    TEST(valid == BATCH_N - 2, "two corrupted signatures counted");
+    TEST(!results[5] && !results[64] && results[4] && results[63],
+         "corrupted signatures located");
+
+    /* Batch agrees with single verification item by item */
+    int agree = 1;
+    for (int i = 0; i < BATCH_N; i++) {
+        if (results[i] != cq_ed25519_verify(pk[i % 3], msg[i], sizeof(msg[i]), sig[i])) {
+            agree = 0;
+        }
+    }
+    TEST(agree, "batch and single verification agree");
+
+    items[7].public_key = pk[(7 + 1) % 3];
+    cq_ed25519_verify_batch(items, BATCH_N, results);
+    TEST(!results[7], "wrong public key rejected");
+
+    TEST(cq_ed25519_verify_batch(items, 0, NULL) == 0, "empty batch");
+
+    return 0;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void) {
+    printf("============================================\n");
+    printf("Certifiable-Quant: Ed25519 Tests\n");
+    printf("============================================\n");
+
+    int failed = 0;
+    failed += test_rfc8032_vectors();
+    failed += test_rejection();
+    failed += test_batch_verification();
+
+    printf("\n============================================\n");
+    printf("Results: %d/%d passed\n", tests_passed, tests_run);
+    printf("============================================\n");
+
+    return failed ? 1 : 0;
+}
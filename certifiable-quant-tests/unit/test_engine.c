@@ -0,0 +1,1200 @@
+/**
+ * @file test_engine.c
+ * @project Certifiable-Quant
+ * @brief Unit tests for the reference inference engine
+ *
+ * @traceability CQ-MATH-001 §3.4-§3.5, §4.1-§4.2
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include "engine_fixture.h"
+#include "convert.h"
+#include "dvm.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define TEST(name) static int name(void)
+#define ASSERT(cond, msg) do { \
+    if (!(cond)) { \
+        printf("  FAIL: %s\n", msg); \
+        return 0; \
+    } \
+} while(0)
+#define RUN_TEST(test) do { \
+    printf("Running %s...\n", #test); \
+    tests_run++; \
+    if (test()) { \
+        tests_passed++; \
+        printf("  PASS\n"); \
+    } \
+} while(0)
+
+static cq_fixed16_t workspace[4096];
+
+/* ============================================================================
+ * Kernels
+ * ============================================================================ */
+
+TEST(test_engine_linear)
+{
+    cq_layer_header_t h = layer(CQ_LAYER_LINEAR, 2, 2);
+    cq_layer_shape_t sh = shape(2, 1, 1);
+    cq_layer_state_t st;
+    cq_engine_t engine;
+    cq_fault_flags_t faults;
+    int32_t *w = (int32_t *)BLOB;
+    int64_t *b = (int64_t *)(BLOB + 16);
+    cq_fixed16_t x[2] = { 3 * ONE / 2, -2 * ONE };
+    cq_fixed16_t y[2];
+
+    /* W = [[1, 2], [-0.5, 0.25]], b = [0.5, -0.25] at scale 2^32 */
+    w[0] = ONE; w[1] = 2 * ONE; w[2] = -ONE / 2; w[3] = ONE / 4;
+    b[0] = (int64_t)1 << 31;
+    b[1] = -((int64_t)1 << 30);
+    h.bias_spec.format = CQ_FORMAT_Q32_32;
+    h.bias_len = 2;
+    h.bias_offset = 16;
+
+    ASSERT(cq_engine_init(&engine, &h, &sh, &st, 1, BLOB, 32) == 0, "init");
+    ASSERT(cq_engine_workspace_size(&engine) == 0, "single layer needs no workspace");
+    ASSERT(st.macs == 4 && st.out_len == 2, "layer state");
+    ASSERT(cq_engine_run(&engine, x, y, NULL, &faults) == 0, "run");
+    ASSERT(y[0] == -2 * ONE, "1.5 - 4 + 0.5 = -2");
+    ASSERT(y[1] == -3 * ONE / 2, "-0.75 - 0.5 - 0.25 = -1.5");
+    ASSERT(st.fast_path, "fast path taken");
+    ASSERT(!faults.overflow && !faults.underflow, "no faults");
+    return 1;
+}
+
+TEST(test_engine_requantize_rne)
+{
+    cq_layer_header_t h = layer(CQ_LAYER_LINEAR, 1, 1);
+    cq_fixed16_t W[1] = { 1 };          /* 2^-16 */
+    cq_fixed16_t x[1], y[1];
+    cq_fault_flags_t faults;
+
+    cq_fault_clear(&faults);
+
+    x[0] = ONE / 2;                     /* 0.5 ULP → ties to even (0) */
+    cq_layer_linear(&h, W, NULL, x, y, false, NULL, &faults);
+    ASSERT(y[0] == 0, "0.5 rounds to 0");
+
+    x[0] = 3 * ONE / 2;                 /* 1.5 ULP → 2 */
+    cq_layer_linear(&h, W, NULL, x, y, false, NULL, &faults);
+    ASSERT(y[0] == 2, "1.5 rounds to 2");
+
+    x[0] = -5 * ONE / 2;                /* -2.5 ULP → -2 */
+    cq_layer_linear(&h, W, NULL, x, y, true, NULL, &faults);
+    ASSERT(y[0] == -2, "-2.5 rounds to -2");
+
+    ASSERT(cq_requantize(3, -2, &faults) == 12, "left shift");
+    ASSERT(!faults.overflow, "no overflow yet");
+    ASSERT(cq_requantize(INT32_MAX, -1, &faults) == INT32_MAX && faults.overflow,
+           "left shift saturates");
+    return 1;
+}
+
+TEST(test_engine_conv2d)
+{
+    cq_layer_header_t h = layer(CQ_LAYER_CONV2D, 1, 4);
+    cq_layer_shape_t sh = shape(1, 3, 3);
+    cq_fixed16_t W[4] = { ONE, ONE, ONE, ONE };
+    cq_fixed16_t x[9], y[16];
+    cq_fault_flags_t faults;
+
+    for (int i = 0; i < 9; i++) {
+        x[i] = (i + 1) * ONE;
+    }
+    sh.kernel_h = 2;
+    sh.kernel_w = 2;
+    sh.stride = 1;
+    cq_fault_clear(&faults);
+
+    cq_layer_conv2d(&h, &sh, W, NULL, x, y, false, NULL, &faults);
+    ASSERT(y[0] == 12 * ONE && y[1] == 16 * ONE, "top row");
+    ASSERT(y[2] == 24 * ONE && y[3] == 28 * ONE, "bottom row");
+
+    /* Zero padding: 4×4 output, corners see one input each */
+    sh.padding = 1;
+    cq_layer_conv2d(&h, &sh, W, NULL, x, y, true, NULL, &faults);
+    ASSERT(y[0] == 1 * ONE && y[3] == 3 * ONE, "padded top corners");
+    ASSERT(y[12] == 7 * ONE && y[15] == 9 * ONE, "padded bottom corners");
+    ASSERT(y[5] == 12 * ONE, "interior unchanged");
+    ASSERT(!faults.overflow, "no faults");
+    return 1;
+}
+
+TEST(test_engine_pool)
+{
+    cq_layer_header_t h = layer(CQ_LAYER_AVGPOOL, 0, 0);
+    cq_layer_shape_t sh = shape(1, 2, 8);
+    cq_fixed16_t x[16] = {
+        1, 1,  3, 0,  1, 1,  -1, -1,
+        1, 0,  0, 0,  0, 0,  -1, -3,
+    };
+    cq_fixed16_t y[4];
+    cq_fault_flags_t faults;
+
+    sh.kernel_h = 2;
+    sh.kernel_w = 2;
+    sh.stride = 2;
+    cq_fault_clear(&faults);
+
+    cq_layer_pool(&h, &sh, x, y, &faults, NULL);
+    ASSERT(y[0] == 1, "0.75 → 1");
+    ASSERT(y[1] == 1, "0.75 → 1");
+    ASSERT(y[2] == 0, "0.5 ties to 0");
+    ASSERT(y[3] == -2, "-1.5 ties to -2");
+
+    h.layer_type = CQ_LAYER_MAXPOOL;
+    cq_layer_pool(&h, &sh, x, y, &faults, NULL);
+    ASSERT(y[0] == 1 && y[1] == 3 && y[2] == 1 && y[3] == -1, "max pool");
+
+    /* 3×3 windows of large values: divide by 9, RNE, against / and % */
+    static cq_fixed16_t xa[9 * 9];
+    cq_fixed16_t ya[9];
+    h.layer_type = CQ_LAYER_AVGPOOL;
+    sh = shape(1, 9, 9);
+    sh.kernel_h = 3;
+    sh.kernel_w = 3;
+    sh.stride = 3;
+    for (int i = 0; i < 81; i++) xa[i] = lcg_q16(INT32_MAX / 2) * 2 + (i & 1);
+    cq_layer_pool(&h, &sh, xa, ya, &faults, NULL);
+    for (int o = 0; o < 9; o++) {
+        int64_t sum = 0;
+        for (int k = 0; k < 9; k++) {
+            sum += xa[((o / 3) * 3 + k / 3) * 9 + (o % 3) * 3 + k % 3];
+        }
+        int64_t q = sum / 9, r = sum % 9;
+        if (2 * r > 9 || (2 * r == 9 && (q & 1))) q++;
+        if (-2 * r > 9 || (-2 * r == 9 && (q & 1))) q--;
+        ASSERT(ya[o] == q, "avg pool by 9");
+    }
+    return 1;
+}
+
+TEST(test_engine_relu_rescale)
+{
+    cq_layer_header_t h = layer(CQ_LAYER_RELU, 0, 0);
+    cq_fixed16_t x[3] = { -ONE, 3, ONE };
+    cq_fixed16_t y[3];
+    cq_fault_flags_t faults;
+
+    cq_fault_clear(&faults);
+    cq_layer_relu(&h, x, y, 3, &faults, NULL);
+    ASSERT(y[0] == 0 && y[1] == 3 && y[2] == ONE, "exact relu");
+
+    h.output_spec = spec(15);           /* 3 → 1.5 → 2 */
+    cq_layer_relu(&h, x, y, 3, &faults, NULL);
+    ASSERT(y[0] == 0 && y[1] == 2 && y[2] == ONE / 2, "relu with rescale");
+
+    /* Same values through a Linear epilogue (identity weights) */
+    cq_layer_header_t lin = layer(CQ_LAYER_LINEAR, 3, 3);
+    cq_fixed16_t I[9] = { ONE, 0, 0,  0, ONE, 0,  0, 0, ONE };
+    cq_epilogue_t epi = { true, { 0, 0, 0 }, 1 };
+    cq_layer_linear(&lin, I, NULL, x, y, true, &epi, &faults);
+    ASSERT(y[0] == 0 && y[1] == 2 && y[2] == ONE / 2, "fused relu with rescale");
+    return 1;
+}
+
+TEST(test_engine_softmax)
+{
+    cq_layer_header_t h = layer(CQ_LAYER_SOFTMAX, 0, 0);
+    cq_fixed16_t x[5], y[5];
+    cq_fault_flags_t faults;
+    int64_t sum = 0;
+
+    cq_fault_clear(&faults);
+
+    for (int i = 0; i < 4; i++) {
+        x[i] = 7 * ONE;
+    }
+    cq_layer_softmax(&h, x, y, 4, &faults, NULL);
+    for (int i = 0; i < 4; i++) {
+        ASSERT(y[i] == ONE / 4, "uniform input gives 1/n");
+    }
+
+    for (int i = 0; i < 5; i++) {
+        x[i] = i * ONE / 2 - ONE;
+    }
+    cq_layer_softmax(&h, x, y, 5, &faults, NULL);
+
+    double ref_sum = 0.0;
+    for (int i = 0; i < 5; i++) {
+        ref_sum += exp((double)x[i] / ONE);
+    }
+    for (int i = 0; i < 5; i++) {
+        double ref = exp((double)x[i] / ONE) / ref_sum;
+        ASSERT(fabs((double)y[i] / ONE - ref) < 0.02, "close to float softmax");
+        ASSERT(i == 0 || y[i] > y[i - 1], "monotonic");
+        sum += y[i];
+    }
+    ASSERT(sum > ONE - 5 && sum < ONE + 5, "sums to 1");
+
+    /* Far below the max underflows to exactly 0 */
+    x[0] = -30000 * ONE;
+    x[1] = 0;
+    cq_layer_softmax(&h, x, y, 2, &faults, NULL);
+    ASSERT(y[0] == 0 && y[1] == ONE, "saturating softmax");
+    ASSERT(!faults.overflow && !faults.underflow, "no faults");
+    return 1;
+}
+
+/* ============================================================================
+ * Engine
+ * ============================================================================ */
+
+TEST(test_engine_fast_path_bit_identical)
+{
+    cq_layer_header_t h[4];
+    cq_layer_shape_t sh[4];
+    cq_layer_state_t st[4];
+    cq_engine_t engine;
+    cq_fault_flags_t faults;
+    cq_fixed16_t x[16], fast_y[10], ref_y[10];
+    size_t blob_size;
+
+    build_mlp(h, sh, &blob_size);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) == 0, "init");
+    ASSERT(cq_engine_workspace_size(&engine) == 2 * 32 * sizeof(cq_fixed16_t),
+           "ping-pong workspace");
+    ASSERT(st[0].macs == 512 && st[2].macs == 320, "MAC counts");
+
+    for (int trial = 0; trial < 50; trial++) {
+        for (int i = 0; i < 16; i++) {
+            x[i] = lcg_q16(4 * ONE);
+        }
+
+        engine.fast_path_enabled = true;
+        ASSERT(cq_engine_run(&engine, x, fast_y, workspace, &faults) == 0, "fast run");
+        ASSERT(st[0].fast_path && st[2].fast_path, "fast path taken");
+
+        engine.fast_path_enabled = false;
+        ASSERT(cq_engine_run(&engine, x, ref_y, workspace, &faults) == 0, "reference run");
+        ASSERT(!st[0].fast_path, "reference path taken");
+
+        ASSERT(memcmp(fast_y, ref_y, sizeof(ref_y)) == 0, "bit-identical outputs");
+        ASSERT(!faults.overflow && !faults.underflow, "no faults");
+    }
+    return 1;
+}
+
+TEST(test_engine_fused_relu)
+{
+    cq_layer_header_t h[4];
+    cq_layer_shape_t sh[4];
+    cq_layer_state_t st[4];
+    cq_engine_t engine;
+    cq_fault_flags_t fused_faults, plain_faults;
+    cq_fixed16_t x[16], fused_y[10], plain_y[10];
+    size_t blob_size;
+
+    build_mlp(h, sh, &blob_size);
+
+    /* ReLU also rescales 2^16 → 2^15, so the epilogue requantizes twice */
+    h[1].output_spec.scale_exp = 15;
+    h[2].input_spec.scale_exp = 15;
+    h[2].bias_spec.scale_exp = 31;
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) == 0, "init");
+
+    for (int trial = 0; trial < 20; trial++) {
+        for (int i = 0; i < 16; i++) {
+            x[i] = lcg_q16(8 * ONE);
+        }
+        /* Drive one hidden unit into saturation to compare fault flags */
+        if (trial == 0) {
+            x[0] = INT32_MAX;
+        }
+
+        engine.fusion_enabled = true;
+        ASSERT(cq_engine_run(&engine, x, fused_y, workspace, &fused_faults) == 0, "fused run");
+        ASSERT(st[0].fused && st[1].fused && !st[2].fused, "linear+relu fused");
+
+        engine.fusion_enabled = false;
+        ASSERT(cq_engine_run(&engine, x, plain_y, workspace, &plain_faults) == 0, "plain run");
+        ASSERT(!st[0].fused, "separate relu layer");
+
+        ASSERT(memcmp(fused_y, plain_y, sizeof(plain_y)) == 0, "bit-identical outputs");
+        ASSERT(fused_faults.overflow == plain_faults.overflow &&
+               fused_faults.underflow == plain_faults.underflow, "identical faults");
+    }
+    return 1;
+}
+
+TEST(test_engine_fault_aggregation)
+{
+    cq_layer_header_t h[2];
+    cq_layer_shape_t sh[2];
+    cq_layer_state_t st[2];
+    cq_engine_t engine;
+    cq_fault_flags_t faults;
+    int32_t *w = (int32_t *)BLOB;
+    cq_fixed16_t x[4], y[1];
+
+    for (int i = 0; i < 4; i++) {
+        w[i] = INT32_MAX;
+        x[i] = INT32_MAX;
+    }
+    h[0] = layer(CQ_LAYER_LINEAR, 1, 4);
+    h[1] = layer(CQ_LAYER_RELU, 0, 0);
+    sh[0] = shape(4, 1, 1);
+    sh[1] = shape(1, 1, 1);
+
+    ASSERT(cq_engine_init(&engine, h, sh, st, 2, BLOB, 16) == 0, "init");
+    ASSERT(cq_engine_run(&engine, x, y, workspace, &faults) == 0, "run");
+    ASSERT(!st[0].fast_path, "overflow proof fails, reference path");
+    ASSERT(st[0].faults.overflow, "linear layer overflowed");
+    ASSERT(!st[1].faults.overflow, "relu layer clean");
+    ASSERT(faults.overflow, "merged faults");
+    ASSERT(y[0] == INT32_MAX, "saturated output");
+
+    /* A clean input clears the per-layer faults of the previous run */
+    for (int i = 0; i < 4; i++) {
+        x[i] = 0;
+    }
+    ASSERT(cq_engine_run(&engine, x, y, workspace, &faults) == 0, "second run");
+    ASSERT(!st[0].faults.overflow && !faults.overflow, "faults cleared");
+    return 1;
+}
+
+TEST(test_engine_init_validation)
+{
+    cq_layer_header_t h[4];
+    cq_layer_shape_t sh[4];
+    cq_layer_state_t st[4];
+    cq_engine_t engine;
+    size_t blob_size;
+
+    build_mlp(h, sh, &blob_size);
+    ASSERT(cq_engine_init(NULL, h, sh, st, 4, BLOB, blob_size) == CQ_ERROR_NULL_POINTER,
+           "null engine");
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size - 4) ==
+           CQ_ERROR_DIMENSION_MISMATCH, "bias past end of blob");
+
+    h[0].bias_spec.scale_exp = 31;
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) ==
+           CQ_ERROR_DYADIC_VIOLATION, "bias exponent must be e_w + e_x");
+    h[0].bias_spec.scale_exp = 32;
+
+    h[2].input_spec.scale_exp = 15;
+    h[2].bias_spec.scale_exp = 31;
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) ==
+           CQ_ERROR_DYADIC_VIOLATION, "scale chain broken");
+    h[2].input_spec.scale_exp = 16;
+    h[2].bias_spec.scale_exp = 32;
+
+    sh[2] = shape(16, 1, 1);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) ==
+           CQ_ERROR_DIMENSION_MISMATCH, "element chain broken");
+    sh[2] = shape(32, 1, 1);
+
+    h[2].weight_spec.is_symmetric = false;
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) ==
+           CQ_FAULT_ASYMMETRIC_PARAMS, "asymmetric weights rejected");
+    h[2].weight_spec.is_symmetric = true;
+
+    h[1].layer_type = 99;
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) ==
+           CQ_ERROR_DIMENSION_MISMATCH, "unknown layer type");
+    h[1].layer_type = CQ_LAYER_RELU;
+
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) == 0, "valid again");
+    return 1;
+}
+
+/* ============================================================================
+ * Activation Planning
+ * ============================================================================ */
+
+/* Linear chain 16 → 64 → 8 → 64 → 8 → 4 */
+static void build_chain(cq_layer_header_t h[5], cq_layer_shape_t sh[5], size_t *blob_size)
+{
+    static const uint32_t dims[6] = { 16, 64, 8, 64, 8, 4 };
+    int32_t *w = (int32_t *)BLOB;
+
+    for (int l = 0; l < 5; l++) {
+        h[l] = layer(CQ_LAYER_LINEAR, dims[l + 1], dims[l]);
+        h[l].weight_offset = (uint64_t)((uint8_t *)w - BLOB);
+        sh[l] = shape(dims[l], 1, 1);
+        for (uint32_t i = 0; i < dims[l] * dims[l + 1]; i++) {
+            *w++ = lcg_q16(ONE / 8);
+        }
+    }
+    *blob_size = (size_t)((uint8_t *)w - BLOB);
+}
+
+TEST(test_engine_plan_offset_reuse)
+{
+    cq_layer_header_t h[5];
+    cq_layer_shape_t sh[5];
+    cq_layer_state_t st[5];
+    cq_activation_slot_t slots[5];
+    cq_activation_plan_t report;
+    cq_engine_t engine;
+    size_t blob_size;
+
+    build_chain(h, sh, &blob_size);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 5, BLOB, blob_size) == 0, "init");
+    ASSERT(cq_engine_plan(&engine, slots, &report) == 0, "plan");
+
+    /* Slots 0 and 2 (64) are never live together; 1 and 3 (8) sit above */
+    ASSERT(slots[0].offset == 0 && slots[2].offset == 0, "large slots share offset 0");
+    ASSERT(slots[1].offset == 64 && slots[3].offset == 64, "small slots share offset 64");
+    ASSERT(slots[4].length == 0, "last layer writes the caller's buffer");
+    ASSERT(report.arena_len == 72 && report.live_peak == 72, "peak memory");
+    ASSERT(report.naive_len == 144, "per-layer allocation");
+    ASSERT(cq_engine_workspace_size(&engine) == 72 * sizeof(cq_fixed16_t),
+           "workspace is the arena");
+
+    /* Lifetimes overlapping in time never overlap in memory */
+    for (int a = 0; a < 4; a++) {
+        for (int b = a + 1; b < 4; b++) {
+            bool live = slots[a].first_use <= slots[b].last_use &&
+                        slots[b].first_use <= slots[a].last_use;
+            bool mem = slots[a].offset < slots[b].offset + slots[b].length &&
+                       slots[b].offset < slots[a].offset + slots[a].length;
+            ASSERT(!(live && mem), "no live overlap");
+        }
+    }
+    return 1;
+}
+
+TEST(test_engine_plan_in_place)
+{
+    cq_layer_header_t h[4];
+    cq_layer_shape_t sh[4];
+    cq_layer_state_t st[4];
+    cq_activation_slot_t slots[4];
+    cq_activation_plan_t report;
+    cq_engine_t engine;
+    cq_fault_flags_t faults;
+    cq_fixed16_t x[16], planned_y[10], pingpong_y[10];
+    size_t blob_size;
+
+    build_mlp(h, sh, &blob_size);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) == 0, "init");
+
+    for (int i = 0; i < 16; i++) {
+        x[i] = lcg_q16(2 * ONE);
+    }
+    ASSERT(cq_engine_run(&engine, x, pingpong_y, workspace, &faults) == 0, "ping-pong run");
+
+    ASSERT(cq_engine_plan(&engine, slots, &report) == 0, "plan");
+    ASSERT(slots[1].in_place && slots[1].alias_of == 0, "relu runs in place");
+    ASSERT(slots[1].offset == slots[0].offset, "relu shares storage");
+    ASSERT(slots[0].last_use == 2, "lifetime extended through relu");
+    ASSERT(report.in_place_count == 1, "one in-place layer");
+    ASSERT(report.arena_len == 42 && report.naive_len == 74, "arena vs naive");
+
+    /* Poison the arena: the planned run must not read stale data */
+    memset(workspace, 0x5A, cq_engine_workspace_size(&engine));
+    ASSERT(cq_engine_run(&engine, x, planned_y, workspace, &faults) == 0, "planned run");
+    ASSERT(memcmp(planned_y, pingpong_y, sizeof(planned_y)) == 0, "same result as ping-pong");
+    return 1;
+}
+
+/* ============================================================================
+ * Batched Execution
+ * ============================================================================ */
+
+#define BATCH_SAMPLES 37
+
+TEST(test_engine_batch_matches_single)
+{
+    static cq_fixed16_t X[BATCH_SAMPLES][16];
+    static cq_fixed16_t single_y[BATCH_SAMPLES][10], batch_y[BATCH_SAMPLES][10];
+    static cq_fixed16_t batch_ws[4096];
+    static const uint32_t batch_sizes[3] = { 1, 8, 64 };
+    cq_layer_header_t h[4];
+    cq_layer_shape_t sh[4];
+    cq_layer_state_t st[4];
+    cq_activation_slot_t slots[4];
+    cq_engine_t engine;
+    cq_fault_flags_t faults;
+    size_t blob_size;
+
+    build_mlp(h, sh, &blob_size);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) == 0, "init");
+    ASSERT(engine.batch_size == CQ_ENGINE_DEFAULT_BATCH, "default batch");
+
+    for (int s = 0; s < BATCH_SAMPLES; s++) {
+        for (int i = 0; i < 16; i++) {
+            X[s][i] = lcg_q16(4 * ONE);
+        }
+        ASSERT(cq_engine_run(&engine, X[s], single_y[s], workspace, &faults) == 0,
+               "single run");
+    }
+
+    for (int k = 0; k < 3; k++) {
+        for (int planned = 0; planned < 2; planned++) {
+            ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) == 0, "re-init");
+            if (planned) {
+                ASSERT(cq_engine_plan(&engine, slots, NULL) == 0, "plan");
+            }
+            engine.batch_size = batch_sizes[k];
+            engine.tile_rows = 5;           /* Tiles that do not divide 32 */
+            ASSERT(cq_engine_batch_workspace_size(&engine) <= sizeof(batch_ws), "workspace");
+
+            memset(batch_y, 0, sizeof(batch_y));
+            ASSERT(cq_engine_run_batch(&engine, &X[0][0], &batch_y[0][0], BATCH_SAMPLES,
+                                       batch_ws, &faults) == 0, "batch run");
+            ASSERT(memcmp(batch_y, single_y, sizeof(single_y)) == 0,
+                   "bit-identical to per-sample execution");
+        }
+    }
+    return 1;
+}
+
+TEST(test_engine_linear_batch_kernel)
+{
+    cq_layer_header_t h = layer(CQ_LAYER_LINEAR, 7, 3);
+    cq_fixed16_t W[21], X[4][3], Y[4][7], ref[7];
+    cq_fault_flags_t faults;
+
+    for (int i = 0; i < 21; i++) {
+        W[i] = lcg_q16(INT32_MAX / 2);      /* Large: reference path saturates */
+    }
+    for (int b = 0; b < 4; b++) {
+        for (int i = 0; i < 3; i++) {
+            X[b][i] = lcg_q16(INT32_MAX / 2);
+        }
+    }
+
+    cq_fault_clear(&faults);
+    cq_layer_linear_batch(&h, W, NULL, &X[0][0], &Y[0][0], 4, 3, false, NULL, &faults);
+
+    for (int b = 0; b < 4; b++) {
+        cq_fault_flags_t f;
+        cq_fault_clear(&f);
+        cq_layer_linear(&h, W, NULL, X[b], ref, false, NULL, &f);
+        ASSERT(memcmp(Y[b], ref, sizeof(ref)) == 0, "sample matches");
+    }
+    return 1;
+}
+
+/* ============================================================================
+ * Sparse Weights
+ * ============================================================================ */
+
+TEST(test_engine_sparse_matches_dense)
+{
+    static uint32_t row_ptr[2][33], col_idx[2][512];
+    static cq_fixed16_t values[2][512];
+    static cq_fixed16_t X[BATCH_SAMPLES][16], dense_y[BATCH_SAMPLES][10], y[BATCH_SAMPLES][10];
+    static cq_fixed16_t batch_ws[4096];
+    cq_layer_header_t h[4];
+    cq_layer_shape_t sh[4];
+    cq_layer_state_t st[4];
+    cq_csr_q16_t csr[2];
+    cq_engine_t engine;
+    cq_fault_flags_t dense_faults, faults;
+    size_t blob_size;
+
+    build_mlp(h, sh, &blob_size);
+
+    /* Prune about 70% of both weight matrices */
+    for (uint32_t l = 0; l < 2; l++) {
+        int32_t *w = (int32_t *)(BLOB + h[2 * l].weight_offset);
+        uint32_t n = h[2 * l].weight_rows * h[2 * l].weight_cols;
+        for (uint32_t i = 0; i < n; i++) {
+            if ((lcg_q16(100) + 100) < 140) w[i] = 0;
+        }
+    }
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) == 0, "init");
+
+    for (int s = 0; s < BATCH_SAMPLES; s++) {
+        for (int i = 0; i < 16; i++) {
+            X[s][i] = lcg_q16(4 * ONE);
+        }
+    }
+    X[3][0] = INT32_MAX;                /* Overflow proof fails for this sample */
+
+    for (int fast = 0; fast < 2; fast++) {
+        engine.fast_path_enabled = (fast != 0);
+
+        cq_fault_clear(&dense_faults);
+        for (int s = 0; s < BATCH_SAMPLES; s++) {
+            ASSERT(cq_engine_run(&engine, X[s], dense_y[s], workspace, &faults) == 0, "dense");
+            cq_fault_merge(&dense_faults, &faults);
+        }
+
+        for (uint32_t l = 0; l < 2; l++) {
+            const cq_layer_header_t *hl = &h[2 * l];
+            memset(&csr[l], 0, sizeof(csr[l]));
+            csr[l].row_ptr = row_ptr[l];
+            csr[l].col_idx = col_idx[l];
+            csr[l].values = values[l];
+            csr[l].capacity = 512;
+            ASSERT(cq_csr_from_dense((const cq_fixed16_t *)(BLOB + hl->weight_offset),
+                                     hl->weight_rows, hl->weight_cols, &csr[l]) == 0, "csr");
+            ASSERT(csr[l].nnz < hl->weight_rows * hl->weight_cols / 2, "mostly zeros");
+            ASSERT(cq_engine_attach_csr(&engine, 2 * l, &csr[l]) == 0, "attach");
+            ASSERT(st[2 * l].macs == csr[l].nnz, "MACs count non-zeros");
+        }
+
+        cq_fault_clear(&faults);
+        for (int s = 0; s < BATCH_SAMPLES; s++) {
+            cq_fault_flags_t f;
+            ASSERT(cq_engine_run(&engine, X[s], y[s], workspace, &f) == 0, "sparse");
+            cq_fault_merge(&faults, &f);
+        }
+        ASSERT(memcmp(y, dense_y, sizeof(y)) == 0, "sparse bit-identical to dense");
+        ASSERT(memcmp(&faults, &dense_faults, sizeof(faults)) == 0, "same faults");
+
+        engine.batch_size = 8;
+        memset(y, 0, sizeof(y));
+        ASSERT(cq_engine_run_batch(&engine, &X[0][0], &y[0][0], BATCH_SAMPLES,
+                                   batch_ws, &faults) == 0, "sparse batch");
+        ASSERT(memcmp(y, dense_y, sizeof(y)) == 0, "sparse batch bit-identical");
+
+        ASSERT(cq_engine_attach_csr(&engine, 0, NULL) == 0 &&
+               cq_engine_attach_csr(&engine, 2, NULL) == 0, "detach");
+        ASSERT(st[0].macs == 16 * 32 && st[0].csr == NULL, "dense again");
+    }
+
+    /* Malformed or mismatched matrices are rejected */
+    ASSERT(cq_engine_attach_csr(&engine, 1, &csr[0]) == CQ_ERROR_DIMENSION_MISMATCH, "not Linear");
+    ASSERT(cq_engine_attach_csr(&engine, 2, &csr[0]) == CQ_ERROR_DIMENSION_MISMATCH, "shape");
+    if (csr[0].row_ptr[1] >= 2) {
+        uint32_t k = csr[0].row_ptr[0];
+        uint32_t tmp = col_idx[0][k];
+        col_idx[0][k] = col_idx[0][k + 1];
+        col_idx[0][k + 1] = tmp;
+        ASSERT(cq_engine_attach_csr(&engine, 0, &csr[0]) == CQ_ERROR_DIMENSION_MISMATCH,
+               "columns must ascend");
+    }
+    csr[0].max_row_nnz++;
+    ASSERT(cq_engine_attach_csr(&engine, 0, &csr[0]) == CQ_ERROR_DIMENSION_MISMATCH,
+           "inexact row bound");
+    return 1;
+}
+
+TEST(test_engine_sparse_kernel_saturation)
+{
+    static uint32_t row_ptr[8], col_idx[21];
+    static cq_fixed16_t values[21];
+    cq_layer_header_t h = layer(CQ_LAYER_LINEAR, 7, 3);
+    cq_fixed16_t W[21], x[3], y[7], ref[7];
+    cq_fault_flags_t f_dense, f_sparse;
+    cq_csr_q16_t csr;
+
+    for (int i = 0; i < 21; i++) {
+        W[i] = (i % 3 == 1) ? 0 : INT32_MAX - i;    /* Saturates, with zeros between */
+    }
+    for (int i = 0; i < 3; i++) {
+        x[i] = (i == 2) ? INT32_MIN : INT32_MAX;
+    }
+
+    memset(&csr, 0, sizeof(csr));
+    csr.row_ptr = row_ptr;
+    csr.col_idx = col_idx;
+    csr.values = values;
+    csr.capacity = 21;
+    ASSERT(cq_csr_from_dense(W, 7, 3, &csr) == 0 && csr.nnz == 14 && csr.max_row_nnz == 2, "csr");
+
+    cq_fault_clear(&f_dense);
+    cq_fault_clear(&f_sparse);
+    cq_layer_linear(&h, W, NULL, x, ref, false, NULL, &f_dense);
+    cq_layer_linear_csr(&h, &csr, NULL, x, y, false, NULL, &f_sparse);
+    ASSERT(memcmp(y, ref, sizeof(ref)) == 0, "saturating path identical");
+    ASSERT(f_dense.overflow == f_sparse.overflow && f_dense.underflow == f_sparse.underflow,
+           "same saturation faults");
+    return 1;
+}
+
+TEST(test_engine_panel_matches_row_major)
+{
+    static cq_fixed16_t X[BATCH_SAMPLES][16], ref_y[BATCH_SAMPLES][10], y[BATCH_SAMPLES][10];
+    static cq_fixed16_t batch_ws[4096];
+    cq_layer_header_t h[4], hp[4];
+    cq_layer_shape_t sh[4];
+    cq_layer_state_t st[4], stp[4];
+    cq_engine_t engine, packed;
+    cq_fault_flags_t ref_faults, faults;
+    size_t blob_size;
+
+    build_mlp(h, sh, &blob_size);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) == 0, "init");
+
+    /* Same model with both Linear layers panel-packed after the blob;
+       10 rows leave a partial last panel */
+    memcpy(hp, h, sizeof(hp));
+    size_t end = blob_size;
+    for (uint32_t l = 0; l < 4; l += 2) {
+        uint64_t count = cq_weight_layout_count(CQ_WEIGHT_LAYOUT_PANEL,
+                                                h[l].weight_rows, h[l].weight_cols);
+        end = (end + 7u) & ~(size_t)7u;
+        ASSERT(cq_pack_weights((const cq_fixed16_t *)(BLOB + h[l].weight_offset),
+                               h[l].weight_rows, h[l].weight_cols, CQ_WEIGHT_LAYOUT_PANEL,
+                               (cq_fixed16_t *)(BLOB + end)) == 0, "pack");
+        hp[l].weight_offset = end;
+        hp[l].weight_layout = CQ_WEIGHT_LAYOUT_PANEL;
+        end += (size_t)count * sizeof(cq_fixed16_t);
+    }
+    ASSERT(cq_weight_layout_count(CQ_WEIGHT_LAYOUT_PANEL, 10, 32) == 12 * 32, "padded count");
+    ASSERT(cq_engine_init(&packed, hp, sh, stp, 4, BLOB, end) == 0, "init packed");
+    ASSERT(stp[2].weight_max_mag == st[2].weight_max_mag, "same max |w|");
+
+    for (int s = 0; s < BATCH_SAMPLES; s++) {
+        for (int i = 0; i < 16; i++) {
+            X[s][i] = lcg_q16(4 * ONE);
+        }
+    }
+    X[5][1] = INT32_MIN;                /* Overflow proof fails for this sample */
+
+    cq_fault_clear(&ref_faults);
+    cq_fault_clear(&faults);
+    for (int s = 0; s < BATCH_SAMPLES; s++) {
+        cq_fault_flags_t f;
+        ASSERT(cq_engine_run(&engine, X[s], ref_y[s], workspace, &f) == 0, "row-major");
+        cq_fault_merge(&ref_faults, &f);
+        ASSERT(cq_engine_run(&packed, X[s], y[s], workspace, &f) == 0, "panel");
+        cq_fault_merge(&faults, &f);
+    }
+    ASSERT(memcmp(y, ref_y, sizeof(y)) == 0, "panel bit-identical to row-major");
+    ASSERT(memcmp(&faults, &ref_faults, sizeof(faults)) == 0, "same faults");
+
+    /* Batched with tiles that do not divide into panels (rounded up) */
+    packed.tile_rows = 3;
+    memset(y, 0, sizeof(y));
+    ASSERT(cq_engine_run_batch(&packed, &X[0][0], &y[0][0], BATCH_SAMPLES,
+                               batch_ws, &faults) == 0, "panel batch");
+    ASSERT(memcmp(y, ref_y, sizeof(y)) == 0, "panel batch bit-identical");
+
+    /* Row ranges that cut panels run the strided single-row path */
+    cq_fixed16_t hidden[32], ref_hidden[32];
+    cq_fault_flags_t f_ref, f_panel;
+    cq_fault_clear(&f_ref);
+    cq_fault_clear(&f_panel);
+    memset(hidden, 0, sizeof(hidden));
+    memset(ref_hidden, 0, sizeof(ref_hidden));
+    cq_layer_linear_rows(&h[0], (const cq_fixed16_t *)(BLOB + h[0].weight_offset),
+                         BLOB + h[0].bias_offset, X[5], ref_hidden, 3, 29, false, NULL, &f_ref);
+    cq_layer_linear_panel_rows(&hp[0], (const cq_fixed16_t *)(BLOB + hp[0].weight_offset),
+                               BLOB + hp[0].bias_offset, X[5], hidden, 3, 29, false, NULL,
+                               &f_panel);
+    ASSERT(memcmp(hidden, ref_hidden, sizeof(hidden)) == 0, "partial panels identical");
+    ASSERT(memcmp(&f_panel, &f_ref, sizeof(f_ref)) == 0, "partial panel faults");
+
+    /* Panels are a Linear layout; unknown layouts are rejected */
+    hp[0].weight_layout = 7;
+    ASSERT(cq_engine_init(&packed, hp, sh, stp, 4, BLOB, end) == CQ_ERROR_DIMENSION_MISMATCH,
+           "unknown layout");
+    return 1;
+}
+
+TEST(test_engine_int16_matches_int32)
+{
+    static cq_fixed16_t X[BATCH_SAMPLES][16], ref_y[BATCH_SAMPLES][10], y[BATCH_SAMPLES][10];
+    static cq_fixed16_t batch_ws[4096];
+    cq_layer_header_t h[4], hc[4];
+    cq_layer_shape_t sh[4];
+    cq_layer_state_t st[4], stc[4];
+    cq_engine_t engine, compact;
+    cq_fault_flags_t ref_faults, faults;
+    size_t blob_size;
+
+    build_mlp(h, sh, &blob_size);
+
+    /* |w| ≤ 2^-1 can reach 2^15: pull the extreme into int16 range */
+    cq_fixed16_t *w1 = (cq_fixed16_t *)(BLOB + h[0].weight_offset);
+    for (int i = 0; i < 16 * 32; i++) {
+        w1[i] = (w1[i] > INT16_MAX) ? INT16_MAX : w1[i];
+    }
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) == 0, "init");
+
+    /* Same model with both Linear layers narrowed after the blob */
+    memcpy(hc, h, sizeof(hc));
+    size_t end = blob_size;
+    for (uint32_t l = 0; l < 4; l += 2) {
+        size_t count = (size_t)h[l].weight_rows * h[l].weight_cols;
+        ASSERT(cq_weights_fit_int16((const cq_fixed16_t *)(BLOB + h[l].weight_offset), count),
+               "fits int16");
+        ASSERT(cq_narrow_weights((const cq_fixed16_t *)(BLOB + h[l].weight_offset), count,
+                                 (int16_t *)(BLOB + end)) == 0, "narrow");
+        hc[l].weight_offset = end;
+        hc[l].weight_spec.storage = CQ_STORAGE_INT16;
+        end += count * sizeof(int16_t);
+    }
+    ASSERT(cq_engine_init(&compact, hc, sh, stc, 4, BLOB, end) == 0, "init int16");
+    ASSERT(stc[0].weight_max_mag == st[0].weight_max_mag &&
+           stc[2].weight_max_mag == st[2].weight_max_mag, "same max |w|");
+
+    for (int s = 0; s < BATCH_SAMPLES; s++) {
+        for (int i = 0; i < 16; i++) {
+            X[s][i] = lcg_q16(4 * ONE);
+        }
+    }
+    X[5][1] = INT32_MIN;                /* Saturating path for this sample */
+
+    cq_fault_clear(&ref_faults);
+    cq_fault_clear(&faults);
+    for (int s = 0; s < BATCH_SAMPLES; s++) {
+        cq_fault_flags_t f;
+        ASSERT(cq_engine_run(&engine, X[s], ref_y[s], workspace, &f) == 0, "int32");
+        cq_fault_merge(&ref_faults, &f);
+        ASSERT(cq_engine_run(&compact, X[s], y[s], workspace, &f) == 0, "int16");
+        cq_fault_merge(&faults, &f);
+    }
+    ASSERT(memcmp(y, ref_y, sizeof(y)) == 0, "int16 bit-identical to int32");
+    ASSERT(memcmp(&faults, &ref_faults, sizeof(faults)) == 0, "same faults");
+
+    compact.tile_rows = 3;
+    memset(y, 0, sizeof(y));
+    ASSERT(cq_engine_run_batch(&compact, &X[0][0], &y[0][0], BATCH_SAMPLES,
+                               batch_ws, &faults) == 0, "int16 batch");
+    ASSERT(memcmp(y, ref_y, sizeof(y)) == 0, "int16 batch bit-identical");
+
+    /* Conv2D widens per tap, padded and unpadded, both accumulation paths */
+    cq_layer_header_t ch = layer(CQ_LAYER_CONV2D, 2, 8);
+    cq_layer_shape_t csh = shape(2, 3, 3);
+    cq_fixed16_t W32[16], x[18], y32[32], y16[32];
+    int16_t W16[16];
+    cq_fault_flags_t f32, f16;
+
+    for (int i = 0; i < 16; i++) {
+        W32[i] = lcg_q16(INT16_MAX);
+        W16[i] = (int16_t)W32[i];
+    }
+    for (int i = 0; i < 18; i++) {
+        x[i] = lcg_q16(8 * ONE);
+    }
+    csh.kernel_h = 2;
+    csh.kernel_w = 2;
+    csh.stride = 1;
+    for (uint32_t pad = 0; pad < 2; pad++) {
+        csh.padding = pad;
+        for (int fast = 0; fast < 2; fast++) {
+            cq_layer_header_t ch16 = ch;
+            ch16.weight_spec.storage = CQ_STORAGE_INT16;
+            memset(y32, 0, sizeof(y32));
+            memset(y16, 0, sizeof(y16));
+            cq_fault_clear(&f32);
+            cq_fault_clear(&f16);
+            cq_layer_conv2d(&ch, &csh, W32, NULL, x, y32, fast != 0, NULL, &f32);
+            cq_layer_conv2d(&ch16, &csh, W16, NULL, x, y16, fast != 0, NULL, &f16);
+            ASSERT(memcmp(y16, y32, sizeof(y32)) == 0, "conv int16 identical");
+            ASSERT(memcmp(&f16, &f32, sizeof(f32)) == 0, "conv int16 faults");
+        }
+    }
+
+    /* Panels are int32 only; unknown storages are rejected */
+    hc[0].weight_layout = CQ_WEIGHT_LAYOUT_PANEL;
+    ASSERT(cq_engine_init(&compact, hc, sh, stc, 4, BLOB, end) == CQ_ERROR_DIMENSION_MISMATCH,
+           "int16 panel");
+    hc[0].weight_layout = CQ_WEIGHT_LAYOUT_ROW_MAJOR;
+    hc[0].weight_spec.storage = 9;
+    ASSERT(cq_engine_init(&compact, hc, sh, stc, 4, BLOB, end) == CQ_ERROR_DIMENSION_MISMATCH,
+           "unknown storage");
+    return 1;
+}
+
+/* Linear(2→40) → ReLU; rows 4k saturate high and rows 4k+1 low */
+static void build_saturating(cq_layer_header_t h[2], cq_layer_shape_t sh[2], size_t *blob_size)
+{
+    int32_t *w = (int32_t *)BLOB;
+
+    for (int r = 0; r < 40; r++) {
+        const int32_t big = (r % 4 == 0) ? 30000 * ONE : (r % 4 == 1) ? -30000 * ONE : ONE / 4;
+        w[2 * r] = big;
+        w[2 * r + 1] = big;
+    }
+    h[0] = layer(CQ_LAYER_LINEAR, 40, 2);
+    h[1] = layer(CQ_LAYER_RELU, 0, 0);
+    sh[0] = shape(2, 1, 1);
+    sh[1] = shape(40, 1, 1);
+    *blob_size = 80 * sizeof(int32_t);
+}
+
+TEST(test_engine_fault_counts)
+{
+    static cq_fixed16_t X[5][2], Y[5][40], ref[5][40];
+    static cq_fixed16_t batch_ws[4096];
+    cq_layer_header_t h[2];
+    cq_layer_shape_t sh[2];
+    cq_layer_state_t st[2];
+    cq_engine_t engine;
+    cq_fault_counts_t counts[2];
+    cq_fault_flags_t ref_faults, faults;
+    size_t blob_size;
+
+    build_saturating(h, sh, &blob_size);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 2, BLOB, blob_size) == 0, "init");
+    ASSERT(engine.fault_counts == NULL, "bits only by default");
+
+    for (int s = 0; s < 5; s++) {
+        X[s][0] = 30000 * ONE;
+        X[s][1] = (s + 1) * ONE;
+        ASSERT(cq_engine_run(&engine, X[s], ref[s], workspace, &ref_faults) == 0, "bits run");
+    }
+    ASSERT(ref_faults.overflow && ref_faults.underflow, "sticky bits");
+
+    /* Each saturating output counts once per kind and per sample */
+    cq_fault_counts_clear(&counts[0]);
+    cq_fault_counts_clear(&counts[1]);
+    engine.fault_counts = counts;
+    for (int s = 0; s < 5; s++) {
+        ASSERT(cq_engine_run(&engine, X[s], Y[s], workspace, &faults) == 0, "counted run");
+    }
+    ASSERT(memcmp(Y, ref, sizeof(Y)) == 0, "counting leaves outputs unchanged");
+    ASSERT(memcmp(&faults, &ref_faults, sizeof(faults)) == 0, "same sticky bits");
+    ASSERT(counts[0].count[0] == 10 * 5 && counts[0].count[1] == 10 * 5, "per-output counts");
+    ASSERT(counts[0].count[2] == 0 && counts[1].count[0] == 0 && counts[1].count[1] == 0,
+           "fused ReLU counts under the Linear layer");
+
+    /* Per-worker sinks over a batch sum to the same totals */
+    cq_pool_t pool;
+    cq_pool_opts_t opts;
+    memset(&opts, 0, sizeof(opts));
+    opts.threads = 3;
+    ASSERT(cq_pool_init(&pool, &opts) == 0, "pool");
+    engine.pool = &pool;
+    engine.batch_size = 4;
+    engine.tile_rows = 4;
+    cq_fault_counts_clear(&counts[0]);
+    ASSERT(cq_engine_run_batch(&engine, &X[0][0], &Y[0][0], 5, batch_ws, &faults) == 0,
+           "counted batch");
+    engine.pool = NULL;
+    cq_pool_destroy(&pool);
+    ASSERT(memcmp(Y, ref, sizeof(Y)) == 0, "batch outputs unchanged");
+    ASSERT(counts[0].count[0] == 50 && counts[0].count[1] == 50, "thread-independent totals");
+
+    /* Sinks accumulate; unfused ReLU at shift 0 raises nothing */
+    engine.fusion_enabled = false;
+    ASSERT(cq_engine_run(&engine, X[0], Y[0], workspace, &faults) == 0, "unfused");
+    ASSERT(counts[0].count[0] == 60 && counts[1].count[0] == 0, "accumulated");
+
+    /* Whole and cut panels count per lane */
+    uint64_t n = cq_weight_layout_count(CQ_WEIGHT_LAYOUT_PANEL, 40, 2);
+    ASSERT(cq_pack_weights((const cq_fixed16_t *)BLOB, 40, 2, CQ_WEIGHT_LAYOUT_PANEL,
+                           (cq_fixed16_t *)(BLOB + blob_size)) == 0, "pack");
+    h[0].weight_offset = blob_size;
+    h[0].weight_layout = CQ_WEIGHT_LAYOUT_PANEL;
+    ASSERT(cq_engine_init(&engine, h, sh, st, 2, BLOB,
+                          blob_size + (size_t)n * sizeof(cq_fixed16_t)) == 0, "init panel");
+    cq_fault_counts_t lanes;
+    cq_epilogue_t epi;
+    memset(&epi, 0, sizeof(epi));
+    epi.counts = &lanes;
+    cq_fault_counts_clear(&lanes);
+    cq_fault_clear(&faults);
+    cq_layer_linear_panel_rows(&h[0], (const cq_fixed16_t *)(BLOB + blob_size), NULL,
+                               X[0], Y[0], 1, 40, false, &epi, &faults);
+    ASSERT(lanes.count[0] == 9 && lanes.count[1] == 10, "panel rows 1..39");
+    return 1;
+}
+
+TEST(test_engine_split_k)
+{
+    static uint64_t big[(3000 * 10 * 4 + 10 * 4) / 8 + 1];
+    static cq_fixed16_t X[3][3000], ref[3][10], Y[3][10];
+    static cq_fixed16_t xc[4096], rc[8], yc[8];
+    static cq_fixed16_t batch_ws[4096];
+    uint8_t *blob = (uint8_t *)big;
+    int32_t *w = (int32_t *)blob;
+    int32_t *bias = w + 3000 * 10;
+    cq_layer_header_t h[2];
+    cq_layer_shape_t sh[2];
+    cq_layer_state_t st[2];
+    cq_engine_t engine;
+    cq_fault_flags_t ref_faults, faults;
+    cq_pool_t pool;
+    cq_pool_opts_t opts;
+
+    /* Classifier head: Linear(3000→10) + ReLU, huge fan-in, few outputs */
+    for (int i = 0; i < 3000 * 10; i++) {
+        w[i] = lcg_q16(ONE);
+    }
+    for (int r = 0; r < 10; r++) {
+        bias[r] = lcg_q16(ONE) * 3;
+    }
+    for (int s = 0; s < 3; s++) {
+        for (int c = 0; c < 3000; c++) {
+            X[s][c] = lcg_q16(ONE);
+        }
+    }
+    h[0] = layer(CQ_LAYER_LINEAR, 10, 3000);
+    h[0].bias_spec.scale_exp = 32;
+    h[0].bias_len = 10;
+    h[0].bias_offset = 3000 * 10 * 4;
+    h[1] = layer(CQ_LAYER_RELU, 0, 0);
+    sh[0] = shape(3000, 1, 1);
+    sh[1] = shape(10, 1, 1);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 2, blob, sizeof(big)) == 0, "init");
+
+    for (int s = 0; s < 3; s++) {
+        ASSERT(cq_engine_run(&engine, X[s], ref[s], workspace, &ref_faults) == 0, "serial");
+    }
+    ASSERT(!st[0].split_k && st[0].fast_path, "no pool: rows only");
+
+    memset(&opts, 0, sizeof(opts));
+    opts.threads = 3;
+    ASSERT(cq_pool_init(&pool, &opts) == 0, "pool");
+    engine.pool = &pool;
+
+    /* 10 rows fill one item of 16: split the 3000 inputs instead */
+    for (int s = 0; s < 3; s++) {
+        ASSERT(cq_engine_run(&engine, X[s], Y[s], workspace, &faults) == 0, "split-K");
+    }
+    ASSERT(st[0].split_k && st[0].fast_path && !st[1].split_k, "split-K taken");
+    ASSERT(memcmp(Y, ref, sizeof(Y)) == 0, "split-K bit-identical");
+    ASSERT(memcmp(&faults, &ref_faults, sizeof(faults)) == 0, "same faults");
+
+    /* Batched: one weight tile holds all 10 rows, so it splits too */
+    memset(Y, 0, sizeof(Y));
+    engine.batch_size = 2;
+    ASSERT(cq_engine_run_batch(&engine, &X[0][0], &Y[0][0], 3, batch_ws, &faults) == 0,
+           "batch");
+    ASSERT(st[0].split_k && memcmp(Y, ref, sizeof(Y)) == 0, "batched split-K");
+    engine.split_k_enabled = false;
+    ASSERT(cq_engine_run(&engine, X[1], Y[1], workspace, &faults) == 0, "disabled");
+    ASSERT(!st[0].split_k && memcmp(Y[1], ref[1], sizeof(Y[1])) == 0, "row partition");
+    engine.split_k_enabled = true;
+
+    /* Proof fails: fall back to rows with saturating accumulation */
+    w[5] = 30000 * ONE;
+    X[0][5] = 30000 * ONE;
+    ASSERT(cq_engine_init(&engine, h, sh, st, 2, blob, sizeof(big)) == 0, "re-init");
+    ASSERT(cq_engine_run(&engine, X[0], ref[0], workspace, &ref_faults) == 0, "serial unsafe");
+    engine.pool = &pool;
+    ASSERT(cq_engine_run(&engine, X[0], Y[0], workspace, &faults) == 0, "pool unsafe");
+    ASSERT(!st[0].split_k && !st[0].fast_path, "fallback");
+    ASSERT(memcmp(Y[0], ref[0], sizeof(Y[0])) == 0, "fallback bit-identical");
+    ASSERT(memcmp(&faults, &ref_faults, sizeof(faults)) == 0, "fallback faults");
+
+    /* Conv2D 256×4×4 → 2×2×2: slices of whole input channels */
+    int32_t *wc = (int32_t *)blob;
+    for (int i = 0; i < 2 * 2304; i++) {
+        wc[i] = lcg_q16(ONE);
+    }
+    for (int i = 0; i < 4096; i++) {
+        xc[i] = lcg_q16(ONE);
+    }
+    h[0] = layer(CQ_LAYER_CONV2D, 2, 2304);
+    sh[0] = shape(256, 4, 4);
+    sh[0].kernel_h = 3;
+    sh[0].kernel_w = 3;
+    sh[0].stride = 1;
+    ASSERT(cq_engine_init(&engine, h, sh, st, 1, blob, sizeof(big)) == 0, "init conv");
+    ASSERT(cq_engine_run(&engine, xc, rc, NULL, &ref_faults) == 0, "serial conv");
+    engine.pool = &pool;
+    ASSERT(cq_engine_run(&engine, xc, yc, NULL, &faults) == 0, "split-K conv");
+    engine.pool = NULL;
+    cq_pool_destroy(&pool);
+    ASSERT(st[0].split_k, "conv split-K taken");
+    ASSERT(memcmp(yc, rc, sizeof(yc)) == 0, "conv bit-identical");
+    return 1;
+}
+
+TEST(test_engine_wide_accumulator)
+{
+    static cq_fixed16_t xc[4 * 36], rc[3 * 16], yc[3 * 16];
+    cq_layer_header_t h = layer(CQ_LAYER_LINEAR, 1, 5);
+    cq_layer_shape_t sh = shape(5, 1, 1);
+    cq_layer_state_t st;
+    cq_engine_t engine;
+    cq_fault_flags_t faults;
+    int32_t *w = (int32_t *)BLOB;
+    const int32_t A = 30000 * ONE;
+    cq_fixed16_t x[5] = { A, A, A, A, A };
+    cq_fixed16_t y[1];
+
+    /* Σ = A²·(3 − 2) fits, but the partial sum A²·3 exceeds int64 */
+    w[0] = A; w[1] = A; w[2] = A; w[3] = -A; w[4] = -A;
+    h.output_spec = spec(-16);
+    ASSERT(cq_engine_init(&engine, &h, &sh, &st, 1, BLOB, 5 * 4) == 0, "init");
+    ASSERT(!engine.wide_acc_enabled, "off by default");
+
+    ASSERT(cq_engine_run(&engine, x, y, NULL, &faults) == 0, "saturating run");
+    ASSERT(!st.fast_path && !st.wide_acc, "reference path");
+    ASSERT(faults.overflow && y[0] != 13733, "partial sum saturated");
+
+    /* A² / 2^48 = 13732.9 → 13733 */
+    engine.wide_acc_enabled = true;
+    ASSERT(cq_engine_run(&engine, x, y, NULL, &faults) == 0, "wide run");
+    ASSERT(st.wide_acc && !st.fast_path, "wide path taken");
+    ASSERT(y[0] == 13733, "exact result");
+    ASSERT(!faults.overflow, "no overflow");
+
+    /* Where the 64-bit proof holds the wide kernels equal the fast ones */
+    cq_overflow_proof_t proof;
+    cq_fixed16_t ref[8], out[8];
+    int32_t *wr = (int32_t *)BLOB;
+    int64_t *b = (int64_t *)(BLOB + 8 * 40 * 4);
+    cq_fixed16_t xr[40];
+    h = layer(CQ_LAYER_LINEAR, 8, 40);
+    h.bias_len = 8;
+    for (int i = 0; i < 8 * 40; i++) wr[i] = lcg_q16(4 * ONE);
+    for (int i = 0; i < 8; i++) b[i] = (int64_t)lcg_q16(ONE) * ONE;
+    for (int i = 0; i < 40; i++) xr[i] = lcg_q16(4 * ONE);
+    proof.dot_product_len = 40;
+    proof.max_weight_mag = 4 * ONE;
+    proof.max_input_mag = 4 * ONE;
+    ASSERT(cq_acc128_chunk_len(&proof) == 40, "chunk covers the row");
+
+    cq_fault_clear(&faults);
+    cq_layer_linear_rows(&h, wr, b, xr, ref, 0, 8, true, NULL, &faults);
+    cq_layer_linear_rows_wide(&h, wr, b, xr, out, 0, 8, 40, NULL, &faults);
+    ASSERT(memcmp(out, ref, sizeof(ref)) == 0, "linear, one chunk");
+    cq_layer_linear_rows_wide(&h, wr, b, xr, out, 0, 8, 1, NULL, &faults);
+    ASSERT(memcmp(out, ref, sizeof(ref)) == 0, "linear, chunk 1");
+
+    /* Conv2D 4×6×6 → 3×4×4, 3×3 kernel */
+    int32_t *wc = (int32_t *)BLOB;
+    h = layer(CQ_LAYER_CONV2D, 3, 36);
+    sh = shape(4, 6, 6);
+    sh.kernel_h = 3;
+    sh.kernel_w = 3;
+    sh.stride = 1;
+    for (int i = 0; i < 3 * 36; i++) wc[i] = lcg_q16(2 * ONE);
+    for (int i = 0; i < 4 * 36; i++) xc[i] = lcg_q16(2 * ONE);
+    cq_layer_conv2d_channels(&h, &sh, wc, NULL, xc, rc, 0, 3, true, NULL, &faults);
+    cq_layer_conv2d_channels_wide(&h, &sh, wc, NULL, xc, yc, 0, 3, 36, NULL, &faults);
+    ASSERT(memcmp(yc, rc, sizeof(rc)) == 0, "conv, one chunk");
+    cq_layer_conv2d_channels_wide(&h, &sh, wc, NULL, xc, yc, 0, 3, 5, NULL, &faults);
+    ASSERT(memcmp(yc, rc, sizeof(rc)) == 0, "conv, chunk 5");
+    ASSERT(!faults.overflow, "no faults");
+    return 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("=== Certifiable-Quant Engine Tests ===\n\n");
+
+    RUN_TEST(test_engine_linear);
+    RUN_TEST(test_engine_requantize_rne);
+    RUN_TEST(test_engine_conv2d);
+    RUN_TEST(test_engine_pool);
+    RUN_TEST(test_engine_relu_rescale);
+    RUN_TEST(test_engine_softmax);
+    RUN_TEST(test_engine_fast_path_bit_identical);
+    RUN_TEST(test_engine_fused_relu);
+    RUN_TEST(test_engine_fault_aggregation);
+    RUN_TEST(test_engine_init_validation);
+    RUN_TEST(test_engine_plan_offset_reuse);
+    RUN_TEST(test_engine_plan_in_place);
+    RUN_TEST(test_engine_batch_matches_single);
+    RUN_TEST(test_engine_linear_batch_kernel);
+    RUN_TEST(test_engine_sparse_matches_dense);
+    RUN_TEST(test_engine_sparse_kernel_saturation);
+    RUN_TEST(test_engine_panel_matches_row_major);
+    RUN_TEST(test_engine_int16_matches_int32);
+    RUN_TEST(test_engine_fault_counts);
+    RUN_TEST(test_engine_split_k);
+    RUN_TEST(test_engine_wide_accumulator);
+
+    printf("\n=== Results: %d/%d tests passed ===\n", tests_passed, tests_run);
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
@@ -0,0 +1,317 @@
+/**
+ * @file test_pipeline.c
+ * @project Certifiable-Quant
+ * @brief Unit tests for layer-pipelined streaming inference
+ *
+ * @traceability CQ-MATH-001 §6, CQ-STRUCT-001 §5.3
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#define ENGINE_FIXTURE_BLOB_WORDS   16384
+
+#include "pipeline.h"
+#include "engine_fixture.h"
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define TEST(name) static int name(void)
+#define ASSERT(cond, msg) do { \
+    if (!(cond)) { \
+        printf("  FAIL: %s\n", msg); \
+        return 0; \
+    } \
+} while(0)
+#define RUN_TEST(test) do { \
+    printf("Running %s...\n", #test); \
+    tests_run++; \
+    if (test()) { \
+        tests_passed++; \
+        printf("  PASS\n"); \
+    } \
+} while(0)
+
+#define SAMPLES     64
+
+/* ============================================================================
+ * SPSC Queue
+ * ============================================================================ */
+
+#define QUEUE_ITEMS 200000u
+
+static void *produce(void *arg)
+{
+    cq_spsc_queue_t *q = (cq_spsc_queue_t *)arg;
+
+    for (uint32_t i = 0; i < QUEUE_ITEMS; ) {
+        if (cq_spsc_push(q, i)) {
+            i++;
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+TEST(test_spsc_bounds)
+{
+    cq_spsc_queue_t q;
+    uint32_t v;
+
+    ASSERT(cq_spsc_init(&q, 3) == CQ_ERROR_DIMENSION_MISMATCH, "capacity must be a power of two");
+    ASSERT(cq_spsc_init(&q, 2 * CQ_SPSC_MAX_DEPTH) == CQ_ERROR_DIMENSION_MISMATCH, "capacity limit");
+    ASSERT(cq_spsc_init(&q, 4) == 0, "init");
+
+    ASSERT(!cq_spsc_pop(&q, &v), "empty");
+    for (uint32_t i = 0; i < 4; i++) {
+        ASSERT(cq_spsc_push(&q, 10 + i), "push");
+    }
+    ASSERT(!cq_spsc_push(&q, 99), "full at capacity");
+    ASSERT(cq_spsc_pop(&q, &v) && v == 10, "FIFO");
+    ASSERT(cq_spsc_push(&q, 14), "slot reused");
+    for (uint32_t i = 1; i < 5; i++) {
+        ASSERT(cq_spsc_pop(&q, &v) && v == 10 + i, "FIFO across wrap");
+    }
+    ASSERT(!cq_spsc_pop(&q, &v), "empty again");
+
+    cq_spsc_destroy(&q);
+    return 1;
+}
+
+TEST(test_spsc_two_threads)
+{
+    static cq_spsc_queue_t q;
+    pthread_t producer;
+    uint32_t expect = 0;
+
+    ASSERT(cq_spsc_init(&q, 8) == 0, "init");
+    ASSERT(pthread_create(&producer, NULL, produce, &q) == 0, "thread");
+
+    while (expect < QUEUE_ITEMS) {
+        uint32_t v;
+        if (cq_spsc_pop(&q, &v)) {
+            if (v != expect) {
+                break;
+            }
+            expect++;
+        } else {
+            sched_yield();
+        }
+    }
+    pthread_join(producer, NULL);
+    cq_spsc_destroy(&q);
+
+    ASSERT(expect == QUEUE_ITEMS, "every item once, in order");
+    return 1;
+}
+
+/* ============================================================================
+ * Model
+ * ============================================================================ */
+
+/*
+ * MLP 32 → 64 → ReLU → 64 → ReLU → 64 → ReLU → 16 → Softmax
+ * Unit costs (MACs + outputs): 2176, 4224, 4224, 1040, 16
+ */
+#define MLP_LAYERS  8
+
+static void build_deep_mlp(cq_layer_header_t h[MLP_LAYERS], cq_layer_shape_t sh[MLP_LAYERS], size_t *size)
+{
+    static const uint32_t dims[5] = { 32, 64, 64, 64, 16 };
+    int32_t *w = (int32_t *)BLOB;
+    size_t n = 0;
+    uint32_t l = 0;
+
+    lcg_state = 4242u;                  /* Same weights on every call */
+    for (uint32_t k = 0; k < 4; k++) {
+        uint32_t rows = dims[k + 1];
+        uint32_t cols = dims[k];
+
+        h[l] = layer_at(CQ_LAYER_LINEAR, rows, cols, n * 4);
+        sh[l++] = shape(cols, 1, 1);
+        for (uint32_t i = 0; i < rows * cols; i++) {
+            w[n++] = lcg_q16(ONE / 4);
+        }
+
+        h[l] = layer((k < 3) ? CQ_LAYER_RELU : CQ_LAYER_SOFTMAX, 0, 0);
+        sh[l++] = shape(rows, 1, 1);
+    }
+    *size = n * 4;
+}
+
+/* ============================================================================
+ * Stage Planning
+ * ============================================================================ */
+
+TEST(test_pipeline_plan_balance)
+{
+    cq_layer_header_t h[MLP_LAYERS];
+    cq_layer_shape_t sh[MLP_LAYERS];
+    cq_layer_state_t st[MLP_LAYERS];
+    cq_pipeline_stage_t stages[CQ_PIPELINE_MAX_STAGES];
+    cq_engine_t engine;
+    uint32_t count;
+    size_t size;
+
+    build_deep_mlp(h, sh, &size);
+    ASSERT(cq_engine_init(&engine, h, sh, st, MLP_LAYERS, BLOB, size) == 0, "init");
+
+    ASSERT(cq_pipeline_plan(&engine, 0, stages, &count) == CQ_ERROR_DIMENSION_MISMATCH,
+           "zero stages rejected");
+
+    ASSERT(cq_pipeline_plan(&engine, 1, stages, &count) == 0 && count == 1, "one stage");
+    ASSERT(stages[0].first_layer == 0 && stages[0].end_layer == MLP_LAYERS, "whole model");
+
+    /* Two stages: 6400 | 5280 beats any split with a lighter first stage */
+    ASSERT(cq_pipeline_plan(&engine, 2, stages, &count) == 0 && count == 2, "two stages");
+    ASSERT(stages[0].end_layer == 4 && stages[1].first_layer == 4, "split after two units");
+    ASSERT(stages[0].cost == 2176 + 4224, "stage cost = MACs + outputs");
+    ASSERT(stages[1].in_len == 64 && stages[1].out_len == 16, "stage geometry");
+
+    /* Three stages: bottleneck 5280 = the last three units together */
+    ASSERT(cq_pipeline_plan(&engine, 3, stages, &count) == 0 && count == 3, "three stages");
+    ASSERT(stages[0].cost == 2176 && stages[1].cost == 4224 && stages[2].cost == 5280,
+           "balanced costs");
+
+    /* The bottleneck cannot drop below the costliest fused unit; stages
+       beyond that point would add handoffs without raising throughput */
+    ASSERT(cq_pipeline_plan(&engine, CQ_PIPELINE_MAX_STAGES, stages, &count) == 0, "many");
+    ASSERT(count == 4, "stops at the minimal bottleneck");
+    for (uint32_t s = 0; s < count; s++) {
+        ASSERT(stages[s].cost <= 4224, "bottleneck is the costliest unit");
+        ASSERT(h[stages[s].first_layer].layer_type != CQ_LAYER_RELU, "ReLU stays with its Linear");
+        ASSERT(s == 0 || stages[s].first_layer == stages[s - 1].end_layer, "contiguous");
+    }
+    ASSERT(stages[count - 1].end_layer == MLP_LAYERS, "all layers covered");
+
+    /* Without fusion a ReLU may start a stage: the bottleneck becomes the
+       Linear alone (4096 + 64) */
+    engine.fusion_enabled = false;
+    ASSERT(cq_pipeline_plan(&engine, CQ_PIPELINE_MAX_STAGES, stages, &count) == 0, "unfused");
+    for (uint32_t s = 0; s < count; s++) {
+        ASSERT(stages[s].cost <= 4160, "unfused bottleneck");
+    }
+    return 1;
+}
+
+/* ============================================================================
+ * Streaming
+ * ============================================================================ */
+
+static cq_fixed16_t inputs[SAMPLES][32];
+static cq_fixed16_t expect[SAMPLES][16];
+static cq_fixed16_t got[SAMPLES][16];
+static cq_fixed16_t ws[65536];
+
+TEST(test_pipeline_bit_identical)
+{
+    cq_layer_header_t h[MLP_LAYERS];
+    cq_layer_shape_t sh[MLP_LAYERS];
+    cq_layer_state_t st[MLP_LAYERS];
+    cq_engine_t engine;
+    cq_pipeline_t pipe;
+    cq_fault_flags_t ref_faults, faults, merged;
+    size_t size;
+
+    build_deep_mlp(h, sh, &size);
+    ASSERT(cq_engine_init(&engine, h, sh, st, MLP_LAYERS, BLOB, size) == 0, "init");
+
+    for (int s = 0; s < SAMPLES; s++) {
+        for (int i = 0; i < 32; i++) {
+            inputs[s][i] = lcg_q16(4 * ONE);
+        }
+    }
+    inputs[7][3] = INT32_MAX;           /* Saturation fault in one sample */
+
+    cq_fault_clear(&ref_faults);
+    for (int s = 0; s < SAMPLES; s++) {
+        ASSERT(cq_engine_run(&engine, inputs[s], expect[s], ws, &faults) == 0, "reference");
+        cq_fault_merge(&ref_faults, &faults);
+    }
+
+    static const uint32_t want[3][2] = { { 1, 1 }, { 3, 3 }, { 5, 4 } };
+    for (int k = 0; k < 3; k++) {
+        ASSERT(cq_pipeline_init(&pipe, &engine, want[k][0], 2) == 0, "pipeline init");
+        ASSERT(pipe.stage_count == want[k][1], "stage count");
+        ASSERT(cq_pipeline_workspace_size(&pipe) <= sizeof(ws), "workspace");
+        ASSERT(cq_pipeline_start(&pipe, ws) == 0, "start");
+        ASSERT(cq_pipeline_start(&pipe, ws) == CQ_ERROR_DIMENSION_MISMATCH, "double start");
+
+        for (int rep = 0; rep < 3; rep++) {
+            memset(got, 0, sizeof(got));
+            ASSERT(cq_pipeline_run(&pipe, &inputs[0][0], &got[0][0], SAMPLES, &merged) == 0,
+                   "run");
+            ASSERT(memcmp(got, expect, sizeof(got)) == 0, "bit-identical to cq_engine_run");
+            ASSERT(merged.overflow == ref_faults.overflow &&
+                   merged.underflow == ref_faults.underflow, "same faults");
+        }
+
+        cq_pipeline_stop(&pipe);
+    }
+    return 1;
+}
+
+TEST(test_pipeline_streaming_push_pop)
+{
+    cq_layer_header_t h[MLP_LAYERS];
+    cq_layer_shape_t sh[MLP_LAYERS];
+    cq_layer_state_t st[MLP_LAYERS];
+    cq_engine_t engine;
+    cq_pipeline_t pipe;
+    cq_fixed16_t out[16];
+    size_t size;
+    int in = 0, done = 0;
+
+    build_deep_mlp(h, sh, &size);
+    ASSERT(cq_engine_init(&engine, h, sh, st, MLP_LAYERS, BLOB, size) == 0, "init");
+    ASSERT(cq_pipeline_init(&pipe, &engine, 3, 1) == 0, "init");
+    ASSERT(!cq_pipeline_try_push(&pipe, inputs[0]), "not started");
+    ASSERT(cq_pipeline_start(&pipe, ws) == 0, "start");
+
+    /* Sensor-style: one sample in, then collect whatever is ready */
+    while (done < SAMPLES) {
+        if (in < SAMPLES && cq_pipeline_try_push(&pipe, inputs[in])) {
+            in++;
+        }
+        if (cq_pipeline_try_pop(&pipe, out)) {
+            ASSERT(memcmp(out, expect[done], sizeof(out)) == 0, "in order, identical");
+            done++;
+        } else {
+            sched_yield();
+        }
+    }
+    ASSERT(pipe.pushed == SAMPLES && pipe.popped == SAMPLES, "counters");
+
+    /* Stop with samples in flight must not hang */
+    ASSERT(cq_pipeline_try_push(&pipe, inputs[0]), "push before stop");
+    cq_pipeline_stop(&pipe);
+    ASSERT(!cq_pipeline_try_pop(&pipe, out), "stopped");
+    return 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("=== Certifiable-Quant Pipeline Tests ===\n\n");
+
+    RUN_TEST(test_spsc_bounds);
+    RUN_TEST(test_spsc_two_threads);
+    RUN_TEST(test_pipeline_plan_balance);
+    RUN_TEST(test_pipeline_bit_identical);
+    RUN_TEST(test_pipeline_streaming_push_pop);
+
+    printf("\n=== Results: %d/%d tests passed ===\n", tests_passed, tests_run);
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
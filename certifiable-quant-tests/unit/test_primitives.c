@@ -118,6 +118,187 @@ int test_saturation(void) {
     return 0;
 }
 
+/* ============================================================================
+ * Test: 128-bit Accumulator
+ * ============================================================================ */
+
+int test_wide_accumulator(void) {
+    printf("\n=== Test: 128-bit Accumulator ===\n");
+    cq_fault_flags_t f = {0}, g = {0};
+    cq_overflow_proof_t p;
+    cq_accum128_t acc;
+    const int32_t big = 30000 * CQ_Q16_ONE;
+    uint32_t state = 1u;
+    bool same = true;
+
+    memset(&p, 0, sizeof(p));
+    p.max_weight_mag = 0x80000000u;
+    p.max_input_mag = 0x80000000u;
+    p.dot_product_len = 0xFFFFFFFFu;
+    TEST(!cq_overflow_is_safe(&p) && cq_overflow_is_safe128(&p),
+         "Largest header fan-in safe below 2^127");
+    TEST(cq_acc128_chunk_len(&p) == 1, "|w|·|x| = 2^62: one product per int64 part");
+    p.max_weight_mag = 1000;
+    p.max_input_mag = 1000;
+    p.dot_product_len = 64;
+    TEST(cq_acc128_chunk_len(&p) == 64, "Chunk capped at the fan-in");
+
+    /* int64-range values requantize exactly as cq_requantize() */
+    for (int i = 0; i < 2000 && same; i++) {
+        state = state * 1664525u + 1013904223u;
+        int64_t v = ((int64_t)(int32_t)state * (int64_t)(int32_t)(state * 2654435761u)) >> (i % 24);
+        int32_t shift = (int32_t)(i % 70) - 8;
+        cq_fault_clear(&f);
+        cq_fault_clear(&g);
+        cq_acc128_set(&acc, v);
+        same = cq_requantize128(&acc, shift, &f) == cq_requantize(v, shift, &g) &&
+               memcmp(&f, &g, sizeof(f)) == 0;
+    }
+    TEST(same, "Narrow values bit-identical to cq_requantize()");
+
+    /* 3A² − 2A² = A² exactly, where saturating int64 loses it */
+    cq_fault_clear(&f);
+    cq_acc128_set(&acc, 0);
+    cq_mac128_q16(&acc, big, big);
+    cq_mac128_q16(&acc, big, big);
+    cq_mac128_q16(&acc, big, big);
+    TEST(acc.hi == 0 && acc.lo > (uint64_t)INT64_MAX, "Sum passes 2^63");
+    cq_mac128_q16(&acc, -big, big);
+    cq_mac128_q16(&acc, -big, big);
+    /* A² / 2^48 = 30000² / 2^16 = 13732.9 */
+    TEST(cq_requantize128(&acc, 48, &f) == 13733 && !f.overflow, "Exact A² after cancellation");
+
+    /* Wide values: RNE ties to even on either sign, saturation at the end */
+    cq_fault_clear(&f);
+    acc.hi = 1;
+    acc.lo = (uint64_t)1 << 63;                 /* 1.5 · 2^64 */
+    TEST(cq_requantize128(&acc, 65, &f) == 1, "0.75 rounds to 1");
+    TEST(cq_requantize128(&acc, 64, &f) == 2, "1.5 ties to 2");
+    acc.hi = 2;
+    acc.lo = (uint64_t)1 << 63;                 /* 2.5 · 2^64 */
+    TEST(cq_requantize128(&acc, 64, &f) == 2, "2.5 ties to 2");
+    acc.hi = ~acc.hi;
+    acc.lo = ~acc.lo + 1u;                      /* −2.5 · 2^64 */
+    TEST(cq_requantize128(&acc, 64, &f) == -2, "-2.5 ties to -2");
+    TEST(!f.overflow && !f.underflow, "No faults in range");
+    TEST(cq_requantize128(&acc, 16, &f) == INT32_MIN && f.underflow, "Saturates low");
+    cq_acc128_add64(&acc, INT64_MAX);
+    cq_acc128_add64(&acc, INT64_MAX);
+    cq_acc128_add64(&acc, INT64_MAX);
+    cq_acc128_add64(&acc, INT64_MAX);
+    cq_acc128_add64(&acc, INT64_MAX);
+    cq_acc128_add64(&acc, INT64_MAX);
+    cq_acc128_add64(&acc, INT64_MAX);
+    cq_acc128_add64(&acc, INT64_MAX);
+    /* −5·2^63 + 8·(2^63 − 1) = 2^64 + 2^63 − 8 */
+    TEST(acc.hi == 1 && acc.lo == ((uint64_t)1 << 63) - 8u, "Carries propagate through zero");
+    TEST(cq_requantize128(&acc, 0, &f) == INT32_MAX && f.overflow, "Saturates high");
+
+#ifdef __SIZEOF_INT128__
+    /* Cross-check wide values against native 128-bit division */
+    __extension__ typedef __int128 i128;
+    same = true;
+    for (int i = 0; i < 5000 && same; i++) {
+        state = state * 1664525u + 1013904223u;
+        const uint64_t r0 = ((uint64_t)state << 32) ^ (state * 2654435761u);
+        const int32_t shift = 1 + (int32_t)(state % 100u);
+        const i128 v = ((i128)(int64_t)r0 * (i128)(int32_t)(state >> 3)) * 4;
+        i128 q = v / ((i128)1 << shift);
+        i128 rem = v % ((i128)1 << shift);
+        const i128 half = (i128)1 << (shift - 1);
+        int64_t expect;
+
+        if (rem > half || (rem == half && (q & 1))) {
+            q += 1;
+        } else if (rem < -half || (rem == -half && (q & 1))) {
+            q -= 1;
+        }
+        expect = (q > INT32_MAX) ? INT32_MAX : (q < INT32_MIN) ? INT32_MIN : (int64_t)q;
+        acc.lo = (uint64_t)v;
+        acc.hi = (uint64_t)(v >> 64);
+        same = (cq_requantize128(&acc, shift, &f) == expect);
+    }
+    TEST(same, "Wide values match native __int128 RNE");
+#endif
+
+    return 0;
+}
+
+/* ============================================================================
+ * Test: Division by an Invariant (CQ-MATH-001 §3.3)
+ * ============================================================================ */
+
+int test_invariant_divisor(void) {
+    printf("\n=== Test: Invariant Divisor ===\n");
+    static const int32_t divisors[] = {
+        1, -1, 2, -2, 3, 7, -7, CQ_Q16_ONE, -CQ_Q16_ONE, 3 * CQ_Q16_ONE,
+        CQ_Q16_ONE + 1, 1000003, INT32_MAX, -INT32_MAX, INT32_MIN, 0
+    };
+    static const int32_t edges[] = {
+        0, 1, -1, 2, -3, CQ_Q16_ONE, -CQ_Q16_ONE, INT32_MAX, INT32_MIN, INT32_MIN + 1
+    };
+    cq_fixed16_t a[64], y[64];
+    cq_divisor_t d;
+    uint32_t state = 7u;
+    bool same = true;
+    bool faults_same = true;
+
+    /* Exact unsigned quotient and remainder, including near 2^64 */
+    for (int i = 0; i < 20000 && same; i++) {
+        state = state * 1664525u + 1013904223u;
+        const uint64_t n = ((uint64_t)state << 32) ^ (state * 2654435761u);
+        const uint64_t den = (i & 1) ? (uint64_t)(state >> (i % 31)) + 1u : n / 3u + 1u;
+        uint64_t rem;
+        cq_divisor_init(&d, (int64_t)(den >> 1));
+        if (d.mag == 0u) continue;
+        same = (cq_divu64(n, &d, &rem) == n / d.mag) && rem == n % d.mag;
+        same = same && cq_divu64(UINT64_MAX, &d, &rem) == UINT64_MAX / d.mag;
+    }
+    TEST(same, "cq_divu64 matches / and %");
+
+    /* Every divisor against random and edge numerators */
+    for (size_t k = 0; k < sizeof(divisors) / sizeof(divisors[0]); k++) {
+        cq_divisor_init(&d, divisors[k]);
+        for (int i = 0; i < 4000; i++) {
+            cq_fault_flags_t f = {0}, g = {0};
+            int32_t x;
+            state = state * 1664525u + 1013904223u;
+            x = (i < 10) ? edges[i] : (int32_t)state >> (state % 24u);
+            same = same && cq_div_q16_inv(x, &d, &f) == cq_div_q16(x, divisors[k], &g);
+            faults_same = faults_same && memcmp(&f, &g, sizeof(f)) == 0;
+        }
+    }
+    TEST(same, "cq_div_q16_inv is bit-identical to cq_div_q16");
+    TEST(faults_same, "Same fault flags, div_zero included");
+
+    /* Ties: |rem| == ⌊|b|/2⌋, and a zero quotient with a negative remainder */
+    cq_divisor_init(&d, 3);
+    TEST(cq_div_q16_inv(-1, &d, NULL) == cq_div_q16(-1, 3, NULL), "Odd-divisor tie rule");
+    cq_divisor_init(&d, 4 * CQ_Q16_ONE);
+    TEST(cq_div_q16_inv(-3, &d, NULL) == cq_div_q16(-3, 4 * CQ_Q16_ONE, NULL),
+         "Zero quotient rounding direction");
+
+    /* Array form, in place */
+    cq_divisor_init(&d, -5 * CQ_Q16_ONE / 3);
+    for (int i = 0; i < 64; i++) {
+        state = state * 1664525u + 1013904223u;
+        a[i] = (int32_t)state >> 4;
+    }
+    memcpy(y, a, sizeof(y));
+    cq_div_q16_array(y, &d, y, 64, NULL);
+    for (int i = 0; i < 64; i++) {
+        same = same && y[i] == cq_div_q16(a[i], -5 * CQ_Q16_ONE / 3, NULL);
+    }
+    TEST(same, "cq_div_q16_array matches element-wise");
+
+    cq_fault_flags_t f = {0};
+    cq_divisor_init(&d, 0);
+    cq_div_q16_array(a, &d, y, 64, &f);
+    TEST(f.div_zero && y[0] == 0 && y[63] == 0, "Zero divisor: zeros and div_zero");
+
+    return 0;
+}
+
 /* ============================================================================
  * Main
  * ============================================================================ */
@@ -132,6 +313,8 @@ int main(void) {
     failed += test_overflow_safety();
     failed += test_multiplication();
     failed += test_saturation();
+    failed += test_wide_accumulator();
+    failed += test_invariant_divisor();
 
     printf("\n============================================\n");
     printf("Results: %d/%d passed\n", tests_passed, tests_run);
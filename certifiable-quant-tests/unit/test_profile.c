@@ -0,0 +1,219 @@
+/**
+ * @file test_profile.c
+ * @project Certifiable-Quant
+ * @brief Unit tests for the per-layer profiler
+ *
+ * @traceability CQ-MATH-001 §6
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include "engine_fixture.h"
+#include "profile.h"
+#include <stdio.h>
+#include <string.h>
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define TEST(name) static int name(void)
+#define ASSERT(cond, msg) do { \
+    if (!(cond)) { \
+        printf("  FAIL: %s\n", msg); \
+        return 0; \
+    } \
+} while(0)
+#define RUN_TEST(test) do { \
+    printf("Running %s...\n", #test); \
+    tests_run++; \
+    if (test()) { \
+        tests_passed++; \
+        printf("  PASS\n"); \
+    } \
+} while(0)
+
+#define RUNS    5
+
+static cq_fixed16_t workspace[4096];
+
+/* ============================================================================
+ * Helpers
+ * ============================================================================ */
+
+/* Occurrences of needle in haystack */
+static int count_of(const char *haystack, const char *needle)
+{
+    int n = 0;
+    for (const char *p = strstr(haystack, needle); p != NULL; p = strstr(p + 1, needle)) {
+        n++;
+    }
+    return n;
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+TEST(test_profile_totals)
+{
+    cq_layer_header_t h[4];
+    cq_layer_shape_t sh[4];
+    cq_layer_state_t st[4];
+    cq_engine_t engine;
+    cq_layer_profile_t layers[4];
+    cq_profile_event_t events[8];
+    cq_profile_t prof;
+    cq_fault_flags_t faults;
+    cq_fixed16_t x[16], y[10], ref[10];
+    size_t blob_size;
+
+    build_mlp(h, sh, &blob_size);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) == 0, "init");
+    ASSERT(engine.profile == NULL, "disabled by default");
+    ASSERT(cq_profile_init(&prof, layers, 4, events, 8) == 0, "profile init");
+    ASSERT(cq_profile_init(&prof, layers, 4, NULL, 8) == CQ_ERROR_NULL_POINTER, "events NULL");
+    ASSERT(cq_profile_init(&prof, layers, 0, events, 8) == CQ_ERROR_DIMENSION_MISMATCH,
+           "no layers");
+    ASSERT(cq_profile_init(&prof, layers, 4, events, 8) == 0, "profile init");
+
+    for (int i = 0; i < 16; i++) {
+        x[i] = lcg_q16(2 * ONE);
+    }
+    ASSERT(cq_engine_run(&engine, x, ref, workspace, &faults) == 0, "unprofiled run");
+
+    engine.profile = &prof;
+    for (int r = 0; r < RUNS; r++) {
+        ASSERT(cq_engine_run(&engine, x, y, workspace, &faults) == 0, "profiled run");
+        ASSERT(memcmp(y, ref, sizeof(y)) == 0, "profiling leaves outputs unchanged");
+    }
+
+    /* The ReLU runs fused into layer 0 and is recorded there */
+    ASSERT(layers[0].runs == RUNS && layers[1].runs == 0, "fused ReLU under Linear");
+    ASSERT(layers[2].runs == RUNS && layers[3].runs == RUNS, "one record per execution");
+    ASSERT(layers[0].macs == (uint64_t)RUNS * 16 * 32, "Linear 0 MACs");
+    ASSERT(layers[2].macs == (uint64_t)RUNS * 32 * 10 && layers[3].macs == 0, "MACs");
+    ASSERT(layers[0].samples == RUNS, "samples");
+
+    /* Weights + int32 bias + input + output, 4 bytes each */
+    ASSERT(layers[0].bytes == (uint64_t)RUNS * 4 * (16 * 32 + 32 + 16 + 32), "Linear 0 bytes");
+    ASSERT(layers[3].bytes == (uint64_t)RUNS * 4 * (10 + 10), "Softmax bytes");
+#if CQ_PROFILE_HAS_CYCLES
+    ASSERT(layers[0].cycles + layers[2].cycles + layers[3].cycles > 0, "counter ticks");
+#endif
+
+    /* 3 events per run; the buffer keeps the first 8 */
+    ASSERT(prof.event_count == 8 && prof.events_dropped == 3 * RUNS - 8, "event buffer");
+    ASSERT(events[0].layer == 0 && events[0].fused && events[1].layer == 2 &&
+           !events[1].fused && events[2].layer == 3, "event order");
+    for (uint32_t e = 1; e < prof.event_count; e++) {
+        ASSERT(events[e].start_ns >= events[e - 1].start_ns + events[e - 1].wall_ns,
+               "events do not overlap");
+    }
+
+    /* Run layers (pipeline stages) are not profiled */
+    cq_profile_reset(&prof);
+    ASSERT(cq_engine_run_layers(&engine, 0, 4, x, y, workspace) == 0, "run layers");
+    ASSERT(prof.event_count == 0 && layers[0].runs == 0, "range runs unprofiled");
+    return 1;
+}
+
+TEST(test_profile_batch)
+{
+    static cq_fixed16_t X[12][16], Y[12][10];
+    static cq_fixed16_t batch_ws[8192];
+    cq_layer_header_t h[4];
+    cq_layer_shape_t sh[4];
+    cq_layer_state_t st[4];
+    cq_engine_t engine;
+    cq_layer_profile_t layers[4];
+    cq_profile_t prof;
+    cq_fault_flags_t faults;
+    size_t blob_size;
+
+    build_mlp(h, sh, &blob_size);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) == 0, "init");
+    ASSERT(cq_profile_init(&prof, layers, 4, NULL, 0) == 0, "totals only");
+    engine.profile = &prof;
+    engine.batch_size = 8;
+
+    for (int s = 0; s < 12; s++) {
+        for (int i = 0; i < 16; i++) {
+            X[s][i] = lcg_q16(ONE);
+        }
+    }
+    ASSERT(cq_engine_run_batch(&engine, &X[0][0], &Y[0][0], 12, batch_ws, &faults) == 0,
+           "batch");
+
+    /* Batches of 8 and 4; weights are counted once per batch */
+    ASSERT(layers[2].runs == 2 && layers[2].samples == 12, "batch runs");
+    ASSERT(layers[2].macs == 12u * 32 * 10, "batch MACs");
+    ASSERT(layers[2].bytes == 2u * 4 * (32 * 10 + 10) + 12u * 4 * (32 + 10), "batch bytes");
+    ASSERT(prof.event_count == 0 && prof.events_dropped == 6, "no event buffer");
+
+    ASSERT(cq_profile_gops(1000, 0) == 0.0, "no time, no rate");
+    ASSERT(cq_profile_gops(1000, 2000) == 1.0, "2 ops per MAC per ns");
+    return 1;
+}
+
+TEST(test_profile_chrome_trace)
+{
+    cq_layer_header_t h[4];
+    cq_layer_shape_t sh[4];
+    cq_layer_state_t st[4];
+    cq_engine_t engine;
+    cq_layer_profile_t layers[4];
+    cq_profile_event_t events[16];
+    cq_profile_t prof;
+    cq_fault_flags_t faults;
+    cq_fixed16_t x[16], y[10];
+    static char json[8192];
+    size_t blob_size;
+
+    build_mlp(h, sh, &blob_size);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 4, BLOB, blob_size) == 0, "init");
+    ASSERT(cq_profile_init(&prof, layers, 4, events, 16) == 0, "profile init");
+    engine.profile = &prof;
+    memset(x, 0, sizeof(x));
+    for (int r = 0; r < 2; r++) {
+        ASSERT(cq_engine_run(&engine, x, y, workspace, &faults) == 0, "run");
+    }
+
+    FILE *f = tmpfile();
+    ASSERT(f != NULL, "tmpfile");
+    ASSERT(cq_profile_write_trace(&prof, h, f) == 0, "write trace");
+    rewind(f);
+    size_t n = fread(json, 1, sizeof(json) - 1, f);
+    fclose(f);
+    json[n] = '\0';
+
+    ASSERT(strncmp(json, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 39) == 0, "header");
+    ASSERT(count_of(json, "\"ph\":\"X\"") == 6, "one complete event per execution");
+    ASSERT(count_of(json, "\"name\":\"L0 Linear+ReLU\"") == 2, "fused layer name");
+    ASSERT(count_of(json, "\"name\":\"L3 Softmax\"") == 2, "softmax name");
+    ASSERT(count_of(json, "\"macs\":320,") == 2, "MAC argument");
+    ASSERT(count_of(json, "{") == count_of(json, "}"), "balanced objects");
+    ASSERT(count_of(json, "},\n") == 5 && strstr(json, "}}\n]}\n") != NULL, "separators");
+
+    ASSERT(cq_profile_write_trace(NULL, h, stdout) == CQ_ERROR_NULL_POINTER, "NULL profile");
+    return 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("=== Certifiable-Quant Profiler Tests ===\n\n");
+    lcg_state = 777u;
+
+    RUN_TEST(test_profile_totals);
+    RUN_TEST(test_profile_batch);
+    RUN_TEST(test_profile_chrome_trace);
+
+    printf("\n=== Results: %d/%d tests passed ===\n", tests_passed, tests_run);
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
@@ -0,0 +1,309 @@
+/**
+ * @file test_thread_pool.c
+ * @project Certifiable-Quant
+ * @brief Unit tests for the deterministic thread pool and its users
+ *
+ * @traceability CQ-MATH-001 §6
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#define ENGINE_FIXTURE_BLOB_WORDS   8192
+
+#include "thread_pool.h"
+#include "calibrate.h"
+#include "convert.h"
+#include "engine_fixture.h"
+#include "verify.h"
+#include <stdio.h>
+#include <string.h>
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define TEST(name) static int name(void)
+#define ASSERT(cond, msg) do { \
+    if (!(cond)) { \
+        printf("  FAIL: %s\n", msg); \
+        return 0; \
+    } \
+} while(0)
+#define RUN_TEST(test) do { \
+    printf("Running %s...\n", #test); \
+    tests_run++; \
+    if (test()) { \
+        tests_passed++; \
+        printf("  PASS\n"); \
+    } \
+} while(0)
+
+#define RANGE_N     1000
+#define RANGE_GRAIN 7
+
+static const uint32_t thread_counts[4] = { 1, 2, 4, 8 };
+
+/* ============================================================================
+ * Partitioning
+ * ============================================================================ */
+
+typedef struct {
+    uint32_t visits[RANGE_N];
+    size_t chunk_end[RANGE_N];      /* Indexed by chunk begin */
+    uint32_t chunk_worker[RANGE_N]; /* Indexed by chunk begin */
+} range_job_t;
+
+static uint32_t max_worker(const range_job_t *job)
+{
+    uint32_t m = 0;
+    for (int i = 0; i < RANGE_N; i++) {
+        m = (job->chunk_worker[i] > m) ? job->chunk_worker[i] : m;
+    }
+    return m;
+}
+
+static void mark_chunk(void *ctx, size_t begin, size_t end, uint32_t worker)
+{
+    range_job_t *job = (range_job_t *)ctx;
+
+    for (size_t i = begin; i < end; i++) {
+        job->visits[i]++;
+    }
+    job->chunk_end[begin] = end;
+    job->chunk_worker[begin] = worker;
+}
+
+TEST(test_pool_partition_independent_of_threads)
+{
+    static range_job_t serial, job;
+    cq_pool_t pool;
+
+    memset(&serial, 0, sizeof(serial));
+    cq_pool_run(NULL, RANGE_N, RANGE_GRAIN, mark_chunk, &serial);
+
+    for (int k = 0; k < 4; k++) {
+        cq_pool_opts_t opts;
+        memset(&opts, 0, sizeof(opts));
+        opts.threads = thread_counts[k];
+        ASSERT(cq_pool_init(&pool, &opts) == 0, "init");
+        ASSERT(cq_pool_threads(&pool) == thread_counts[k], "thread count");
+
+        for (int rep = 0; rep < 20; rep++) {
+            memset(&job, 0, sizeof(job));
+            cq_pool_run(&pool, RANGE_N, RANGE_GRAIN, mark_chunk, &job);
+
+            for (int i = 0; i < RANGE_N; i++) {
+                ASSERT(job.visits[i] == 1, "every item exactly once");
+            }
+            ASSERT(memcmp(job.chunk_end, serial.chunk_end, sizeof(serial.chunk_end)) == 0,
+                   "same chunk boundaries");
+            ASSERT(max_worker(&job) < thread_counts[k], "worker index in range");
+        }
+        cq_pool_destroy(&pool);
+    }
+    return 1;
+}
+
+TEST(test_pool_single_thread_and_pinning)
+{
+    static range_job_t job;
+    cq_pool_t pool;
+    cq_pool_opts_t opts;
+
+    memset(&opts, 0, sizeof(opts));
+    opts.threads = 1;
+    ASSERT(cq_pool_init(&pool, &opts) == 0, "init single");
+    ASSERT(pool.started == 0, "no worker threads in single-threaded mode");
+    memset(&job, 0, sizeof(job));
+    cq_pool_run(&pool, RANGE_N, RANGE_GRAIN, mark_chunk, &job);
+    ASSERT(max_worker(&job) == 0 && job.visits[RANGE_N - 1] == 1, "runs on the caller");
+    cq_pool_destroy(&pool);
+
+    /* Pinning may be refused by the host; the pool still works */
+    opts.threads = 3;
+    opts.pin = true;
+    ASSERT(cq_pool_init(&pool, &opts) == 0, "init pinned");
+    memset(&job, 0, sizeof(job));
+    cq_pool_run(&pool, RANGE_N, RANGE_GRAIN, mark_chunk, &job);
+    ASSERT(job.visits[0] == 1 && job.visits[RANGE_N - 1] == 1, "pinned pool runs");
+    cq_pool_destroy(&pool);
+
+    cq_pool_run(NULL, 0, 4, mark_chunk, &job);      /* Empty range is a no-op */
+    return 1;
+}
+
+/* ============================================================================
+ * Engine
+ * ============================================================================ */
+
+/* Square k×k window, stride 1, same padding for k > 1 */
+static cq_layer_shape_t window(uint32_t c, uint32_t h, uint32_t w, uint32_t k)
+{
+    cq_layer_shape_t s = shape(c, h, w);
+    s.kernel_h = k;
+    s.kernel_w = k;
+    s.stride = 1;
+    s.padding = (k > 1) ? 1u : 0u;
+    return s;
+}
+
+/* Conv(2→6, 3×3) → ReLU → MaxPool(2) → Linear(96→40) → ReLU → Linear(40→5) */
+static void build_cnn(cq_layer_header_t h[6], cq_layer_shape_t sh[6], size_t *size)
+{
+    int32_t *w = (int32_t *)BLOB;
+    size_t n = 0;
+
+    h[0] = layer(CQ_LAYER_CONV2D, 6, 18);
+    sh[0] = window(2, 8, 8, 3);
+    for (int i = 0; i < 6 * 18; i++) w[n++] = lcg_q16(ONE / 2);
+
+    h[1] = layer(CQ_LAYER_RELU, 0, 0);
+    sh[1] = window(6, 8, 8, 0);
+
+    h[2] = layer(CQ_LAYER_MAXPOOL, 0, 0);
+    sh[2] = window(6, 8, 8, 2);
+    sh[2].stride = 2;
+    sh[2].padding = 0;
+
+    h[3] = layer_at(CQ_LAYER_LINEAR, 40, 96, n * 4);
+    sh[3] = window(96, 1, 1, 0);
+    for (int i = 0; i < 40 * 96; i++) w[n++] = lcg_q16(ONE / 8);
+
+    h[4] = layer(CQ_LAYER_RELU, 0, 0);
+    sh[4] = window(40, 1, 1, 0);
+
+    h[5] = layer_at(CQ_LAYER_LINEAR, 5, 40, n * 4);
+    sh[5] = window(40, 1, 1, 0);
+    for (int i = 0; i < 5 * 40; i++) w[n++] = lcg_q16(ONE / 4);
+
+    *size = n * 4;
+}
+
+TEST(test_pool_engine_bit_identical)
+{
+    static cq_fixed16_t X[16][128], ref[16][5], out[16][5];
+    static cq_fixed16_t ws[65536];
+    cq_layer_header_t h[6];
+    cq_layer_shape_t sh[6];
+    cq_layer_state_t st[6];
+    cq_engine_t engine;
+    cq_fault_flags_t ref_faults, faults;
+    cq_pool_t pool;
+    size_t size;
+
+    build_cnn(h, sh, &size);
+    ASSERT(cq_engine_init(&engine, h, sh, st, 6, BLOB, size) == 0, "init");
+
+    for (int s = 0; s < 16; s++) {
+        for (int i = 0; i < 128; i++) {
+            X[s][i] = lcg_q16(2 * ONE);
+        }
+        X[s][0] = INT32_MAX;        /* Saturates in the reference path */
+    }
+
+    for (int s = 0; s < 16; s++) {
+        ASSERT(cq_engine_run(&engine, X[s], ref[s], ws, &ref_faults) == 0, "serial run");
+    }
+
+    for (int k = 1; k < 4; k++) {
+        cq_pool_opts_t opts;
+        memset(&opts, 0, sizeof(opts));
+        opts.threads = thread_counts[k];
+        ASSERT(cq_pool_init(&pool, &opts) == 0, "pool");
+        engine.pool = &pool;
+
+        for (int s = 0; s < 16; s++) {
+            ASSERT(cq_engine_run(&engine, X[s], out[s], ws, &faults) == 0, "pooled run");
+        }
+        ASSERT(memcmp(out, ref, sizeof(ref)) == 0, "pooled single-sample identical");
+        ASSERT(faults.overflow == ref_faults.overflow, "same faults");
+
+        engine.batch_size = 5;
+        engine.tile_rows = 3;
+        ASSERT(cq_engine_batch_workspace_size(&engine) <= sizeof(ws), "workspace");
+        ASSERT(cq_engine_run_batch(&engine, &X[0][0], &out[0][0], 16, ws, &faults) == 0,
+               "pooled batch");
+        ASSERT(memcmp(out, ref, sizeof(ref)) == 0, "pooled batch identical");
+
+        engine.pool = NULL;
+        cq_pool_destroy(&pool);
+    }
+    return 1;
+}
+
+/* ============================================================================
+ * Conversion, Calibration, Verification
+ * ============================================================================ */
+
+#define CONV_N  20000
+
+TEST(test_pool_convert_calibrate_verify)
+{
+    static float w[CONV_N];
+    static cq_fixed16_t ref_q[CONV_N], q[CONV_N];
+    cq_tensor_spec_t s = spec(16);
+    cq_fault_flags_t ref_faults, faults;
+    cq_pool_t pool;
+    cq_pool_opts_t opts;
+
+    for (int i = 0; i < CONV_N; i++) {
+        w[i] = (float)lcg_q16(1 << 20) / 1024.0f;
+    }
+    w[12345] = 1.0e9f;                  /* Overflows Q16.16 */
+
+    cq_fault_clear(&ref_faults);
+    cq_fault_clear(&faults);
+    ASSERT(cq_convert_weights(w, ref_q, CONV_N, &s, &ref_faults) == 0, "serial convert");
+
+    memset(&opts, 0, sizeof(opts));
+    opts.threads = 4;
+    ASSERT(cq_pool_init(&pool, &opts) == 0, "pool");
+
+    ASSERT(cq_convert_weights_parallel(&pool, w, q, CONV_N, &s, &faults) == 0,
+           "parallel convert");
+    ASSERT(memcmp(q, ref_q, sizeof(q)) == 0, "identical conversion");
+    ASSERT(faults.overflow && ref_faults.overflow, "overflow reported");
+
+    /* Calibration: three tensors, one task each */
+    cq_tensor_stats_t ref_stats[3], stats[3];
+    const float *tensors[3] = { w, w + 5000, w + 15000 };
+    const size_t lens[3] = { 5000, 10000, 5000 };
+    for (uint32_t t = 0; t < 3; t++) {
+        cq_tensor_stats_init(&ref_stats[t], t, t, -1.0f, 1.0f);
+        cq_tensor_stats_init(&stats[t], t, t, -1.0f, 1.0f);
+        cq_tensor_stats_update(&ref_stats[t], tensors[t], lens[t]);
+    }
+    cq_tensor_stats_update_parallel(&pool, stats, tensors, lens, 3);
+    ASSERT(memcmp(stats, ref_stats, sizeof(stats)) == 0, "identical calibration stats");
+
+    /* Verification: L∞ per tensor */
+    const cq_fixed16_t *qs[3] = { q, q + 5000, q + 15000 };
+    double norms[3];
+    cq_linf_norm_q16_parallel(&pool, tensors, qs, lens, 3, norms);
+    for (int t = 0; t < 3; t++) {
+        ASSERT(norms[t] == cq_linf_norm_q16(tensors[t], qs[t], lens[t]), "identical norm");
+    }
+
+    cq_pool_destroy(&pool);
+    return 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("=== Certifiable-Quant Thread Pool Tests ===\n\n");
+    lcg_state = 777u;
+
+    RUN_TEST(test_pool_partition_independent_of_threads);
+    RUN_TEST(test_pool_single_thread_and_pinning);
+    RUN_TEST(test_pool_engine_bit_identical);
+    RUN_TEST(test_pool_convert_calibrate_verify);
+
+    printf("\n=== Results: %d/%d tests passed ===\n", tests_passed, tests_run);
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
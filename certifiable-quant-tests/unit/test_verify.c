@@ -435,6 +435,109 @@ TEST(test_q16_to_float)
     return 1;
 }
 
+static uint32_t dq_state = 99u;
+
+static cq_fixed16_t dq_rand(void)
+{
+    dq_state = dq_state * 1664525u + 1013904223u;
+    return (cq_fixed16_t)(dq_state ^ (dq_state >> 7));
+}
+
+TEST(test_dequantize_arrays)
+{
+    static cq_fixed16_t q[203];
+    static float f[203], fs[3 * 70];
+    static double d[203], ds[2 * 70];
+
+    for (int i = 0; i < 203; i++) {
+        q[i] = dq_rand() >> (i % 17);
+    }
+    q[0] = INT32_MIN;
+    q[1] = INT32_MAX;
+    q[2] = (1 << 24) + 1;               /* rounds on int→float */
+
+    /* Every length, so each vector body and tail is exercised */
+    for (size_t n = 0; n <= 203; n += (n < 20) ? 1 : 61) {
+        memset(f, 0xFF, sizeof(f));
+        ASSERT(cq_dequantize_f32(q, f, n) == 0, "f32");
+        ASSERT(cq_dequantize_f64(q, d, n) == 0, "f64");
+        for (size_t i = 0; i < n; i++) {
+            const float ref = cq_q16_to_float(q[i]);
+            ASSERT(memcmp(&f[i], &ref, sizeof(ref)) == 0, "f32 bit-identical");
+            ASSERT(d[i] == (double)q[i] / 65536.0, "f64 exact");
+        }
+        ASSERT(n == 203 || f[n] != f[n], "no write past n");
+    }
+
+    /* Column 1 of a [70][3] output into every second slot */
+    ASSERT(cq_dequantize_f32_strided(q + 1, 3, fs, 3, 67) == 0, "f32 strided");
+    ASSERT(cq_dequantize_f64_strided(q + 1, 3, ds, 2, 67) == 0, "f64 strided");
+    for (int i = 0; i < 67; i++) {
+        const float ref = cq_q16_to_float(q[1 + 3 * i]);
+        ASSERT(memcmp(&fs[3 * i], &ref, sizeof(ref)) == 0, "strided f32 bit-identical");
+        ASSERT(ds[2 * i] == (double)q[1 + 3 * i] / 65536.0, "strided f64 exact");
+    }
+    ASSERT(cq_dequantize_f32_strided(q, 1, fs, 1, 70) == 0 &&
+           memcmp(fs, f, 70 * sizeof(float)) == 0, "unit stride");
+
+    ASSERT(cq_dequantize_f32(NULL, f, 1) == CQ_ERROR_NULL_POINTER, "null q");
+    ASSERT(cq_dequantize_f64(q, NULL, 1) == CQ_ERROR_NULL_POINTER, "null y");
+    return 1;
+}
+
+TEST(test_dequantize_argmax_topk)
+{
+    static cq_fixed16_t q[6 * 37];
+    static float y[6 * 37], val[6 * 5];
+    uint32_t arg[6], idx[6 * 5];
+
+    /* Small range: plenty of ties */
+    for (int i = 0; i < 6 * 37; i++) {
+        q[i] = (dq_rand() >> 28) * 65536;
+    }
+    q[36] = 20 * 65536;                 /* row 0: maximum in the tail */
+
+    ASSERT(cq_dequantize_argmax(q, y, 6, 37, arg) == 0, "argmax");
+    ASSERT(cq_dequantize_topk(q, NULL, 6, 37, 5, idx, val) == 0, "top-5");
+    ASSERT(arg[0] == 36 && idx[0] == 36, "tail maximum");
+
+    for (int r = 0; r < 6; r++) {
+        const cq_fixed16_t *row = q + r * 37;
+        bool used[37] = {false};
+
+        /* Reference selection: repeatedly the first largest unused */
+        for (int j = 0; j < 5; j++) {
+            int best = -1;
+            for (int c = 0; c < 37; c++) {
+                if (!used[c] && (best < 0 || row[c] > row[best])) best = c;
+            }
+            used[best] = true;
+            ASSERT(idx[r * 5 + j] == (uint32_t)best, "top-k order, ties by index");
+            ASSERT(val[r * 5 + j] == cq_q16_to_float(row[best]), "top-k values");
+            if (j == 0) {
+                ASSERT(arg[r] == (uint32_t)best, "argmax first of ties");
+            }
+        }
+        for (int c = 0; c < 37; c++) {
+            ASSERT(y[r * 37 + c] == cq_q16_to_float(row[c]), "fused dequantization");
+        }
+    }
+
+    /* k = cols sorts the row; single column */
+    uint32_t all[37];
+    ASSERT(cq_dequantize_topk(q, NULL, 1, 37, 37, all, NULL) == 0, "k = cols");
+    for (int j = 1; j < 37; j++) {
+        ASSERT(q[all[j - 1]] > q[all[j]] ||
+               (q[all[j - 1]] == q[all[j]] && all[j - 1] < all[j]), "full sort");
+    }
+    ASSERT(cq_dequantize_argmax(q, NULL, 6, 1, arg) == 0 && arg[5] == 0, "one column");
+    ASSERT(cq_dequantize_topk(q, NULL, 1, 37, 38, all, NULL) == CQ_ERROR_DIMENSION_MISMATCH,
+           "k > cols");
+    ASSERT(cq_dequantize_argmax(q, NULL, 1, 0, arg) == CQ_ERROR_DIMENSION_MISMATCH,
+           "no columns");
+    return 1;
+}
+
 TEST(test_verify_passed_helper)
 {
     cq_layer_comparison_t layers[1];
@@ -500,6 +603,8 @@ int main(void)
 
     /* Utility tests */
     RUN_TEST(test_q16_to_float);
+    RUN_TEST(test_dequantize_arrays);
+    RUN_TEST(test_dequantize_argmax_topk);
     RUN_TEST(test_verify_passed_helper);
 
     printf("\n=== Results: %d/%d tests passed ===\n", tests_passed, tests_run);
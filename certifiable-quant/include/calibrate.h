@@ -18,6 +18,7 @@
 #define CQ_CALIBRATE_H
 
 #include "cq_types.h"
+#include "thread_pool.h"
 #include <stddef.h>
 #include <float.h>
 
@@ -180,6 +181,26 @@ void cq_tensor_stats_update(cq_tensor_stats_t *stats,
  */
 void cq_tensor_stats_update_single(cq_tensor_stats_t *stats, float value);
 
+/**
+ * @brief Update many tensors' statistics across a thread pool.
+ *
+ * One work item per tensor: a tensor's min/max reduction is never split,
+ * so the result is identical to calling cq_tensor_stats_update() on each.
+ *
+ * @param pool     Thread pool, or NULL for the calling thread.
+ * @param stats    Tensor stats [count].
+ * @param tensors  Observed values per tensor [count].
+ * @param lens     Number of values per tensor [count].
+ * @param count    Number of tensors.
+ *
+ * @traceability SRS-002-CALIBRATE FR-CAL-01, CQ-MATH-001 §6
+ */
+void cq_tensor_stats_update_parallel(cq_pool_t *pool,
+                                     cq_tensor_stats_t *stats,
+                                     const float *const *tensors,
+                                     const size_t *lens,
+                                     uint32_t count);
+
 /* ============================================================================
  * FR-CAL-02: Coverage Computation
  * ============================================================================ */
@@ -0,0 +1,122 @@
+/**
+ * @file cert_audit.h
+ * @project Certifiable-Quant
+ * @brief Parallel bulk certificate verification
+ *
+ * Batch counterpart of cq_certificate_verify_header(),
+ * cq_certificate_verify_integrity() and cq_certificate_bounds_satisfied()
+ * for auditing whole registries: certificates are checked by a set of
+ * worker threads, optionally together with their Ed25519 signature and a
+ * re-hash of the quantized model file against target_model_hash.
+ *
+ * Results are per certificate and do not depend on the thread count.
+ *
+ * @traceability SRS-005-CERTIFICATE, CQ-STRUCT-001 §7.2
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#ifndef CQ_CERT_AUDIT_H
+#define CQ_CERT_AUDIT_H
+
+#include "certificate.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Failure Bits (0 = certificate passed every requested check)
+ * ============================================================================ */
+
+#define CQ_AUDIT_FAIL_READ          0x01u   /**< File unreadable or wrong size */
+#define CQ_AUDIT_FAIL_HEADER        0x02u   /**< Bad magic, scope or format */
+#define CQ_AUDIT_FAIL_INTEGRITY     0x04u   /**< Merkle root mismatch */
+#define CQ_AUDIT_FAIL_BOUNDS        0x08u   /**< ε_max measured > ε_total claimed */
+#define CQ_AUDIT_FAIL_SIGNATURE     0x10u   /**< Ed25519 signature invalid */
+#define CQ_AUDIT_FAIL_MODEL_IO      0x20u   /**< Model file missing or unreadable */
+#define CQ_AUDIT_FAIL_MODEL_HASH    0x40u   /**< Model file hash != target_model_hash */
+
+/* ============================================================================
+ * Options
+ * ============================================================================ */
+
+/**
+ * @brief Audit options.
+ */
+typedef struct {
+    unsigned threads;               /**< Worker threads (0 = online CPUs) */
+    const char *model_dir;          /**< If set, re-hash <model_dir>/<target hash hex> */
+    const uint8_t *public_key;      /**< If set, verify signatures (32 bytes) */
+} cq_cert_audit_opts_t;
+
+/** @brief Upper bound on worker threads. */
+#define CQ_AUDIT_MAX_THREADS        64
+
+/** @brief Certificates claimed by a worker at a time (one signature batch). */
+#define CQ_AUDIT_CLAIM              32
+
+#define CQ_AUDIT_PATH_MAX           4096
+
+/* ============================================================================
+ * Batch Interface
+ * ============================================================================ */
+
+/**
+ * @brief Audit serialised certificates held in memory.
+ *
+ * @param records  count × CQ_CERTIFICATE_SIZE contiguous records
+ *                 (e.g. the map of a cq_cert_store_t).
+ * @param count    Number of records.
+ * @param opts     Options (NULL = defaults).
+ * @param status   Output: Failure bits per record [count].
+ * @return         Number of records with status 0.
+ */
+size_t cq_cert_audit_records(const uint8_t *records,
+                             size_t count,
+                             const cq_cert_audit_opts_t *opts,
+                             uint32_t *status);
+
+/**
+ * @brief Audit certificate files; files are read by the workers.
+ *
+ * @param paths   Certificate file paths [count].
+ * @param count   Number of files.
+ * @param opts    Options (NULL = defaults).
+ * @param status  Output: Failure bits per file [count].
+ * @return        Number of files with status 0.
+ */
+size_t cq_cert_audit_files(const char *const *paths,
+                           size_t count,
+                           const cq_cert_audit_opts_t *opts,
+                           uint32_t *status);
+
+/**
+ * @brief Worker threads an audit of count items runs with.
+ *
+ * Resolves threads = 0 to the online CPUs, then clamps to
+ * CQ_AUDIT_MAX_THREADS and to one worker per CQ_AUDIT_CLAIM items.
+ *
+ * @param opts   Options (NULL = defaults).
+ * @param count  Number of records or files.
+ * @return       Thread count, including the calling thread.
+ */
+unsigned cq_cert_audit_threads(const cq_cert_audit_opts_t *opts, size_t count);
+
+/**
+ * @brief Name of a single failure bit ("header", "integrity", ...).
+ *
+ * @param bit  One CQ_AUDIT_FAIL_* value.
+ * @return     Static string, "unknown" for other values.
+ */
+const char *cq_cert_audit_reason(uint32_t bit);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CQ_CERT_AUDIT_H */
@@ -0,0 +1,205 @@
+/**
+ * @file cert_store.h
+ * @project Certifiable-Quant
+ * @brief Indexed on-disk certificate store
+ *
+ * An append-only data file of fixed CQ_CERTIFICATE_SIZE records plus a
+ * memory-mapped open-addressing hash index (<path>.idx) keyed by target
+ * and source model hash. Lookups probe the index and validate the hit in
+ * place through a cq_certificate_view_t, so finding a certificate costs
+ * O(1) regardless of store size.
+ *
+ * The index is a derived cache: it is rebuilt from the data file whenever
+ * it is missing, from another host, does not cover every record (e.g.
+ * after a crash between appending a record and updating the index), or
+ * has slots naming records that do not exist.
+ *
+ * One writer at a time; lookups and verification may run concurrently
+ * with each other but not with cq_cert_store_append().
+ *
+ * @traceability SRS-005-CERTIFICATE, CQ-STRUCT-001 §7
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#ifndef CQ_CERT_STORE_H
+#define CQ_CERT_STORE_H
+
+#include "certificate.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Constants
+ * ============================================================================ */
+
+#define CQ_CERT_STORE_INDEX_SUFFIX      ".idx"
+#define CQ_CERT_STORE_MIN_CAPACITY      1024    /**< Initial index slots (power of 2) */
+#define CQ_CERT_STORE_PATH_MAX          4096
+
+/** @brief Lookup or record not present. */
+#define CQ_CERT_STORE_NOT_FOUND         CQ_ERROR_NOT_FOUND
+
+/* ============================================================================
+ * Store Handle
+ * ============================================================================ */
+
+/**
+ * @brief Open certificate store.
+ *
+ * Caller-allocated; fields are managed by the cq_cert_store_* functions.
+ */
+typedef struct {
+    int data_fd;                    /**< Append-only record file */
+    int index_fd;                   /**< Hash index file */
+    const uint8_t *records;         /**< Read-only map of the record file */
+    size_t records_mapped;          /**< Records covered by the map */
+    uint8_t *index;                 /**< Shared map of the index file */
+    size_t index_size;              /**< Index map size in bytes */
+    uint32_t record_count;          /**< Records in the data file */
+    uint32_t torn_tail_bytes;       /**< Partial record found past the last one at open */
+    uint32_t capacity;              /**< Slots per hash table (power of 2) */
+    bool read_only;                 /**< From cq_cert_store_open_readonly() */
+    char index_path[CQ_CERT_STORE_PATH_MAX];
+} cq_cert_store_t;
+
+/* ============================================================================
+ * Lifecycle
+ * ============================================================================ */
+
+/**
+ * @brief Open (or create) a store at path.
+ *
+ * A torn trailing record left by an interrupted append is truncated;
+ * its size is reported in torn_tail_bytes.
+ *
+ * @param store  Store handle to initialise.
+ * @param path   Data file path; the index lives at path + ".idx".
+ * @return       0 on success, CQ_ERROR_NULL_POINTER or CQ_ERROR_IO.
+ */
+int cq_cert_store_open(cq_cert_store_t *store, const char *path);
+
+/**
+ * @brief Open an existing store without modifying it.
+ *
+ * The data file is opened O_RDONLY and the index is built in memory from
+ * the records, so neither file is created, truncated or rewritten. A torn
+ * trailing record is ignored and its size reported in torn_tail_bytes.
+ * cq_cert_store_append() fails with CQ_ERROR_IO on a read-only store.
+ *
+ * @param store  Store handle to initialise.
+ * @param path   Data file path.
+ * @return       0 on success, CQ_ERROR_NULL_POINTER or CQ_ERROR_IO.
+ */
+int cq_cert_store_open_readonly(cq_cert_store_t *store, const char *path);
+
+/**
+ * @brief Unmap and close a store.
+ *
+ * @param store  Store from cq_cert_store_open() or cq_cert_store_open_readonly().
+ */
+void cq_cert_store_close(cq_cert_store_t *store);
+
+/**
+ * @brief Flush records and index to stable storage.
+ *
+ * @param store  Open store.
+ * @return       0 on success, CQ_ERROR_IO on failure.
+ */
+int cq_cert_store_sync(cq_cert_store_t *store);
+
+/* ============================================================================
+ * Append and Lookup
+ * ============================================================================ */
+
+/**
+ * @brief Append a certificate and index it.
+ *
+ * The serialised record must pass cq_certificate_view_open(); invalid
+ * certificates are rejected without touching the store. A later record
+ * with the same target or source hash shadows earlier ones in lookups.
+ *
+ * @param store         Open store.
+ * @param cert          Certificate to append.
+ * @param record_index  Output: Index of the new record (may be NULL).
+ * @return              0 on success, CQ_ERROR_NULL_POINTER, CQ_ERROR_IO,
+ *                      or the cq_certificate_view_open() error.
+ */
+int cq_cert_store_append(cq_cert_store_t *store,
+                         const cq_certificate_t *cert,
+                         uint32_t *record_index);
+
+/**
+ * @brief Open a validated view on a record by position.
+ *
+ * The view points into the store's map and is valid until the next
+ * append or close.
+ *
+ * @param store         Open store.
+ * @param record_index  Record position.
+ * @param view          Output: View on the record.
+ * @return              0 on success, CQ_CERT_STORE_NOT_FOUND if out of
+ *                      range, or the cq_certificate_view_open() error.
+ */
+int cq_cert_store_get(const cq_cert_store_t *store,
+                      uint32_t record_index,
+                      cq_certificate_view_t *view);
+
+/**
+ * @brief Find the newest certificate for a quantized model hash.
+ *
+ * If the index turns out to be damaged, the answer comes from a scan of
+ * the records; the index is rebuilt by the next append or open.
+ *
+ * @param store  Open store.
+ * @param hash   target_model_hash (32 bytes).
+ * @param view   Output: Validated view on the record.
+ * @return       0 on success, CQ_CERT_STORE_NOT_FOUND, or the
+ *               cq_certificate_view_open() error if the record is corrupt.
+ */
+int cq_cert_store_find_target(const cq_cert_store_t *store,
+                              const uint8_t hash[32],
+                              cq_certificate_view_t *view);
+
+/**
+ * @brief Find the newest certificate for a source model hash.
+ *
+ * @param store  Open store.
+ * @param hash   source_model_hash (32 bytes).
+ * @param view   Output: Validated view on the record.
+ * @return       As cq_cert_store_find_target().
+ */
+int cq_cert_store_find_source(const cq_cert_store_t *store,
+                              const uint8_t hash[32],
+                              cq_certificate_view_t *view);
+
+/* ============================================================================
+ * Bulk Verification
+ * ============================================================================ */
+
+/**
+ * @brief Check header and Merkle root of every record in parallel.
+ *
+ * Records are split into contiguous ranges, one per thread.
+ *
+ * @param store    Open store.
+ * @param threads  Worker threads (0 = online CPUs).
+ * @param results  Output: Per-record validity [record_count] (may be NULL).
+ * @return         Number of valid records.
+ */
+size_t cq_cert_store_verify_all(const cq_cert_store_t *store,
+                                unsigned threads,
+                                bool *results);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CQ_CERT_STORE_H */
@@ -240,6 +240,72 @@ void cq_certificate_builder_set_format(cq_certificate_builder_t *builder,
  */
 bool cq_certificate_builder_is_complete(const cq_certificate_builder_t *builder);
 
+/* ============================================================================
+ * Builder Cache (Incremental Re-issuance)
+ * ============================================================================ */
+
+/* Builder inputs, for cq_certificate_builder_invalidate() / _missing() */
+#define CQ_CERT_INPUT_SOURCE        0x01u
+#define CQ_CERT_INPUT_BN            0x02u
+#define CQ_CERT_INPUT_ANALYSIS      0x04u
+#define CQ_CERT_INPUT_CALIBRATION   0x08u
+#define CQ_CERT_INPUT_VERIFICATION  0x10u
+#define CQ_CERT_INPUT_TARGET        0x20u
+#define CQ_CERT_INPUT_ALL           0x3Fu
+
+#define CQ_BUILDER_CACHE_MAGIC      "CQDC"
+#define CQ_BUILDER_CACHE_VERSION    1
+
+/**
+ * @brief Persist builder inputs and digest hashes next to a model.
+ *
+ * Stores every input that has been set, so a certificate can be re-issued
+ * (e.g. for a new tool version) without re-running analysis, calibration
+ * and verification. The SHA-256 of each digest is stored alongside and
+ * checked on load. The file carries its own SHA-256 and is replaced
+ * atomically (written and fsync'd to path + ".tmp", renamed, then the
+ * directory fsync'd).
+ *
+ * @param builder  Builder context.
+ * @param path     Cache file path.
+ * @return         0 on success, CQ_ERROR_NULL_POINTER or CQ_ERROR_IO.
+ */
+int cq_certificate_builder_save(const cq_certificate_builder_t *builder,
+                                const char *path);
+
+/**
+ * @brief Restore a builder from a cache file.
+ *
+ * Inputs recorded as set are restored as set. The stored digest hashes
+ * are checked against the digests; cq_certificate_build() rehashes them.
+ *
+ * @param builder  Builder context to overwrite.
+ * @param path     Cache file path.
+ * @return         0 on success, CQ_ERROR_NULL_POINTER, CQ_ERROR_IO,
+ *                 CQ_ERROR_INVALID_HEADER if it is not a cache or was
+ *                 written with a different version or digest layout,
+ *                 CQ_ERROR_CORRUPT if it is truncated or inconsistent.
+ */
+int cq_certificate_builder_load(cq_certificate_builder_t *builder,
+                                const char *path);
+
+/**
+ * @brief Mark inputs as changed so they must be set again before build.
+ *
+ * @param builder  Builder context.
+ * @param inputs   Mask of CQ_CERT_INPUT_* bits.
+ */
+void cq_certificate_builder_invalidate(cq_certificate_builder_t *builder,
+                                       uint32_t inputs);
+
+/**
+ * @brief Inputs still to be set before cq_certificate_build().
+ *
+ * @param builder  Builder context.
+ * @return         Mask of CQ_CERT_INPUT_* bits (0 when complete).
+ */
+uint32_t cq_certificate_builder_missing(const cq_certificate_builder_t *builder);
+
 /* ============================================================================
  * Certificate Generation
  * ============================================================================ */
@@ -252,9 +318,12 @@ bool cq_certificate_builder_is_complete(const cq_certificate_builder_t *builder)
  * @param faults   Output: Fault flags.
  * @return         0 on success, negative error code on failure.
  *
+ * The digests are hashed from the builder's current contents, so direct
+ * edits to its fields are always reflected.
+ *
  * @pre  cq_certificate_builder_is_complete(builder) == true
  * @post cert->merkle_root is computed
- * @post cert->signature is zeroed (unsigned)
+ * @post cert->signature is zeroed (unsigned); see cq_certificate_sign()
  *
  * @traceability SRS-005-CERTIFICATE
  */
@@ -305,6 +374,56 @@ static inline bool cq_certificate_bounds_satisfied(const cq_certificate_t *cert)
     return cert->epsilon_max_measured <= cert->epsilon_total_claimed;
 }
 
+/* ============================================================================
+ * Signing (Ed25519 over the Merkle root)
+ * ============================================================================ */
+
+/**
+ * @brief Sign a built certificate.
+ *
+ * Signs the 32-byte Merkle root with Ed25519 and stores the result in
+ * cert->signature. The root is checked against the content first so a
+ * stale root is never signed.
+ *
+ * @param cert        Certificate from cq_certificate_build().
+ * @param secret_key  Ed25519 secret key (64 bytes, see ed25519.h).
+ * @return            0 on success, CQ_ERROR_NULL_POINTER, or
+ *                    CQ_ERROR_MERKLE_MISMATCH if merkle_root does not match
+ *                    the content (nothing is signed).
+ *
+ * @traceability SRS-005-CERTIFICATE, CQ-MATH-001 §9.2
+ */
+int cq_certificate_sign(cq_certificate_t *cert,
+                        const uint8_t secret_key[64]);
+
+/**
+ * @brief Verify certificate integrity and signature.
+ *
+ * @param cert        Certificate to verify.
+ * @param public_key  Ed25519 public key of the signer (32 bytes).
+ * @return            true if the Merkle root matches and the signature is valid.
+ */
+bool cq_certificate_verify_signature(const cq_certificate_t *cert,
+                                     const uint8_t public_key[32]);
+
+/**
+ * @brief Verify integrity and signatures of many certificates at once.
+ *
+ * Certificates whose Merkle root matches are checked with
+ * cq_ed25519_verify_batch(), which shares one multi-scalar multiplication
+ * per chunk of signatures (and one public-key term per distinct signer).
+ *
+ * @param certs        Certificates [count].
+ * @param public_keys  Signer public key per certificate [count][32].
+ * @param count        Number of certificates.
+ * @param results      Output: Per-certificate validity [count] (may be NULL).
+ * @return             Number of certificates that verified.
+ */
+size_t cq_certificate_verify_signatures(const cq_certificate_t *certs,
+                                        const uint8_t (*public_keys)[32],
+                                        size_t count,
+                                        bool *results);
+
 /* ============================================================================
  * Serialisation
  * ============================================================================ */
@@ -312,10 +431,13 @@ static inline bool cq_certificate_bounds_satisfied(const cq_certificate_t *cert)
 /**
  * @brief Serialise certificate to byte buffer.
  *
+ * Writes the CQ_CERT_OFF_* layout with multi-byte fields little-endian,
+ * whatever the host byte order.
+ *
  * @param cert    Certificate to serialise.
  * @param buffer  Output buffer (must be CQ_CERTIFICATE_SIZE bytes).
  * @param size    Output: Actual bytes written.
- * @return        0 on success, negative error code on failure.
+ * @return        0 on success, CQ_ERROR_NULL_POINTER.
  */
 int cq_certificate_serialise(const cq_certificate_t *cert,
                              uint8_t *buffer,
@@ -327,12 +449,148 @@ int cq_certificate_serialise(const cq_certificate_t *cert,
  * @param buffer  Input buffer (must be CQ_CERTIFICATE_SIZE bytes).
  * @param size    Buffer size.
  * @param cert    Output: Deserialised certificate.
- * @return        0 on success, negative error code on failure.
+ * @return        0 on success, CQ_ERROR_NULL_POINTER,
+ *                CQ_ERROR_BUFFER_TOO_SMALL or CQ_ERROR_INVALID_HEADER.
  */
 int cq_certificate_deserialise(const uint8_t *buffer,
                                size_t size,
                                cq_certificate_t *cert);
 
+/* ============================================================================
+ * Zero-Copy View
+ * Traceability: CQ-STRUCT-001 §7.1
+ * ============================================================================ */
+
+/*
+ * Wire offsets of the 360-byte serialised form. Multi-byte fields are
+ * little-endian; doubles are IEEE-754 binary64 bit patterns.
+ */
+#define CQ_CERT_OFF_MAGIC               0
+#define CQ_CERT_OFF_VERSION             4
+#define CQ_CERT_OFF_TIMESTAMP           8
+#define CQ_CERT_OFF_SCOPE_SYMMETRIC     16
+#define CQ_CERT_OFF_SCOPE_FORMAT        17
+#define CQ_CERT_OFF_SCOPE_RESERVED      18
+#define CQ_CERT_OFF_SOURCE_HASH         24
+#define CQ_CERT_OFF_BN_HASH             56
+#define CQ_CERT_OFF_BN_STATUS           88
+#define CQ_CERT_OFF_SOURCE_RESERVED     89
+#define CQ_CERT_OFF_ANALYSIS_DIGEST     96
+#define CQ_CERT_OFF_CALIBRATION_DIGEST  128
+#define CQ_CERT_OFF_VERIFICATION_DIGEST 160
+#define CQ_CERT_OFF_EPSILON_0           192
+#define CQ_CERT_OFF_EPSILON_TOTAL       200
+#define CQ_CERT_OFF_EPSILON_MAX         208
+#define CQ_CERT_OFF_CLAIMS_RESERVED     216
+#define CQ_CERT_OFF_TARGET_HASH         224
+#define CQ_CERT_OFF_PARAM_COUNT         256
+#define CQ_CERT_OFF_LAYER_COUNT         260
+#define CQ_CERT_OFF_MERKLE_ROOT         264
+#define CQ_CERT_OFF_SIGNATURE           296
+
+/**
+ * @brief Read-only view of a serialised certificate.
+ *
+ * Refers to CQ_CERTIFICATE_SIZE bytes owned by the caller (e.g. an mmap'd
+ * archive or a received packet). Fields are decoded on access from their
+ * wire offsets, independent of host struct layout and byte order. The
+ * buffer must outlive the view.
+ */
+typedef struct {
+    const uint8_t *data;            /**< Start of the serialised certificate */
+} cq_certificate_view_t;
+
+/**
+ * @brief Validate a serialised certificate in place and open a view on it.
+ *
+ * Checks size, magic, scope, format and the Merkle root over the first
+ * CQ_CERT_OFF_MERKLE_ROOT bytes. No bytes are copied.
+ *
+ * @param view    Output: View (data is NULL unless 0 is returned).
+ * @param buffer  Serialised certificate.
+ * @param size    Buffer size.
+ * @return        0 on success, CQ_ERROR_NULL_POINTER,
+ *                CQ_ERROR_BUFFER_TOO_SMALL, CQ_ERROR_INVALID_HEADER or
+ *                CQ_ERROR_MERKLE_MISMATCH.
+ *
+ * @traceability SRS-005-CERTIFICATE, CQ-STRUCT-001 §7.2
+ */
+int cq_certificate_view_open(cq_certificate_view_t *view,
+                             const uint8_t *buffer,
+                             size_t size);
+
+/** @brief Tool version bytes (4). */
+const uint8_t *cq_certificate_view_version(const cq_certificate_view_t *view);
+
+/** @brief Unix timestamp (UTC). */
+uint64_t cq_certificate_view_timestamp(const cq_certificate_view_t *view);
+
+/** @brief CQ_FORMAT_Q16_16_CODE or CQ_FORMAT_Q8_24_CODE. */
+uint8_t cq_certificate_view_scope_format(const cq_certificate_view_t *view);
+
+/** @brief 0x00 = no BN, 0x01 = folded. */
+uint8_t cq_certificate_view_bn_folding_status(const cq_certificate_view_t *view);
+
+/** @brief SHA-256 of the FP32 source model (32 bytes). */
+const uint8_t *cq_certificate_view_source_hash(const cq_certificate_view_t *view);
+
+/** @brief Hash of the BN folding record (32 bytes). */
+const uint8_t *cq_certificate_view_bn_hash(const cq_certificate_view_t *view);
+
+/** @brief SHA-256 of the analysis digest (32 bytes). */
+const uint8_t *cq_certificate_view_analysis_digest(const cq_certificate_view_t *view);
+
+/** @brief SHA-256 of the calibration digest (32 bytes). */
+const uint8_t *cq_certificate_view_calibration_digest(const cq_certificate_view_t *view);
+
+/** @brief SHA-256 of the verification digest (32 bytes). */
+const uint8_t *cq_certificate_view_verification_digest(const cq_certificate_view_t *view);
+
+/** @brief ε₀: Entry error. */
+double cq_certificate_view_epsilon_0(const cq_certificate_view_t *view);
+
+/** @brief ε_total: Theoretical bound. */
+double cq_certificate_view_epsilon_total(const cq_certificate_view_t *view);
+
+/** @brief Maximum measured error. */
+double cq_certificate_view_epsilon_max(const cq_certificate_view_t *view);
+
+/** @brief SHA-256 of the quantized model (32 bytes). */
+const uint8_t *cq_certificate_view_target_hash(const cq_certificate_view_t *view);
+
+/** @brief Total parameter count. */
+uint32_t cq_certificate_view_param_count(const cq_certificate_view_t *view);
+
+/** @brief Number of layers. */
+uint32_t cq_certificate_view_layer_count(const cq_certificate_view_t *view);
+
+/** @brief Merkle root (32 bytes). */
+const uint8_t *cq_certificate_view_merkle_root(const cq_certificate_view_t *view);
+
+/** @brief Ed25519 signature (64 bytes, zeros if unsigned). */
+const uint8_t *cq_certificate_view_signature(const cq_certificate_view_t *view);
+
+/**
+ * @brief Verify the signature of a validated view.
+ *
+ * @param view        View from cq_certificate_view_open().
+ * @param public_key  Ed25519 public key of the signer (32 bytes).
+ * @return            true if the signature over the Merkle root is valid.
+ */
+bool cq_certificate_view_verify_signature(const cq_certificate_view_t *view,
+                                          const uint8_t public_key[32]);
+
+/**
+ * @brief Decode a view field by field into a certificate structure.
+ *
+ * @param view  View from cq_certificate_view_open().
+ * @param cert  Output: Certificate (reserved bytes carried over, so the
+ *              Merkle root still verifies).
+ * @return      0 on success, CQ_ERROR_NULL_POINTER.
+ */
+int cq_certificate_view_decode(const cq_certificate_view_t *view,
+                               cq_certificate_t *cert);
+
 /* ============================================================================
  * Utility Functions
  * ============================================================================ */
@@ -0,0 +1,99 @@
+/**
+ * @file codegen.h
+ * @project Certifiable-Quant
+ * @brief Model-specialized C code generator
+ *
+ * Once a model is converted, every shape, scale exponent and weight is
+ * fixed. cq_codegen_emit() turns a validated engine into one standalone
+ * C99 translation unit in which all of them are compile-time constants:
+ * weights and biases are static const arrays, loop bounds and
+ * requantization shifts are literals, inner loops are unrolled, and the
+ * overflow proof (CQ-MATH-001 §3.4) is reduced to one comparison against
+ * a precomputed input bound, or removed when it holds for every input.
+ *
+ * The generated code uses only the DVM primitive semantics (saturating
+ * add, RNE shift, clamp, requantize) copied from the reference library,
+ * in the same order as the engine kernels, so its outputs and faults are
+ * bit-identical to cq_engine_run(). It includes only <stdint.h> and
+ * exports one function:
+ *
+ *   void <prefix>_run(const int32_t *input, int32_t *output, uint32_t *faults);
+ *
+ * faults receives the cq_fault_code_t bits raised by the run. Defining
+ * <PREFIX>_HARNESS adds a main() that reads raw int32 input vectors from
+ * stdin and writes each output vector followed by its fault word, so the
+ * deployed file itself can be checked against the engine.
+ *
+ * @traceability CQ-MATH-001 §3-§4, CQ-STRUCT-001 §5.3
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#ifndef CQ_CODEGEN_H
+#define CQ_CODEGEN_H
+
+#include "engine.h"
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Default prefix of generated symbols */
+#define CQ_CODEGEN_DEFAULT_PREFIX   "cq_model"
+
+/** Longest prefix accepted (characters) */
+#define CQ_CODEGEN_MAX_PREFIX       32u
+
+/** Default unroll factor of inner loops */
+#define CQ_CODEGEN_DEFAULT_UNROLL   8u
+
+/** Largest unroll factor accepted */
+#define CQ_CODEGEN_MAX_UNROLL       64u
+
+/**
+ * @brief Generator options.
+ */
+typedef struct {
+    const char *prefix;             /**< C identifier; NULL = CQ_CODEGEN_DEFAULT_PREFIX */
+    uint32_t unroll;                /**< Inner loops up to this length are fully unrolled,
+                                         longer ones by this factor; 0 = default */
+    uint32_t _reserved;
+} cq_codegen_opts_t;
+
+/**
+ * @brief Emit a model-specialized C source file for an engine.
+ *
+ * Layers are read from the engine's headers, shapes and blob; attached
+ * CSR matrices are ignored (the dense weights give identical results),
+ * panel-packed weights are emitted in row-major order, and int16
+ * weights (CQ_STORAGE_INT16) as int16_t arrays.
+ * A weighted layer followed by ReLU is emitted as one fused kernel. The
+ * fast path is generated only if engine->fast_path_enabled.
+ *
+ * There is no generated 128-bit accumulator path. With
+ * engine->wide_acc_enabled, an engine whose dense row-major layer can fail
+ * its overflow proof for some int32 input is refused, since the engine
+ * would widen that layer where the generated code saturates. Engines whose
+ * proofs hold for every input are emitted as usual.
+ *
+ * @param engine  Initialised engine.
+ * @param opts    Options, or NULL for the defaults.
+ * @param out     Destination stream.
+ * @return        0 on success, CQ_ERROR_NULL_POINTER,
+ *                CQ_ERROR_DIMENSION_MISMATCH for an invalid prefix or
+ *                unroll factor, a weight tensor of 2^32 or more
+ *                elements, or a layer the engine may widen (above),
+ *                CQ_ERROR_IO if writing failed.
+ */
+int cq_codegen_emit(const cq_engine_t *engine,
+                    const cq_codegen_opts_t *opts,
+                    FILE *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CQ_CODEGEN_H */
@@ -14,6 +14,9 @@
 #define CQ_CONVERT_H
 
 #include "cq_types.h"
+#include "calibrate.h"
+#include "engine.h"
+#include "thread_pool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -63,6 +66,253 @@ int cq_convert_weights(const float *w_fp,
                        const cq_tensor_spec_t *spec,
                        cq_fault_flags_t *faults);
 
+/** Elements per parallel conversion work item */
+#define CQ_CONVERT_GRAIN    4096u
+
+/**
+ * @brief cq_convert_weights() across a thread pool.
+ *
+ * Elements are independent, so the output and merged faults are identical
+ * to the serial call for any thread count.
+ */
+int cq_convert_weights_parallel(cq_pool_t *pool,
+                                const float *w_fp,
+                                cq_fixed16_t *w_q,
+                                size_t count,
+                                const cq_tensor_spec_t *spec,
+                                cq_fault_flags_t *faults);
+
+/* ============================================================================
+ * Input Ingress (CQ-MATH-001 §3.6.1)
+ * ============================================================================ */
+
+/**
+ * @brief Quantize an FP32 input tensor to Q16.16 at serving time.
+ *
+ * Every finite element equals cq_quantize_weight_rne(x[i], 2^scale_exp),
+ * saturation faults included: x·2^e is exact in FP64, so the RNE result
+ * does not depend on how it is computed, and the kernel rounds with an
+ * explicit mode (SSE4.1 when built with it) instead of libm.
+ *
+ * Non-finite elements raise range_exceed; NaN becomes 0 and ±Inf
+ * saturates as in the reference. With a safe range, finite elements
+ * outside [min_safe, max_safe] raise range_exceed as well (the range
+ * veto of §5.2 applied to the live input); they are still quantized.
+ *
+ * @param x       FP32 input [count].
+ * @param x_q     Output: Q16.16 input [count].
+ * @param count   Number of elements.
+ * @param spec    Input tensor spec (the first layer's input_spec).
+ * @param safe    Calibrated range (min_safe, max_safe), or NULL for none.
+ * @param faults  Fault flags.
+ * @return        0 on success, CQ_ERROR_NULL_POINTER,
+ *                CQ_FAULT_ASYMMETRIC_PARAMS.
+ */
+int cq_quantize_input(const float *x,
+                      cq_fixed16_t *x_q,
+                      size_t count,
+                      const cq_tensor_spec_t *spec,
+                      const cq_tensor_stats_t *safe,
+                      cq_fault_flags_t *faults);
+
+/* ============================================================================
+ * Sparse Storage
+ * ============================================================================ */
+
+/** Default sparsity above which CSR is smaller than dense (8 vs 4 bytes/entry) */
+#define CQ_SPARSE_MIN_SPARSITY  0.5
+
+/**
+ * @brief Fraction of quantized weights that are exactly zero.
+ */
+double cq_weight_sparsity(const cq_fixed16_t *w_q, size_t count);
+
+/**
+ * @brief Build a CSR matrix from dense row-major Q16.16 weights.
+ *
+ * Zeros are dropped; every other entry is kept in row-major order.
+ * csr->rows, cols, nnz and max_row_nnz are filled in.
+ *
+ * @param w_q   Dense weights [rows][cols].
+ * @param rows  Matrix rows.
+ * @param cols  Matrix columns.
+ * @param csr   In: row_ptr [rows + 1], col_idx and values [capacity].
+ *              Out: the sparse matrix.
+ * @return      0 on success, CQ_ERROR_NULL_POINTER,
+ *              CQ_ERROR_DIMENSION_MISMATCH if nnz exceeds capacity
+ *              (csr->nnz then holds the capacity required).
+ */
+int cq_csr_from_dense(const cq_fixed16_t *w_q,
+                      uint32_t rows,
+                      uint32_t cols,
+                      cq_csr_q16_t *csr);
+
+/**
+ * @brief cq_convert_weights() for a [rows][cols] matrix, also emitting CSR
+ *        when the quantized sparsity exceeds min_sparsity.
+ *
+ * Sparsity is measured after RNE quantization, so weights that round to
+ * zero in Q16.16 count as zeros. The dense output is always written.
+ *
+ * @param w_fp          FP32 weights [rows][cols].
+ * @param w_q           Output: Dense Q16.16 weights [rows][cols].
+ * @param rows          Matrix rows.
+ * @param cols          Matrix columns.
+ * @param spec          Weight tensor spec.
+ * @param min_sparsity  Threshold, e.g. CQ_SPARSE_MIN_SPARSITY.
+ * @param csr           Output: CSR matrix when *is_sparse.
+ * @param is_sparse     Output: CSR was emitted.
+ * @param faults        Fault flags.
+ * @return              0 on success, CQ_ERROR_NULL_POINTER,
+ *                      CQ_FAULT_ASYMMETRIC_PARAMS,
+ *                      CQ_ERROR_DIMENSION_MISMATCH if the CSR capacity is
+ *                      too small.
+ */
+int cq_convert_weights_sparse(const float *w_fp,
+                              cq_fixed16_t *w_q,
+                              uint32_t rows,
+                              uint32_t cols,
+                              const cq_tensor_spec_t *spec,
+                              double min_sparsity,
+                              cq_csr_q16_t *csr,
+                              bool *is_sparse,
+                              cq_fault_flags_t *faults);
+
+/* ============================================================================
+ * Weight Prepacking
+ * ============================================================================ */
+
+/**
+ * @brief Elements of a [rows][cols] matrix stored in a layout
+ *        (cq_weight_layout_t); 0 for an unknown layout.
+ */
+uint64_t cq_weight_layout_count(uint32_t layout, uint32_t rows, uint32_t cols);
+
+/**
+ * @brief Reorder dense row-major Q16.16 weights into a layout.
+ *
+ * Every value is copied unchanged, and padding rows are zero, so a
+ * kernel reading the packed matrix computes the same products.
+ *
+ * @param w_q     Row-major weights [rows][cols].
+ * @param rows    Matrix rows.
+ * @param cols    Matrix columns.
+ * @param layout  Target layout.
+ * @param packed  Output: cq_weight_layout_count() elements (not aliasing w_q).
+ * @return        0 on success, CQ_ERROR_NULL_POINTER,
+ *                CQ_ERROR_DIMENSION_MISMATCH for an unknown layout.
+ */
+int cq_pack_weights(const cq_fixed16_t *w_q,
+                    uint32_t rows,
+                    uint32_t cols,
+                    uint32_t layout,
+                    cq_fixed16_t *packed);
+
+/**
+ * @brief cq_convert_weights() for a [rows][cols] matrix, writing each
+ *        quantized weight straight to its position in layout.
+ *
+ * The result equals cq_pack_weights() over the row-major conversion,
+ * with the same faults, and needs no intermediate buffer. Record the
+ * layout in the layer header's weight_layout.
+ *
+ * @param w_fp      FP32 weights [rows][cols], row-major.
+ * @param w_packed  Output: cq_weight_layout_count() elements.
+ * @param rows      Matrix rows.
+ * @param cols      Matrix columns.
+ * @param layout    Target layout.
+ * @param spec      Weight tensor spec.
+ * @param faults    Fault flags.
+ * @return          0 on success, CQ_ERROR_NULL_POINTER,
+ *                  CQ_FAULT_ASYMMETRIC_PARAMS,
+ *                  CQ_ERROR_DIMENSION_MISMATCH for an unknown layout.
+ */
+int cq_convert_weights_packed(const float *w_fp,
+                              cq_fixed16_t *w_packed,
+                              uint32_t rows,
+                              uint32_t cols,
+                              uint32_t layout,
+                              const cq_tensor_spec_t *spec,
+                              cq_fault_flags_t *faults);
+
+/* ============================================================================
+ * Compact Storage
+ * ============================================================================ */
+
+/**
+ * @brief True if every quantized weight fits int16 (CQ_STORAGE_INT16).
+ */
+bool cq_weights_fit_int16(const cq_fixed16_t *w_q, size_t count);
+
+/**
+ * @brief Copy Q16.16 weights into int16 storage, value for value.
+ *
+ * @param w_q    Weights, any layout.
+ * @param count  Number of weights.
+ * @param w16    Output: count int16 values.
+ * @return       0 on success, CQ_ERROR_NULL_POINTER,
+ *               CQ_ERROR_DIMENSION_MISMATCH if a weight does not fit
+ *               (w16 is then unspecified).
+ */
+int cq_narrow_weights(const cq_fixed16_t *w_q, size_t count, int16_t *w16);
+
+/**
+ * @brief cq_convert_weights(), then select int16 storage if every
+ *        quantized weight fits.
+ *
+ * The Q16.16 output is always written. When the weights fit, w16 holds
+ * the same integers and spec->storage becomes CQ_STORAGE_INT16; otherwise
+ * it becomes CQ_STORAGE_INT32. The scale exponent is never changed, so
+ * the kernels produce the same accumulators from either copy. Store the
+ * selected copy in the blob with the updated spec as the weight_spec.
+ * Int16 storage applies to row-major weights only.
+ *
+ * @param w_fp    FP32 weights.
+ * @param w_q     Output: Q16.16 weights [count].
+ * @param w16     Output: int16 weights [count] when selected.
+ * @param count   Number of weights.
+ * @param spec    In: weight tensor spec. Out: storage selected.
+ * @param faults  Fault flags.
+ * @return        0 on success, CQ_ERROR_NULL_POINTER,
+ *                CQ_FAULT_ASYMMETRIC_PARAMS.
+ */
+int cq_convert_weights_compact(const float *w_fp,
+                               cq_fixed16_t *w_q,
+                               int16_t *w16,
+                               size_t count,
+                               cq_tensor_spec_t *spec,
+                               cq_fault_flags_t *faults);
+
+/* ============================================================================
+ * Model Digest
+ * ============================================================================ */
+
+/**
+ * @brief SHA-256 of a quantized model: every layer header and shape
+ *        field in a fixed little-endian encoding (including
+ *        weight_layout, kernel, stride and padding), then the
+ *        weight/bias blob.
+ *
+ * This is the target hash for cq_certificate_builder_set_target(). The
+ * encoding does not depend on struct padding or host byte order, and a
+ * change of weight layout or of conv/pool geometry changes the digest
+ * even if the blob bytes are the same.
+ *
+ * @param headers      Layer headers [layer_count].
+ * @param shapes       Layer geometry [layer_count], as given to cq_engine_init().
+ * @param layer_count  Number of layers.
+ * @param blob         Weight/bias blob.
+ * @param blob_size    Blob size in bytes.
+ * @param digest       Output: 32-byte digest.
+ * @return             0 on success, CQ_ERROR_NULL_POINTER.
+ */
+int cq_model_hash(const cq_layer_header_t *headers,
+                  const cq_layer_shape_t *shapes,
+                  uint32_t layer_count,
+                  const uint8_t *blob,
+                  size_t blob_size,
+                  uint8_t digest[32]);
+
 /* ============================================================================
  * FR-CNV-04: BatchNorm Folding
  * ============================================================================ */
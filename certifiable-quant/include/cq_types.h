@@ -52,6 +52,19 @@ typedef int32_t cq_fixed24_t;
 /** @brief Q32.32 accumulator for intermediate results */
 typedef int64_t cq_accum64_t;
 
+/* 128-bit accumulator, two's complement across two words (value = hi·2^64 + lo) */
+typedef struct {
+    uint64_t lo;
+    uint64_t hi;
+} cq_accum128_t;
+
+/* Precomputed division by an invariant divisor (see cq_divisor_init()) */
+typedef struct {
+    uint64_t recip;     /* ⌊(2^64 − 1) / mag⌋, 0 when mag = 0 */
+    uint64_t mag;       /* |divisor| */
+    bool negative;      /* divisor < 0 */
+} cq_divisor_t;
+
 /** @brief Scale exponent for S = 2^n */
 typedef int8_t cq_scale_exp_t;
 
@@ -107,6 +120,12 @@ typedef enum {
 #define CQ_ERROR_NULL_POINTER       (-1)
 #define CQ_ERROR_DYADIC_VIOLATION   (-2)
 #define CQ_ERROR_DIMENSION_MISMATCH (-3)
+#define CQ_ERROR_IO                 (-4)
+#define CQ_ERROR_MERKLE_MISMATCH    (-5)
+#define CQ_ERROR_BUFFER_TOO_SMALL   (-6)
+#define CQ_ERROR_INVALID_HEADER     (-7)
+#define CQ_ERROR_NOT_FOUND          (-8)
+#define CQ_ERROR_CORRUPT            (-9)
 
 /* Fault helpers */
 static inline bool cq_has_fault(const cq_fault_flags_t *f) {
@@ -129,15 +148,56 @@ static inline void cq_fault_merge(cq_fault_flags_t *dst,
     *((uint32_t *)dst) |= *((uint32_t *)src);
 }
 
+/* Counting fault sink: events per fault kind, where kind k is the bit
+   position of its cq_fault_code_t (CQ_FAULT_OVERFLOW = kind 0). Optional;
+   the sticky bitfield above remains the fault contract. */
+#define CQ_FAULT_KINDS  7u
+
+typedef struct {
+    uint64_t count[CQ_FAULT_KINDS];
+} cq_fault_counts_t;
+
+static inline void cq_fault_counts_clear(cq_fault_counts_t *c) {
+    for (uint32_t k = 0; k < CQ_FAULT_KINDS; k++) {
+        c->count[k] = 0;
+    }
+}
+
+/* One event for every fault bit set in f */
+static inline void cq_fault_count(cq_fault_counts_t *c,
+                                  const cq_fault_flags_t *f) {
+    c->count[0] += f->overflow;
+    c->count[1] += f->underflow;
+    c->count[2] += f->div_zero;
+    c->count[3] += f->range_exceed;
+    c->count[4] += f->unfolded_bn;
+    c->count[5] += f->asymmetric;
+    c->count[6] += f->bound_violation;
+}
+
+static inline void cq_fault_counts_merge(cq_fault_counts_t *dst,
+                                         const cq_fault_counts_t *src) {
+    for (uint32_t k = 0; k < CQ_FAULT_KINDS; k++) {
+        dst->count[k] += src->count[k];
+    }
+}
+
 /* ============================================================================
  * Tensor Specification (ST-005-B)
  * ============================================================================ */
 
+/* Element width of a weight tensor in the blob; the value is the same
+   integer at scale_exp either way */
+typedef enum {
+    CQ_STORAGE_INT32 = 0,       /* cq_fixed16_t */
+    CQ_STORAGE_INT16 = 1        /* int16_t, widened on load */
+} cq_storage_t;
+
 typedef struct {
     cq_scale_exp_t scale_exp;
     uint8_t format;
     bool is_symmetric;
-    uint8_t _reserved;
+    uint8_t storage;            /* cq_storage_t (weights only) */
 } cq_tensor_spec_t;
 
 /* ============================================================================
@@ -168,6 +228,15 @@ typedef enum {
     CQ_LAYER_AVGPOOL  = 5
 } cq_layer_type_t;
 
+/* Weight order in the blob (cq_layer_header_t.weight_layout) */
+typedef enum {
+    CQ_WEIGHT_LAYOUT_ROW_MAJOR = 0,     /* [rows][cols] */
+    CQ_WEIGHT_LAYOUT_PANEL     = 1      /* [⌈rows/P⌉][cols][P], last panel zero-filled */
+} cq_weight_layout_t;
+
+/* Rows per panel (P): outputs computed together by the panel kernel */
+#define CQ_PANEL_ROWS   4u
+
 typedef struct {
     uint32_t layer_index;
     uint32_t layer_type;
@@ -178,13 +247,32 @@ typedef struct {
     uint32_t weight_rows;
     uint32_t weight_cols;
     uint32_t bias_len;
-    uint32_t _pad;
+    uint32_t weight_layout;     /* cq_weight_layout_t */
     uint64_t weight_offset;
     uint64_t bias_offset;
     bool dyadic_valid;
     uint8_t _reserved[7];
 } cq_layer_header_t;
 
+/* ============================================================================
+ * Sparse Weights (ST-005-D)
+ * Traceability: CQ-MATH-001 §3.4
+ * ============================================================================ */
+
+/* CSR Q16.16 matrix; arrays are caller-allocated. Columns ascend within a
+   row, so the non-zero products are accumulated in dense order. */
+typedef struct {
+    uint32_t rows;
+    uint32_t cols;
+    uint32_t nnz;
+    uint32_t capacity;          /* Entries available in col_idx / values */
+    uint32_t max_row_nnz;       /* Longest row: fan-in for the overflow proof */
+    uint32_t _pad;
+    uint32_t *row_ptr;          /* [rows + 1] */
+    uint32_t *col_idx;          /* [capacity] */
+    cq_fixed16_t *values;       /* [capacity] */
+} cq_csr_q16_t;
+
 /* ============================================================================
  * BatchNorm Structures
  * ============================================================================ */
@@ -69,6 +69,44 @@ cq_fixed16_t cq_mul_q16(cq_fixed16_t a, cq_fixed16_t b, cq_fault_flags_t *faults
  */
 cq_fixed16_t cq_div_q16(cq_fixed16_t a, cq_fixed16_t b, cq_fault_flags_t *faults);
 
+/* ============================================================================
+ * Division by an Invariant (CQ-MATH-001 §3.3)
+ * ============================================================================ */
+
+/**
+ * @brief Precompute division by a fixed divisor.
+ *
+ * Stores r = ⌊(2^64 − 1) / |divisor|⌋. For any n < 2^64 the high word of
+ * n · r is ⌊n / |divisor|⌋ or one less, so a single correction step gives
+ * the exact quotient and remainder with one multiply instead of a divide.
+ * A zero divisor is accepted; every division by it then reports div_zero.
+ */
+void cq_divisor_init(cq_divisor_t *d, int64_t divisor);
+
+/**
+ * @brief Exact unsigned quotient ⌊n / |divisor|⌋ and remainder.
+ * @param d   Non-zero divisor from cq_divisor_init().
+ * @param rem Remainder output (may be NULL).
+ */
+uint64_t cq_divu64(uint64_t n, const cq_divisor_t *d, uint64_t *rem);
+
+/**
+ * @brief cq_div_q16(a, b) for the b given to cq_divisor_init().
+ *
+ * Bit-identical to cq_div_q16(), rounding rule and faults included, for
+ * every a and b.
+ */
+cq_fixed16_t cq_div_q16_inv(cq_fixed16_t a, const cq_divisor_t *d, cq_fault_flags_t *faults);
+
+/**
+ * @brief y[i] = cq_div_q16(a[i], b) for i < n; y may alias a.
+ */
+void cq_div_q16_array(const cq_fixed16_t *a,
+                      const cq_divisor_t *d,
+                      cq_fixed16_t *y,
+                      size_t n,
+                      cq_fault_flags_t *faults);
+
 /* ============================================================================
  * Accumulator Operations (CQ-MATH-001 §3.4)
  * ============================================================================ */
@@ -84,6 +122,19 @@ void cq_mac_q16(cq_accum64_t *acc, cq_fixed16_t a, cq_fixed16_t b,
  */
 cq_fixed16_t cq_acc_to_q16(cq_accum64_t acc, cq_fault_flags_t *faults);
 
+/* ============================================================================
+ * Requantization (CQ-MATH-001 §3.5)
+ * ============================================================================ */
+
+/**
+ * @brief Project an accumulator to the output scale.
+ * @param acc    Accumulator at scale exponent e_in.
+ * @param shift  e_in − e_out: > 0 rounds RNE, < 0 scales up with saturation.
+ * @param faults Fault flags output.
+ * @return Requantized 32-bit value.
+ */
+int32_t cq_requantize(int64_t acc, int32_t shift, cq_fault_flags_t *faults);
+
 /* ============================================================================
  * Overflow Safety (CQ-MATH-001 §3.4)
  * ============================================================================ */
@@ -93,6 +144,60 @@ cq_fixed16_t cq_acc_to_q16(cq_accum64_t acc, cq_fault_flags_t *faults);
  */
 bool cq_overflow_is_safe(const cq_overflow_proof_t *proof);
 
+/* ============================================================================
+ * Wide Accumulation (CQ-MATH-001 §3.4)
+ * ============================================================================ */
+
+/**
+ * @brief Check that n × |w|max × |x|max + 2^63 (any int64 bias) < 2^127.
+ *
+ * The exact-accumulator counterpart of cq_overflow_is_safe(). With 32-bit
+ * magnitudes and fan-in the bound is at most 2^94 + 2^63, so it holds for
+ * every layer the header can describe; it is still checked explicitly so
+ * that the proof obligation is discharged in code.
+ */
+bool cq_overflow_is_safe128(const cq_overflow_proof_t *proof);
+
+/**
+ * @brief Products per int64 partial sum that cannot overflow:
+ *        ⌊(2^63 − 1) / (|w|max · |x|max)⌋, capped at dot_product_len
+ *        (at least 1).
+ *
+ * Kernels accumulate this many products in int64 and then fold the
+ * partial into a cq_accum128_t, so the 128-bit carry is paid once per
+ * chunk while the sum stays exact.
+ */
+uint32_t cq_acc128_chunk_len(const cq_overflow_proof_t *proof);
+
+/**
+ * @brief Set a 128-bit accumulator to a sign-extended 64-bit value.
+ */
+void cq_acc128_set(cq_accum128_t *acc, int64_t v);
+
+/**
+ * @brief acc += v, exactly (modulo 2^128, never reached under the proof).
+ */
+void cq_acc128_add64(cq_accum128_t *acc, int64_t v);
+
+/**
+ * @brief Exact multiply-accumulate: acc += a * b.
+ */
+void cq_mac128_q16(cq_accum128_t *acc, cq_fixed16_t a, cq_fixed16_t b);
+
+/**
+ * @brief Project a 128-bit accumulator to the output scale.
+ *
+ * Values in the int64 range give exactly cq_requantize(). Wider values
+ * round RNE (shift > 0) and saturate to int32 with the overflow or
+ * underflow fault, as the narrow path does.
+ *
+ * @param acc    Accumulator at scale exponent e_in.
+ * @param shift  e_in − e_out.
+ * @param faults Fault flags output.
+ * @return Requantized 32-bit value.
+ */
+int32_t cq_requantize128(const cq_accum128_t *acc, int32_t shift, cq_fault_flags_t *faults);
+
 /* ============================================================================
  * Portable Arithmetic Shift
  * ============================================================================ */
@@ -0,0 +1,110 @@
+/**
+ * @file ed25519.h
+ * @project Certifiable-Quant
+ * @brief Ed25519 signatures for certificate signing (RFC 8032).
+ *
+ * Self-contained implementation (own SHA-512, field and group arithmetic)
+ * so that signing and verification need no external library or service.
+ * Verification uses the cofactored equation [8][S]B = [8]R + [8][h]A, for
+ * which single and batch verification always agree.
+ *
+ * @traceability CQ-MATH-001 §9, SRS-005-CERTIFICATE, CQ-STRUCT-001 §7.1
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#ifndef CQ_ED25519_H
+#define CQ_ED25519_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CQ_ED25519_SEED_SIZE        32
+#define CQ_ED25519_PUBLIC_KEY_SIZE  32
+#define CQ_ED25519_SECRET_KEY_SIZE  64  /**< seed || public key */
+#define CQ_ED25519_SIGNATURE_SIZE   64
+
+/** @brief Signatures combined into one multi-scalar multiplication. */
+#define CQ_ED25519_BATCH_CHUNK      32
+
+/**
+ * @brief One signature to check in a batch.
+ */
+typedef struct {
+    const uint8_t *public_key;      /**< 32-byte public key */
+    const uint8_t *signature;       /**< 64-byte signature R || S */
+    const void *message;            /**< Signed message */
+    size_t message_len;             /**< Message length in bytes */
+} cq_ed25519_item_t;
+
+/**
+ * @brief Derive a key pair from a 32-byte secret seed.
+ *
+ * @param seed        Secret seed (32 bytes).
+ * @param public_key  Output: Public key (32 bytes).
+ * @param secret_key  Output: Secret key, seed || public key (64 bytes).
+ */
+void cq_ed25519_keypair_from_seed(const uint8_t seed[CQ_ED25519_SEED_SIZE],
+                                  uint8_t public_key[CQ_ED25519_PUBLIC_KEY_SIZE],
+                                  uint8_t secret_key[CQ_ED25519_SECRET_KEY_SIZE]);
+
+/**
+ * @brief Sign a message (deterministic, RFC 8032 §5.1.6).
+ *
+ * @param secret_key  Secret key from cq_ed25519_keypair_from_seed().
+ * @param message     Message bytes.
+ * @param len         Message length.
+ * @param signature   Output: Signature (64 bytes).
+ */
+void cq_ed25519_sign(const uint8_t secret_key[CQ_ED25519_SECRET_KEY_SIZE],
+                     const void *message,
+                     size_t len,
+                     uint8_t signature[CQ_ED25519_SIGNATURE_SIZE]);
+
+/**
+ * @brief Verify a single signature.
+ *
+ * Rejects non-canonical S (S >= L) and undecodable points.
+ *
+ * @param public_key  Public key (32 bytes).
+ * @param message     Message bytes.
+ * @param len         Message length.
+ * @param signature   Signature (64 bytes).
+ * @return            true if the signature is valid.
+ */
+bool cq_ed25519_verify(const uint8_t public_key[CQ_ED25519_PUBLIC_KEY_SIZE],
+                       const void *message,
+                       size_t len,
+                       const uint8_t signature[CQ_ED25519_SIGNATURE_SIZE]);
+
+/**
+ * @brief Verify many signatures with one multi-scalar multiplication.
+ *
+ * Up to CQ_ED25519_BATCH_CHUNK signatures are checked together as
+ *   [8]( Σ z_i R_i + Σ (z_i h_i) A_i − (Σ z_i S_i) B ) = O
+ * with 128-bit coefficients z_i derived by hashing the whole chunk, so the
+ * result is deterministic. The 256 doublings are shared across the chunk
+ * and signatures under the same public key share one A term. If a chunk
+ * fails, its signatures are re-checked individually to locate the bad ones.
+ *
+ * @param items    Signatures to verify.
+ * @param count    Number of items.
+ * @param results  Output: Per-item validity (may be NULL).
+ * @return         Number of valid signatures.
+ */
+size_t cq_ed25519_verify_batch(const cq_ed25519_item_t *items,
+                               size_t count,
+                               bool *results);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CQ_ED25519_H */
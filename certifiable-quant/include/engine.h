@@ -0,0 +1,663 @@
+/**
+ * @file engine.h
+ * @project Certifiable-Quant
+ * @brief Reference inference engine (The Executor)
+ *
+ * Executes a quantized model described by a sequence of cq_layer_header_t
+ * over a weight/bias blob, entirely in integer arithmetic:
+ *
+ *   acc   = Σ w_int · x_int                      (scale e_w + e_x)
+ *   acc  += b_int                                (dyadic: e_b = e_w + e_x)
+ *   y_int = RNE(acc >> (e_w + e_x − e_out))      (CQ-MATH-001 §3.5)
+ *
+ * Linear, Conv2D, ReLU, Max/Avg pooling and Softmax (CQ-MATH-001 §4.2) are
+ * supported. Faults are collected per layer and merged for the whole run.
+ *
+ * Blob layout: weights are int32 at weight_offset, row-major
+ * [weight_rows][weight_cols] (Conv2D: [out_c][in_c][kh][kw]), or for a
+ * Linear layer with weight_layout CQ_WEIGHT_LAYOUT_PANEL, in panels of
+ * CQ_PANEL_ROWS column-interleaved rows (cq_pack_weights()). Row-major
+ * weights may instead be int16 when weight_spec.storage is
+ * CQ_STORAGE_INT16 (cq_convert_weights_compact()). Biases are
+ * int32 at bias_offset, or int64 when bias_spec.format == CQ_FORMAT_Q32_32.
+ * Activations are CHW, one cq_fixed16_t per element. A Linear layer may
+ * instead run from a CSR copy of its weights (cq_engine_attach_csr()).
+ *
+ * @traceability CQ-MATH-001 §3-§4, §6, CQ-STRUCT-001 §5.3
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#ifndef CQ_ENGINE_H
+#define CQ_ENGINE_H
+
+#include "cq_types.h"
+#include "profile.h"
+#include "thread_pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Default samples per weight pass for cq_engine_run_batch() */
+#define CQ_ENGINE_DEFAULT_BATCH     8u
+
+/** Weight tile budget when tile_rows is 0 (half of a typical L2) */
+#define CQ_ENGINE_TILE_BYTES        (128u * 1024u)
+
+/** Linear rows per parallel work item (fixed, independent of threads) */
+#define CQ_ENGINE_ROW_GRAIN         16u
+
+/** Fan-in per split-K slice (fixed, independent of threads) */
+#define CQ_ENGINE_SPLITK_GRAIN      1024u
+
+/** Most split-K slices per output block; wider fan-ins get wider slices */
+#define CQ_ENGINE_SPLITK_SLICES     32u
+
+/* ============================================================================
+ * Layer Geometry
+ * ============================================================================ */
+
+/**
+ * @brief Spatial geometry of a layer's input (not part of the serialised
+ *        header, which only carries the weight matrix shape).
+ *
+ * Linear, ReLU and Softmax use in_channels × in_height × in_width as the
+ * element count (height and width may be 1). Conv2D and pooling use all
+ * fields; pooling windows are kernel_h × kernel_w without padding.
+ */
+typedef struct {
+    uint32_t in_channels;
+    uint32_t in_height;
+    uint32_t in_width;
+    uint32_t kernel_h;
+    uint32_t kernel_w;
+    uint32_t stride;
+    uint32_t padding;               /**< Zero padding (Conv2D only) */
+    uint32_t _reserved;
+} cq_layer_shape_t;
+
+/**
+ * @brief Per-layer state filled by cq_engine_init() and cq_engine_run().
+ */
+typedef struct {
+    uint32_t in_len;                /**< Input elements */
+    uint32_t out_len;               /**< Output elements */
+    uint32_t out_channels;
+    uint32_t out_height;
+    uint32_t out_width;
+    uint32_t weight_max_mag;        /**< max |w_int| (overflow proof input) */
+    uint64_t macs;                  /**< Multiply-accumulates per inference */
+    const cq_csr_q16_t *csr;        /**< Sparse weights used instead of the blob */
+    cq_fault_flags_t faults;        /**< Faults raised by the last run */
+    bool fast_path;                 /**< Last run used plain int64 accumulation */
+    bool fused;                     /**< Last run also applied the next (ReLU) layer */
+    bool split_k;                   /**< Last run split the fan-in across workers */
+    bool wide_acc;                  /**< Last run accumulated in 128 bits */
+} cq_layer_state_t;
+
+/* ============================================================================
+ * Activation Planning
+ * ============================================================================ */
+
+/**
+ * @brief Arena placement of one intermediate activation (output of a layer).
+ */
+typedef struct {
+    uint32_t offset;                /**< Element offset into the arena */
+    uint32_t length;                /**< Elements */
+    uint32_t first_use;             /**< Producing layer */
+    uint32_t last_use;              /**< Last consuming layer */
+    uint32_t alias_of;              /**< Slot whose storage is shared */
+    bool in_place;                  /**< Written over its input (alias_of valid) */
+    uint8_t _reserved[3];
+} cq_activation_slot_t;
+
+/**
+ * @brief Memory report produced at plan time.
+ */
+typedef struct {
+    uint32_t arena_len;             /**< Arena elements after offset reuse */
+    uint32_t live_peak;             /**< Largest sum of simultaneously live tensors */
+    uint64_t naive_len;             /**< One buffer per intermediate activation */
+    uint32_t in_place_count;        /**< Layers run over their input */
+    uint32_t _reserved;
+} cq_activation_plan_t;
+
+/* ============================================================================
+ * Engine
+ * ============================================================================ */
+
+/**
+ * @brief Engine context. Caller-allocated; borrows headers, shapes, state
+ *        and blob for its lifetime.
+ */
+typedef struct {
+    const cq_layer_header_t *headers;
+    const cq_layer_shape_t *shapes;
+    cq_layer_state_t *state;
+    uint32_t layer_count;
+    uint32_t max_activation;        /**< Largest activation (elements) */
+    const uint8_t *blob;
+    size_t blob_size;
+    const cq_activation_slot_t *slots;  /**< Set by cq_engine_plan() */
+    uint32_t arena_len;             /**< Planned arena elements */
+    uint32_t batch_size;            /**< Samples per weight pass (B); default 8 */
+    uint32_t tile_rows;             /**< Weight rows per tile; 0 = fit CQ_ENGINE_TILE_BYTES */
+    cq_pool_t *pool;                /**< Worker pool; NULL = calling thread only */
+    cq_profile_t *profile;          /**< Per-layer profiler; NULL = disabled */
+    cq_fault_counts_t *fault_counts;    /**< Per-layer counting sinks [layer_count];
+                                             NULL = sticky bits only */
+    bool fast_path_enabled;         /**< Default true */
+    bool fusion_enabled;            /**< Fold ReLU into Linear/Conv2D; default true */
+    bool split_k_enabled;           /**< Split-K for few-output layers; default true */
+    bool wide_acc_enabled;          /**< 128-bit accumulation when the proof fails;
+                                         default false */
+} cq_engine_t;
+
+/**
+ * @brief Validate a model and prepare the engine.
+ *
+ * Checks per layer: symmetric specs, dyadic bias scale, blob bounds and
+ * element alignment, and that each layer's output feeds the next layer's
+ * input (element count and scale exponent). Records max |w| per layer for
+ * the run-time overflow proof.
+ *
+ * @param engine       Engine context to initialise.
+ * @param headers      Layer headers [layer_count].
+ * @param shapes       Layer geometry [layer_count].
+ * @param state        Output: Per-layer state [layer_count].
+ * @param layer_count  Number of layers (≥ 1).
+ * @param blob         Weight/bias blob (8-byte aligned).
+ * @param blob_size    Blob size in bytes.
+ * @return             0 on success, CQ_ERROR_NULL_POINTER,
+ *                     CQ_ERROR_DIMENSION_MISMATCH, CQ_ERROR_DYADIC_VIOLATION
+ *                     or CQ_FAULT_ASYMMETRIC_PARAMS.
+ */
+int cq_engine_init(cq_engine_t *engine,
+                   const cq_layer_header_t *headers,
+                   const cq_layer_shape_t *shapes,
+                   cq_layer_state_t *state,
+                   uint32_t layer_count,
+                   const uint8_t *blob,
+                   size_t blob_size);
+
+/**
+ * @brief Run a Linear layer from CSR weights instead of its dense blob
+ *        weights.
+ *
+ * The CSR matrix must hold the same non-zero weights as the blob, with
+ * ascending columns per row; zero products contribute nothing to either
+ * accumulation path, so outputs and faults are unchanged. The overflow
+ * proof then uses max_row_nnz as the fan-in, and macs counts non-zeros.
+ *
+ * @param engine  Initialised engine.
+ * @param layer   Linear layer index.
+ * @param csr     Sparse weights (borrowed), or NULL to return to dense.
+ * @return        0 on success, CQ_ERROR_NULL_POINTER,
+ *                CQ_ERROR_DIMENSION_MISMATCH if the layer is not Linear or
+ *                the matrix is malformed or of the wrong shape.
+ */
+int cq_engine_attach_csr(cq_engine_t *engine, uint32_t layer, const cq_csr_q16_t *csr);
+
+/**
+ * @brief Assign every intermediate activation an offset in one arena.
+ *
+ * Each layer output lives from its producing layer to its last consumer.
+ * Slots are placed largest first at the lowest offset that does not
+ * overlap a slot with an intersecting lifetime; ties go to the lower layer
+ * index, so the plan is deterministic. ReLU and Softmax write over their
+ * input. The engine then runs in the planned arena with no allocation.
+ *
+ * @param engine  Initialised engine; uses the plan until re-initialised.
+ * @param slots   Output: Placement per layer output [layer_count]; the last
+ *                layer writes the caller's output buffer (length 0).
+ * @param report  Output: Peak memory figures (may be NULL).
+ * @return        0 on success, CQ_ERROR_NULL_POINTER,
+ *                CQ_ERROR_DIMENSION_MISMATCH if the arena exceeds 2^32
+ *                elements.
+ */
+int cq_engine_plan(cq_engine_t *engine,
+                   cq_activation_slot_t *slots,
+                   cq_activation_plan_t *report);
+
+/**
+ * @brief Workspace needed by cq_engine_run() (bytes): the planned arena,
+ *        or two ping-pong buffers without a plan.
+ */
+size_t cq_engine_workspace_size(const cq_engine_t *engine);
+
+/**
+ * @brief Run one inference.
+ *
+ * Layers whose overflow proof holds for the actual input (n · max|w| ·
+ * max|x| < 2^63) accumulate in plain int64, which cannot saturate and is
+ * therefore bit-identical to the cq_mac_q16() reference path. With
+ * engine->profile set, every layer execution is recorded there.
+ *
+ * With a pool, layers are split by output rows (Conv2D: channels). When
+ * that leaves workers idle, the proof holds and the weights are dense
+ * row-major, the fan-in is split instead (split-K): workers reduce fixed
+ * slices of CQ_ENGINE_SPLITK_GRAIN inputs (Conv2D: whole input channels)
+ * and the partials are summed in slice order. Exact int64 addition is
+ * associative, so outputs and faults do not change.
+ *
+ * With engine->wide_acc_enabled, a dense row-major layer whose proof
+ * fails accumulates exactly in 128 bits instead of saturating
+ * (cq_layer_linear_rows_wide()), provided cq_overflow_is_safe128()
+ * holds. Outputs then differ from the reference path wherever it
+ * saturated an intermediate sum, which is why the mode is opt-in.
+ *
+ * With engine->fault_counts set, each layer's sink also receives one
+ * event per fault kind for every output element that raised it (a
+ * fused ReLU counts under its weighted layer). Workers count privately
+ * and their counts are summed after the layer, so totals do not depend
+ * on the thread count. Sinks accumulate across runs until the caller
+ * clears them (cq_fault_counts_clear()); the same applies to
+ * cq_engine_run_batch() and cq_engine_run_layers().
+ *
+ * @param engine     Initialised engine.
+ * @param input      Input activation [state[0].in_len].
+ * @param output     Output activation [state[layer_count-1].out_len].
+ * @param workspace  Scratch of cq_engine_workspace_size() bytes, aligned
+ *                   for cq_fixed16_t. Nothing is allocated during the run.
+ * @param faults     Output: Faults of all layers merged.
+ * @return           0 on success, CQ_ERROR_NULL_POINTER.
+ */
+int cq_engine_run(cq_engine_t *engine,
+                  const cq_fixed16_t *input,
+                  cq_fixed16_t *output,
+                  void *workspace,
+                  cq_fault_flags_t *faults);
+
+/**
+ * @brief Workspace needed by cq_engine_run_batch() (bytes): the
+ *        single-sample workspace for batch_size samples.
+ */
+size_t cq_engine_batch_workspace_size(const cq_engine_t *engine);
+
+/**
+ * @brief Run count inferences, batch_size samples at a time.
+ *
+ * Linear layers keep each weight tile resident while all samples of the
+ * batch pass over it. Every output is computed by the same operation
+ * sequence as cq_engine_run(), so results are bit-identical to running
+ * the samples one by one.
+ *
+ * @param engine     Initialised engine.
+ * @param inputs     Inputs [count][state[0].in_len].
+ * @param outputs    Outputs [count][state[layer_count-1].out_len].
+ * @param count      Number of samples.
+ * @param workspace  Scratch of cq_engine_batch_workspace_size() bytes.
+ * @param faults     Output: Faults of all layers and samples merged.
+ * @return           0 on success, CQ_ERROR_NULL_POINTER.
+ */
+int cq_engine_run_batch(cq_engine_t *engine,
+                        const cq_fixed16_t *inputs,
+                        cq_fixed16_t *outputs,
+                        size_t count,
+                        void *workspace,
+                        cq_fault_flags_t *faults);
+
+/**
+ * @brief Workspace needed by cq_engine_run_layers() (bytes): two buffers
+ *        of the largest activation passed inside [first, end).
+ */
+size_t cq_engine_layers_workspace_size(const cq_engine_t *engine, uint32_t first, uint32_t end);
+
+/**
+ * @brief Run layers [first, end) for one sample on the calling thread.
+ *
+ * The building block of pipelined execution: neither the pool, the
+ * activation plan nor the profiler is used, and ReLU fusion stays inside
+ * the range. Faults
+ * accumulate in state[first..end-1].faults and are not cleared, so
+ * disjoint ranges may run concurrently on different threads.
+ *
+ * @param engine     Initialised engine.
+ * @param first      First layer.
+ * @param end        One past the last layer (≤ layer_count).
+ * @param input      Input of layer first [state[first].in_len].
+ * @param output     Output of layer end-1 [state[end-1].out_len].
+ * @param workspace  Scratch of cq_engine_layers_workspace_size() bytes
+ *                   (may be NULL for a single layer).
+ * @return           0 on success, CQ_ERROR_NULL_POINTER,
+ *                   CQ_ERROR_DIMENSION_MISMATCH for an empty or
+ *                   out-of-range layer range.
+ */
+int cq_engine_run_layers(cq_engine_t *engine,
+                         uint32_t first,
+                         uint32_t end,
+                         const cq_fixed16_t *input,
+                         cq_fixed16_t *output,
+                         void *workspace);
+
+/* ============================================================================
+ * Layer Kernels
+ * ============================================================================ */
+
+/**
+ * @brief Work applied to each output of a Linear/Conv2D kernel while the
+ *        accumulator is still in a register.
+ *
+ * The sequence is exactly that of the separate layers (requantize, ReLU,
+ * ReLU rescale), so outputs and faults are bit-identical to running the
+ * ReLU layer on its own; each output is simply written once.
+ *
+ * With counts set, every output adds one event per fault kind raised
+ * while computing it (accumulation, bias, requantization, ReLU rescale),
+ * in addition to setting the sticky bits. The counts belong to one
+ * thread; kernels running concurrently need separate sinks.
+ */
+typedef struct {
+    bool relu;                      /**< Clamp negatives to zero */
+    uint8_t _pad[3];
+    int32_t relu_shift;             /**< ReLU input exp − ReLU output exp */
+    cq_fault_counts_t *counts;      /**< Per-output fault counting, or NULL */
+} cq_epilogue_t;
+
+/**
+ * @brief Linear layer: y = requant(W·x + b).
+ *
+ * @param hdr     Layer header (weight_rows outputs, weight_cols inputs).
+ * @param W       Weights [weight_rows][weight_cols], int32 or int16 per
+ *                weight_spec.storage (widened on load).
+ * @param bias    Bias (int32 or int64 per bias_spec.format), or NULL.
+ * @param x       Input [weight_cols].
+ * @param y       Output [weight_rows].
+ * @param fast    Use plain int64 accumulation (overflow proof holds).
+ * @param epi     Fused epilogue, or NULL.
+ * @param faults  Fault flags.
+ */
+void cq_layer_linear(const cq_layer_header_t *hdr,
+                     const void *W,
+                     const void *bias,
+                     const cq_fixed16_t *x,
+                     cq_fixed16_t *y,
+                     bool fast,
+                     const cq_epilogue_t *epi,
+                     cq_fault_flags_t *faults);
+
+/**
+ * @brief Linear rows [row_begin, row_end) only; each row is one complete
+ *        reduction, so row ranges can run on different threads.
+ */
+void cq_layer_linear_rows(const cq_layer_header_t *hdr,
+                          const void *W,
+                          const void *bias,
+                          const cq_fixed16_t *x,
+                          cq_fixed16_t *y,
+                          uint32_t row_begin,
+                          uint32_t row_end,
+                          bool fast,
+                          const cq_epilogue_t *epi,
+                          cq_fault_flags_t *faults);
+
+/**
+ * @brief Sparse Linear layer (GEMV over CSR weights) for rows
+ *        [row_begin, row_end).
+ *
+ * Each row accumulates only its non-zero products, in column order, so
+ * the accumulator equals that of cq_layer_linear_rows() on the dense
+ * matrix; fast must come from a proof over csr->max_row_nnz.
+ */
+void cq_layer_linear_csr_rows(const cq_layer_header_t *hdr,
+                              const cq_csr_q16_t *csr,
+                              const void *bias,
+                              const cq_fixed16_t *x,
+                              cq_fixed16_t *y,
+                              uint32_t row_begin,
+                              uint32_t row_end,
+                              bool fast,
+                              const cq_epilogue_t *epi,
+                              cq_fault_flags_t *faults);
+
+/**
+ * @brief Sparse Linear layer over all rows.
+ */
+void cq_layer_linear_csr(const cq_layer_header_t *hdr,
+                         const cq_csr_q16_t *csr,
+                         const void *bias,
+                         const cq_fixed16_t *x,
+                         cq_fixed16_t *y,
+                         bool fast,
+                         const cq_epilogue_t *epi,
+                         cq_fault_flags_t *faults);
+
+/**
+ * @brief Linear rows [row_begin, row_end) from panel-packed weights
+ *        (CQ_WEIGHT_LAYOUT_PANEL).
+ *
+ * Whole panels accumulate CQ_PANEL_ROWS rows at once, loading each input
+ * once per panel; rows of a panel cut by the range run one by one. Every
+ * row still accumulates in column order, so outputs and faults equal
+ * cq_layer_linear_rows() on the row-major matrix.
+ *
+ * @param Wp  Packed weights [⌈weight_rows/P⌉][weight_cols][P].
+ */
+void cq_layer_linear_panel_rows(const cq_layer_header_t *hdr,
+                                const cq_fixed16_t *Wp,
+                                const void *bias,
+                                const cq_fixed16_t *x,
+                                cq_fixed16_t *y,
+                                uint32_t row_begin,
+                                uint32_t row_end,
+                                bool fast,
+                                const cq_epilogue_t *epi,
+                                cq_fault_flags_t *faults);
+
+/**
+ * @brief Panel-packed Linear layer over all rows.
+ */
+void cq_layer_linear_panel(const cq_layer_header_t *hdr,
+                           const cq_fixed16_t *Wp,
+                           const void *bias,
+                           const cq_fixed16_t *x,
+                           cq_fixed16_t *y,
+                           bool fast,
+                           const cq_epilogue_t *epi,
+                           cq_fault_flags_t *faults);
+
+/**
+ * @brief Linear layer over a batch, weight-stationary.
+ *
+ * Rows are processed in tiles of tile_rows; each tile is applied to all
+ * batch samples before moving on, so it is read from memory once per
+ * batch instead of once per sample.
+ *
+ * @param X          Inputs [batch][weight_cols].
+ * @param Y          Outputs [batch][weight_rows].
+ * @param batch      Number of samples.
+ * @param tile_rows  Rows per weight tile (≥ 1).
+ */
+void cq_layer_linear_batch(const cq_layer_header_t *hdr,
+                           const void *W,
+                           const void *bias,
+                           const cq_fixed16_t *X,
+                           cq_fixed16_t *Y,
+                           uint32_t batch,
+                           uint32_t tile_rows,
+                           bool fast,
+                           const cq_epilogue_t *epi,
+                           cq_fault_flags_t *faults);
+
+/**
+ * @brief cq_layer_linear_batch() restricted to rows [row_begin, row_end);
+ *        tiles start at row_begin.
+ */
+void cq_layer_linear_batch_rows(const cq_layer_header_t *hdr,
+                                const void *W,
+                                const void *bias,
+                                const cq_fixed16_t *X,
+                                cq_fixed16_t *Y,
+                                uint32_t batch,
+                                uint32_t tile_rows,
+                                uint32_t row_begin,
+                                uint32_t row_end,
+                                bool fast,
+                                const cq_epilogue_t *epi,
+                                cq_fault_flags_t *faults);
+
+/**
+ * @brief 2D convolution (CHW, zero padding).
+ */
+void cq_layer_conv2d(const cq_layer_header_t *hdr,
+                     const cq_layer_shape_t *shape,
+                     const void *W,
+                     const void *bias,
+                     const cq_fixed16_t *x,
+                     cq_fixed16_t *y,
+                     bool fast,
+                     const cq_epilogue_t *epi,
+                     cq_fault_flags_t *faults);
+
+/**
+ * @brief 2D convolution for output channels [oc_begin, oc_end) only.
+ */
+void cq_layer_conv2d_channels(const cq_layer_header_t *hdr,
+                              const cq_layer_shape_t *shape,
+                              const void *W,
+                              const void *bias,
+                              const cq_fixed16_t *x,
+                              cq_fixed16_t *y,
+                              uint32_t oc_begin,
+                              uint32_t oc_end,
+                              bool fast,
+                              const cq_epilogue_t *epi,
+                              cq_fault_flags_t *faults);
+
+/**
+ * @brief Linear rows [row_begin, row_end) with an exact 128-bit
+ *        accumulator, for layers whose 64-bit overflow proof fails.
+ *
+ * Products are summed in int64 over runs of chunk columns and each
+ * partial is folded into a cq_accum128_t; the bias is added exactly and
+ * cq_requantize128() rounds RNE. No partial sum saturates, so the output
+ * is the correctly rounded value of the true dot product, saturated to
+ * int32 only at the end. Where the 64-bit proof holds this equals
+ * cq_layer_linear_rows().
+ *
+ * @param chunk  cq_acc128_chunk_len() of the layer's proof (≥ 1).
+ */
+void cq_layer_linear_rows_wide(const cq_layer_header_t *hdr,
+                               const void *W,
+                               const void *bias,
+                               const cq_fixed16_t *x,
+                               cq_fixed16_t *y,
+                               uint32_t row_begin,
+                               uint32_t row_end,
+                               uint32_t chunk,
+                               const cq_epilogue_t *epi,
+                               cq_fault_flags_t *faults);
+
+/**
+ * @brief Conv2D output channels [oc_begin, oc_end) with an exact 128-bit
+ *        accumulator (see cq_layer_linear_rows_wide()).
+ */
+void cq_layer_conv2d_channels_wide(const cq_layer_header_t *hdr,
+                                   const cq_layer_shape_t *shape,
+                                   const void *W,
+                                   const void *bias,
+                                   const cq_fixed16_t *x,
+                                   cq_fixed16_t *y,
+                                   uint32_t oc_begin,
+                                   uint32_t oc_end,
+                                   uint32_t chunk,
+                                   const cq_epilogue_t *epi,
+                                   cq_fault_flags_t *faults);
+
+/**
+ * @brief Partial accumulators of Linear rows [row_begin, row_end) over
+ *        columns [col_begin, col_end) (split-K).
+ *
+ * Plain int64 accumulation, valid only when the layer's overflow proof
+ * holds: every partial is then bounded by the proof too, and the sum of
+ * the partials over disjoint column ranges equals the single-pass
+ * accumulator bit for bit, in any order.
+ *
+ * @param acc  Output: [row_end − row_begin].
+ */
+void cq_layer_linear_partial(const cq_layer_header_t *hdr,
+                             const void *W,
+                             const cq_fixed16_t *x,
+                             uint32_t row_begin,
+                             uint32_t row_end,
+                             uint32_t col_begin,
+                             uint32_t col_end,
+                             cq_accum64_t *acc);
+
+/**
+ * @brief Conv2D partial accumulators of output channels [oc_begin, oc_end)
+ *        over input channels [ic_begin, ic_end) (split-K, proof required).
+ *
+ * @param acc  Output: [oc_end − oc_begin][out_height][out_width].
+ */
+void cq_layer_conv2d_partial(const cq_layer_header_t *hdr,
+                             const cq_layer_shape_t *shape,
+                             const void *W,
+                             const cq_fixed16_t *x,
+                             uint32_t oc_begin,
+                             uint32_t oc_end,
+                             uint32_t ic_begin,
+                             uint32_t ic_end,
+                             cq_accum64_t *acc);
+
+/**
+ * @brief Bias, requantization and epilogue of complete accumulators, the
+ *        tail of a split-K reduction.
+ *
+ * Output (row_begin + k) · per_row + j comes from acc[k · per_row + j]
+ * and the bias of row row_begin + k, as in the single-pass kernels
+ * (per_row is 1 for Linear, out_height · out_width for Conv2D).
+ */
+void cq_layer_finish_rows(const cq_layer_header_t *hdr,
+                          const void *bias,
+                          const cq_accum64_t *acc,
+                          cq_fixed16_t *y,
+                          uint32_t row_begin,
+                          uint32_t row_end,
+                          uint32_t per_row,
+                          const cq_epilogue_t *epi,
+                          cq_fault_flags_t *faults);
+
+/**
+ * @brief ReLU (exact, CQ-MATH-001 §4.1), then rescale to output_spec.
+ *
+ * counts, if not NULL, receives per-output fault events as in
+ * cq_epilogue_t; the same holds for pooling and Softmax.
+ */
+void cq_layer_relu(const cq_layer_header_t *hdr,
+                   const cq_fixed16_t *x,
+                   cq_fixed16_t *y,
+                   size_t n,
+                   cq_fault_flags_t *faults,
+                   cq_fault_counts_t *counts);
+
+/**
+ * @brief Max or average pooling (average rounds RNE).
+ */
+void cq_layer_pool(const cq_layer_header_t *hdr,
+                   const cq_layer_shape_t *shape,
+                   const cq_fixed16_t *x,
+                   cq_fixed16_t *y,
+                   cq_fault_flags_t *faults,
+                   cq_fault_counts_t *counts);
+
+/**
+ * @brief Softmax with base-2 exponential and reciprocal multiply
+ *        (CQ-MATH-001 §4.2).
+ */
+void cq_layer_softmax(const cq_layer_header_t *hdr,
+                      const cq_fixed16_t *x,
+                      cq_fixed16_t *y,
+                      size_t n,
+                      cq_fault_flags_t *faults,
+                      cq_fault_counts_t *counts);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CQ_ENGINE_H */
@@ -0,0 +1,279 @@
+/**
+ * @file pipeline.h
+ * @project Certifiable-Quant
+ * @brief Layer-pipelined streaming inference
+ *
+ * The layer sequence is cut into contiguous stages, one thread each.
+ * Stages hand activation buffers to each other through lock-free
+ * single-producer/single-consumer queues, so a new sample can enter stage
+ * 0 while earlier samples are still in later stages. Throughput is bound
+ * by the slowest stage instead of the whole model, without batching delay.
+ *
+ *   caller ─▶ [link 0] ─▶ stage 0 ─▶ [link 1] ─▶ ... ─▶ stage S-1 ─▶ [link S] ─▶ caller
+ *
+ * Each link owns `depth` buffers that circulate between a "full" queue
+ * (producer → consumer) and a "free" queue (consumer → producer). Every
+ * stage runs its layers with cq_engine_run_layers(), and samples leave in
+ * the order they entered, so outputs are bit-identical to cq_engine_run().
+ *
+ * Stages are balanced by per-layer cost (MACs from the header dimensions
+ * plus one per output element) so that the most expensive stage is as
+ * cheap as possible. A Linear/Conv2D layer and the ReLU fused into it are
+ * never split.
+ *
+ * @traceability CQ-MATH-001 §6, CQ-STRUCT-001 §5.3
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#ifndef CQ_PIPELINE_H
+#define CQ_PIPELINE_H
+
+#include "cq_types.h"
+#include "engine.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum pipeline stages (threads) */
+#define CQ_PIPELINE_MAX_STAGES      16u
+
+/** Buffers per link when depth is 0 */
+#define CQ_PIPELINE_DEFAULT_DEPTH   4u
+
+/** Maximum SPSC queue capacity (power of two) */
+#define CQ_SPSC_MAX_DEPTH           64u
+
+/** Producer and consumer indices live on separate cache lines */
+#define CQ_SPSC_LINE_BYTES          64u
+
+/** Lock-free with GNU atomic builtins; otherwise the queue lock is used */
+#if defined(__GNUC__) || defined(__clang__)
+#define CQ_SPSC_LOCK_FREE           1
+#else
+#define CQ_SPSC_LOCK_FREE           0
+#endif
+
+/* ============================================================================
+ * SPSC Queue
+ * ============================================================================ */
+
+/**
+ * @brief Bounded single-producer/single-consumer queue of uint32_t items.
+ *
+ * tail and head run freely and wrap modulo 2^32; the queue is full when
+ * tail − head == capacity. Only the producer writes tail and only the
+ * consumer writes head (release), each reading the other's (acquire).
+ */
+typedef struct {
+    uint32_t tail;                  /**< Next write position (producer) */
+    uint8_t _pad0[CQ_SPSC_LINE_BYTES - sizeof(uint32_t)];
+    uint32_t head;                  /**< Next read position (consumer) */
+    uint8_t _pad1[CQ_SPSC_LINE_BYTES - sizeof(uint32_t)];
+    uint32_t capacity;
+    uint32_t mask;                  /**< capacity − 1 */
+    uint32_t items[CQ_SPSC_MAX_DEPTH];
+    pthread_mutex_t lock;           /**< Used only when !CQ_SPSC_LOCK_FREE */
+} cq_spsc_queue_t;
+
+/**
+ * @brief Initialise an empty queue.
+ *
+ * @param q         Queue.
+ * @param capacity  Power of two in [1, CQ_SPSC_MAX_DEPTH].
+ * @return          0 on success, CQ_ERROR_NULL_POINTER,
+ *                  CQ_ERROR_DIMENSION_MISMATCH for a bad capacity,
+ *                  CQ_ERROR_IO if the fallback lock cannot be created.
+ */
+int cq_spsc_init(cq_spsc_queue_t *q, uint32_t capacity);
+
+/**
+ * @brief Release the queue (fallback lock only).
+ */
+void cq_spsc_destroy(cq_spsc_queue_t *q);
+
+/**
+ * @brief Append an item (producer thread only).
+ * @return true if appended, false if the queue is full.
+ */
+bool cq_spsc_push(cq_spsc_queue_t *q, uint32_t item);
+
+/**
+ * @brief Remove the oldest item (consumer thread only).
+ * @return true if an item was removed, false if the queue is empty.
+ */
+bool cq_spsc_pop(cq_spsc_queue_t *q, uint32_t *item);
+
+/* ============================================================================
+ * Stage Planning
+ * ============================================================================ */
+
+/**
+ * @brief Layers [first_layer, end_layer) run by one stage thread.
+ */
+typedef struct {
+    uint32_t first_layer;
+    uint32_t end_layer;             /**< One past the last layer */
+    uint64_t cost;                  /**< Σ (MACs + output elements) */
+    uint32_t in_len;                /**< Elements received */
+    uint32_t out_len;               /**< Elements produced */
+} cq_pipeline_stage_t;
+
+/**
+ * @brief Split the layers into at most max_stages contiguous stages that
+ *        minimise the cost of the most expensive stage.
+ *
+ * The minimum bottleneck is found by bisection over the cost, then stages
+ * are filled greedily up to it, so the plan is deterministic. Fewer than
+ * max_stages stages are produced when the model has fewer layers (or
+ * fused layer pairs) or when more stages would not lower the bottleneck.
+ *
+ * @param engine       Initialised engine (fusion_enabled is honoured).
+ * @param max_stages   Stage limit (1 … CQ_PIPELINE_MAX_STAGES).
+ * @param stages       Output: Stages [max_stages].
+ * @param stage_count  Output: Stages used.
+ * @return             0 on success, CQ_ERROR_NULL_POINTER,
+ *                     CQ_ERROR_DIMENSION_MISMATCH for a bad max_stages.
+ */
+int cq_pipeline_plan(const cq_engine_t *engine,
+                     uint32_t max_stages,
+                     cq_pipeline_stage_t *stages,
+                     uint32_t *stage_count);
+
+/* ============================================================================
+ * Pipeline
+ * ============================================================================ */
+
+/**
+ * @brief Activation buffers passed between two neighbouring stages.
+ */
+typedef struct {
+    cq_spsc_queue_t full;           /**< Filled buffers, producer → consumer */
+    cq_spsc_queue_t free;           /**< Emptied buffers, consumer → producer */
+    cq_fixed16_t *buffers;          /**< [depth][len] in the workspace */
+    uint32_t len;                   /**< Elements per buffer */
+    uint32_t _reserved;
+} cq_pipeline_link_t;
+
+/**
+ * @brief Start argument of one stage thread.
+ */
+typedef struct {
+    void *pipeline;                 /**< Owning cq_pipeline_t */
+    uint32_t stage;
+    uint32_t _reserved;
+} cq_pipeline_worker_t;
+
+/**
+ * @brief Pipeline context. Caller-allocated; owns the engine between
+ *        cq_pipeline_start() and cq_pipeline_stop().
+ */
+typedef struct {
+    cq_engine_t *engine;
+    cq_pipeline_stage_t stages[CQ_PIPELINE_MAX_STAGES];
+    cq_pipeline_link_t links[CQ_PIPELINE_MAX_STAGES + 1];
+    cq_fixed16_t *scratch[CQ_PIPELINE_MAX_STAGES];
+    pthread_t threads[CQ_PIPELINE_MAX_STAGES];
+    cq_pipeline_worker_t worker_args[CQ_PIPELINE_MAX_STAGES];
+    pthread_mutex_t lock;           /**< Guards stop when !CQ_SPSC_LOCK_FREE */
+    uint32_t stage_count;
+    uint32_t depth;                 /**< Buffers per link */
+    uint32_t started;               /**< Stage threads running */
+    uint32_t stop;                  /**< Set (atomically) to end the stage threads */
+    bool ready;                     /**< Queues initialised by cq_pipeline_start() */
+    uint8_t _reserved[7];
+    uint64_t pushed;                /**< Samples accepted (caller thread) */
+    uint64_t popped;                /**< Samples returned (caller thread) */
+} cq_pipeline_t;
+
+/**
+ * @brief Plan the stages; no threads are started.
+ *
+ * @param pipe        Pipeline to initialise.
+ * @param engine      Initialised engine.
+ * @param max_stages  Stage threads (0 = online CPUs, capped at
+ *                    CQ_PIPELINE_MAX_STAGES).
+ * @param depth       Buffers per link: power of two ≤ CQ_SPSC_MAX_DEPTH,
+ *                    0 = CQ_PIPELINE_DEFAULT_DEPTH.
+ * @return            0 on success, CQ_ERROR_NULL_POINTER,
+ *                    CQ_ERROR_DIMENSION_MISMATCH.
+ */
+int cq_pipeline_init(cq_pipeline_t *pipe,
+                     cq_engine_t *engine,
+                     uint32_t max_stages,
+                     uint32_t depth);
+
+/**
+ * @brief Workspace needed by cq_pipeline_start() (bytes): the link
+ *        buffers and each stage's scratch.
+ */
+size_t cq_pipeline_workspace_size(const cq_pipeline_t *pipe);
+
+/**
+ * @brief Start one thread per stage and clear the engine's layer faults.
+ *
+ * @param pipe       Initialised pipeline.
+ * @param workspace  cq_pipeline_workspace_size() bytes, aligned for
+ *                   cq_fixed16_t, untouched by the caller until stopped.
+ * @return           0 on success, CQ_ERROR_NULL_POINTER,
+ *                   CQ_ERROR_DIMENSION_MISMATCH if already started,
+ *                   CQ_ERROR_IO if a queue or thread could not be created.
+ */
+int cq_pipeline_start(cq_pipeline_t *pipe, void *workspace);
+
+/**
+ * @brief Offer one sample without blocking.
+ *
+ * @param input  Input activation [state[0].in_len], copied before return.
+ * @return       true if accepted, false if the first link is full.
+ */
+bool cq_pipeline_try_push(cq_pipeline_t *pipe, const cq_fixed16_t *input);
+
+/**
+ * @brief Collect the oldest finished sample without blocking.
+ *
+ * @param output  Output activation [state[layer_count-1].out_len].
+ * @return        true if a sample was returned, false if none is ready.
+ */
+bool cq_pipeline_try_pop(cq_pipeline_t *pipe, cq_fixed16_t *output);
+
+/**
+ * @brief Stream count samples through the pipeline and wait for all of
+ *        them; bit-identical to calling cq_engine_run() per sample.
+ *
+ * @param pipe     Started pipeline with no samples in flight.
+ * @param inputs   Inputs [count][state[0].in_len].
+ * @param outputs  Outputs [count][state[layer_count-1].out_len].
+ * @param count    Number of samples.
+ * @param faults   Output: Faults of all layers and samples merged.
+ * @return         0 on success, CQ_ERROR_NULL_POINTER,
+ *                 CQ_ERROR_DIMENSION_MISMATCH if the pipeline is not
+ *                 started or samples are in flight.
+ */
+int cq_pipeline_run(cq_pipeline_t *pipe,
+                    const cq_fixed16_t *inputs,
+                    cq_fixed16_t *outputs,
+                    size_t count,
+                    cq_fault_flags_t *faults);
+
+/**
+ * @brief Faults of every sample returned since start (or the last
+ *        cq_pipeline_run()). Only meaningful with no samples in flight.
+ */
+void cq_pipeline_faults(const cq_pipeline_t *pipe, cq_fault_flags_t *faults);
+
+/**
+ * @brief Stop and join the stage threads; samples still in flight are
+ *        discarded.
+ */
+void cq_pipeline_stop(cq_pipeline_t *pipe);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CQ_PIPELINE_H */
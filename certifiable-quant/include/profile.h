@@ -0,0 +1,172 @@
+/**
+ * @file profile.h
+ * @project Certifiable-Quant
+ * @brief Per-layer execution profiler
+ *
+ * A cq_profile_t attached to an engine (engine->profile) records, for
+ * every layer executed by cq_engine_run() and cq_engine_run_batch(), the
+ * wall time, hardware counter ticks, multiply-accumulates, bytes moved
+ * and the number of samples. Totals accumulate per layer; each execution
+ * is also appended to an optional event buffer, which
+ * cq_profile_write_trace() dumps as Chrome trace JSON (chrome://tracing,
+ * Perfetto).
+ *
+ * With engine->profile NULL (the default) the engine pays one pointer
+ * test per layer. Profiling never changes outputs or faults.
+ *
+ * Cycle counts come from the time-stamp counter (rdtsc) on x86-64 and the
+ * virtual counter (cntvct_el0) on AArch64. Both tick at a fixed rate that
+ * is not necessarily the core clock. Elsewhere they read 0.
+ *
+ * Bytes moved is the compulsory traffic of one execution: the layer's
+ * stored weights (CSR arrays when attached) and biases once, plus its
+ * input and output activations for every sample.
+ *
+ * @traceability CQ-MATH-001 §6
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#ifndef CQ_PROFILE_H
+#define CQ_PROFILE_H
+
+#include "cq_types.h"
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Hardware counter available through cq_profile_cycles() */
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__))
+#define CQ_PROFILE_HAS_CYCLES       1
+#else
+#define CQ_PROFILE_HAS_CYCLES       0
+#endif
+
+/**
+ * @brief Totals of one layer over every recorded execution.
+ *
+ * A layer run with a fused ReLU records the pair under the weighted
+ * layer; the ReLU's own entry stays zero.
+ */
+typedef struct {
+    uint64_t runs;                  /**< Executions (a batch counts once) */
+    uint64_t samples;               /**< Samples processed */
+    uint64_t wall_ns;               /**< Wall time */
+    uint64_t cycles;                /**< Counter ticks (0 without a counter) */
+    uint64_t macs;                  /**< Multiply-accumulates */
+    uint64_t bytes;                 /**< Bytes moved */
+} cq_layer_profile_t;
+
+/**
+ * @brief One layer execution.
+ */
+typedef struct {
+    uint64_t start_ns;              /**< Since cq_profile_init() / reset */
+    uint64_t wall_ns;
+    uint64_t cycles;
+    uint64_t macs;
+    uint64_t bytes;
+    uint32_t layer;
+    uint32_t samples;
+    bool fused;                     /**< Included the following ReLU */
+    uint8_t _reserved[7];
+} cq_profile_event_t;
+
+/**
+ * @brief Profiler state. Caller-allocated, with caller-owned arrays.
+ */
+typedef struct {
+    cq_layer_profile_t *layers;     /**< Totals [layer_count] */
+    cq_profile_event_t *events;     /**< Event buffer, or NULL */
+    uint32_t layer_count;
+    uint32_t event_capacity;
+    uint32_t event_count;           /**< Events recorded */
+    uint32_t _reserved;
+    uint64_t events_dropped;        /**< Executions after the buffer filled */
+    uint64_t epoch_ns;              /**< cq_profile_now_ns() at init / reset */
+} cq_profile_t;
+
+/**
+ * @brief Initialise a profiler.
+ *
+ * @param prof            Profiler.
+ * @param layers          Per-layer totals [layer_count].
+ * @param layer_count     Layers of the profiled engine.
+ * @param events          Event buffer [event_capacity], or NULL.
+ * @param event_capacity  Events kept; later executions only add totals.
+ * @return                0 on success, CQ_ERROR_NULL_POINTER,
+ *                        CQ_ERROR_DIMENSION_MISMATCH for zero layers.
+ */
+int cq_profile_init(cq_profile_t *prof,
+                    cq_layer_profile_t *layers,
+                    uint32_t layer_count,
+                    cq_profile_event_t *events,
+                    uint32_t event_capacity);
+
+/**
+ * @brief Clear totals and events, and restart the trace clock.
+ */
+void cq_profile_reset(cq_profile_t *prof);
+
+/**
+ * @brief Monotonic wall clock (ns).
+ */
+uint64_t cq_profile_now_ns(void);
+
+/**
+ * @brief Hardware counter ticks, or 0 if !CQ_PROFILE_HAS_CYCLES.
+ */
+uint64_t cq_profile_cycles(void);
+
+/**
+ * @brief Achieved GOPS (one MAC = 2 operations); 0 when wall_ns is 0.
+ */
+double cq_profile_gops(uint64_t macs, uint64_t wall_ns);
+
+/**
+ * @brief Record one layer execution (called by the engine).
+ *
+ * @param prof          Profiler.
+ * @param layer         Layer index (< layer_count, else ignored).
+ * @param samples       Samples processed.
+ * @param fused         The following ReLU ran in the same kernel.
+ * @param macs          Multiply-accumulates performed.
+ * @param bytes         Bytes moved.
+ * @param start_ns      cq_profile_now_ns() before the layer.
+ * @param start_cycles  cq_profile_cycles() before the layer.
+ */
+void cq_profile_record(cq_profile_t *prof,
+                       uint32_t layer,
+                       uint32_t samples,
+                       bool fused,
+                       uint64_t macs,
+                       uint64_t bytes,
+                       uint64_t start_ns,
+                       uint64_t start_cycles);
+
+/**
+ * @brief Write the recorded events as Chrome trace JSON.
+ *
+ * One complete ("X") event per layer execution, named by layer index and
+ * type, with macs, bytes, cycles, samples and GOPS as arguments.
+ *
+ * @param prof     Profiler.
+ * @param headers  Headers of the profiled engine [prof->layer_count].
+ * @param out      Destination stream.
+ * @return         0 on success, CQ_ERROR_NULL_POINTER,
+ *                 CQ_ERROR_IO if writing failed.
+ */
+int cq_profile_write_trace(const cq_profile_t *prof,
+                           const cq_layer_header_t *headers,
+                           FILE *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CQ_PROFILE_H */
@@ -49,6 +49,60 @@ void cq_sha256_final(cq_sha256_ctx_t *ctx, uint8_t digest[CQ_SHA256_DIGEST_SIZE]
  */
 void cq_sha256(const void *data, size_t len, uint8_t digest[CQ_SHA256_DIGEST_SIZE]);
 
+/* ============================================================================
+ * Streaming File Hashing
+ * ============================================================================ */
+
+/** @brief Read size for the double-buffered reader (1 MiB, page aligned). */
+#define CQ_SHA256_IO_CHUNK      ((size_t)1 << 20)
+
+/** @brief Regular files at least this large are hashed through mmap. */
+#define CQ_SHA256_MMAP_MIN      ((size_t)1 << 20)
+
+/**
+ * @brief Hash the contents of an open file descriptor.
+ *
+ * Regular files are hashed in full, independent of the current file offset:
+ * large files are mapped read-only and hashed window by window while the
+ * kernel is asked to read ahead the next window. Pipes, sockets and files
+ * that cannot be mapped are streamed to EOF by a reader thread into two
+ * aligned buffers, so the next pread()/read() overlaps compression of the
+ * current buffer. The descriptor is not closed.
+ *
+ * @param fd      Open, readable file descriptor.
+ * @param digest  Output: SHA-256 digest.
+ * @return        0 on success, CQ_ERROR_NULL_POINTER, CQ_ERROR_IO on read/map
+ *                failure.
+ */
+int cq_sha256_fd(int fd, uint8_t digest[CQ_SHA256_DIGEST_SIZE]);
+
+/**
+ * @brief cq_sha256_fd() without mapping: always the double-buffered reader.
+ *
+ * A mapped file that another process truncates raises SIGBUS in the
+ * hasher; reading with pread() instead only sees a short file. Use this
+ * for files that may change while they are hashed. Regular files are
+ * still hashed in full from offset 0.
+ *
+ * @param fd      Open, readable file descriptor.
+ * @param digest  Output: SHA-256 digest.
+ * @return        0 on success, CQ_ERROR_NULL_POINTER, CQ_ERROR_IO on read
+ *                failure.
+ */
+int cq_sha256_fd_read(int fd, uint8_t digest[CQ_SHA256_DIGEST_SIZE]);
+
+/**
+ * @brief Hash the contents of a file by path.
+ *
+ * Convenience wrapper over cq_sha256_fd() for filling source_model_hash,
+ * target_model_hash and dataset_hash.
+ *
+ * @param path    File path.
+ * @param digest  Output: SHA-256 digest.
+ * @return        0 on success, CQ_ERROR_NULL_POINTER or CQ_ERROR_IO.
+ */
+int cq_sha256_file(const char *path, uint8_t digest[CQ_SHA256_DIGEST_SIZE]);
+
 #ifdef __cplusplus
 }
 #endif
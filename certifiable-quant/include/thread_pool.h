@@ -0,0 +1,123 @@
+/**
+ * @file thread_pool.h
+ * @project Certifiable-Quant
+ * @brief Deterministic work-partitioning thread pool
+ *
+ * A range [0, n) is cut into chunks of a fixed grain. Chunk boundaries
+ * depend only on n and grain, never on the thread count, and each chunk
+ * owns a disjoint set of outputs (rows, tiles, tensors). Reductions are
+ * never split across chunks, so results are bit-identical for any thread
+ * count, including the single-threaded mode (CQ-MATH-001 §6).
+ *
+ * Fault flags are collected per worker and merged by the caller; the
+ * merge is a bitwise OR and therefore order-independent.
+ *
+ * @traceability CQ-MATH-001 §6
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#ifndef CQ_THREAD_POOL_H
+#define CQ_THREAD_POOL_H
+
+#include "cq_types.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum threads in a pool (including the calling thread) */
+#define CQ_POOL_MAX_THREADS     64u
+
+/**
+ * @brief Chunk body: process items [begin, end) as worker `worker`
+ *        (0 ≤ worker < cq_pool_threads()).
+ */
+typedef void (*cq_pool_fn_t)(void *ctx, size_t begin, size_t end, uint32_t worker);
+
+/**
+ * @brief Pool options.
+ */
+typedef struct {
+    uint32_t threads;               /**< 0 = online CPUs, 1 = single-threaded */
+    uint32_t first_cpu;             /**< First CPU when pinning */
+    bool pin;                       /**< Pin worker i to CPU first_cpu + i */
+    uint8_t _reserved[7];
+} cq_pool_opts_t;
+
+/**
+ * @brief Start argument of one worker thread.
+ */
+typedef struct {
+    void *pool;                     /**< Owning cq_pool_t */
+    uint32_t index;                 /**< Worker number */
+    uint32_t _reserved;
+} cq_pool_worker_t;
+
+/**
+ * @brief Thread pool. Caller-allocated; the calling thread of
+ *        cq_pool_run() takes part as worker 0.
+ */
+typedef struct {
+    pthread_t workers[CQ_POOL_MAX_THREADS];
+    cq_pool_worker_t worker_args[CQ_POOL_MAX_THREADS];
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t finished;
+    uint32_t thread_count;          /**< Including the caller */
+    uint32_t started;               /**< Worker threads created */
+    uint64_t generation;            /**< Incremented per job */
+    cq_pool_fn_t fn;
+    void *ctx;
+    size_t n;
+    size_t grain;
+    size_t next_chunk;
+    size_t chunk_count;
+    uint32_t active;                /**< Workers still inside the job */
+    bool stop;
+    bool pinned;                    /**< All requested pinnings succeeded */
+    uint8_t _reserved[2];
+} cq_pool_t;
+
+/**
+ * @brief Start a pool.
+ *
+ * @param pool  Pool to initialise.
+ * @param opts  Options, or NULL for one thread per online CPU, unpinned.
+ * @return      0 on success, CQ_ERROR_NULL_POINTER, CQ_ERROR_IO if a
+ *              thread could not be created.
+ */
+int cq_pool_init(cq_pool_t *pool, const cq_pool_opts_t *opts);
+
+/**
+ * @brief Stop and join all workers.
+ */
+void cq_pool_destroy(cq_pool_t *pool);
+
+/**
+ * @brief Threads that take part in cq_pool_run() (1 for a NULL pool).
+ */
+uint32_t cq_pool_threads(const cq_pool_t *pool);
+
+/**
+ * @brief Run fn over [0, n) in chunks of grain items and wait.
+ *
+ * With a NULL or single-threaded pool, chunks run in order on the caller.
+ * Not reentrant: fn must not call cq_pool_run() on the same pool.
+ *
+ * @param pool   Pool, or NULL for the calling thread only.
+ * @param n      Number of items.
+ * @param grain  Items per chunk (0 is treated as 1).
+ * @param fn     Chunk body.
+ * @param ctx    Passed to fn.
+ */
+void cq_pool_run(cq_pool_t *pool, size_t n, size_t grain, cq_pool_fn_t fn, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CQ_THREAD_POOL_H */
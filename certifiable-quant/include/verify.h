@@ -18,6 +18,7 @@
 #define CQ_VERIFY_H
 
 #include "cq_types.h"
+#include "thread_pool.h"
 #include <stddef.h>
 
 #ifdef __cplusplus
@@ -161,6 +162,27 @@ double cq_linf_norm(const float *a, const float *b, size_t n);
  */
 double cq_linf_norm_q16(const float *fp, const cq_fixed16_t *q16, size_t n);
 
+/**
+ * @brief cq_linf_norm_q16() for many tensors across a thread pool.
+ *
+ * One work item per tensor, so each norm is a single unsplit reduction.
+ *
+ * @param pool   Thread pool, or NULL for the calling thread.
+ * @param fp     Float arrays [count].
+ * @param q16    Fixed-point arrays [count].
+ * @param lens   Array lengths [count].
+ * @param count  Number of tensors.
+ * @param norms  Output: L-infinity norm per tensor [count].
+ *
+ * @traceability SRS-004-VERIFY FR-VER-02, CQ-MATH-001 §6
+ */
+void cq_linf_norm_q16_parallel(cq_pool_t *pool,
+                               const float *const *fp,
+                               const cq_fixed16_t *const *q16,
+                               const size_t *lens,
+                               uint32_t count,
+                               double *norms);
+
 /* ============================================================================
  * Bound Checking (FR-VER-03, FR-VER-04)
  * ============================================================================ */
@@ -299,6 +321,84 @@ static inline bool cq_verify_passed(const cq_verification_report_t *report) {
     return report->all_bounds_satisfied && report->total_bound_satisfied;
 }
 
+/* ============================================================================
+ * Output Dequantization
+ * ============================================================================ */
+
+/**
+ * @brief y[i] = cq_q16_to_float(q[i]) for i < n.
+ *
+ * Four lanes at a time with SSE2; the int32→float conversion and the
+ * exact division by 2^16 are the scalar ones, so every element matches
+ * cq_q16_to_float() bit for bit.
+ *
+ * @return 0 on success, CQ_ERROR_NULL_POINTER.
+ */
+int cq_dequantize_f32(const cq_fixed16_t *q, float *y, size_t n);
+
+/**
+ * @brief y[i] = q[i] · 2^-16 in FP64 (exact) for i < n.
+ * @return 0 on success, CQ_ERROR_NULL_POINTER.
+ */
+int cq_dequantize_f64(const cq_fixed16_t *q, double *y, size_t n);
+
+/**
+ * @brief y[i · y_stride] = cq_q16_to_float(q[i · q_stride]) for i < n.
+ *
+ * Strides are in elements, e.g. one class across a [batch][classes]
+ * output with q_stride = classes.
+ *
+ * @return 0 on success, CQ_ERROR_NULL_POINTER.
+ */
+int cq_dequantize_f32_strided(const cq_fixed16_t *q, size_t q_stride,
+                              float *y, size_t y_stride, size_t n);
+
+/**
+ * @brief Strided cq_dequantize_f64().
+ * @return 0 on success, CQ_ERROR_NULL_POINTER.
+ */
+int cq_dequantize_f64_strided(const cq_fixed16_t *q, size_t q_stride,
+                              double *y, size_t y_stride, size_t n);
+
+/**
+ * @brief Per-row argmax of [rows][cols] classifier outputs, optionally
+ *        dequantizing the rows in the same pass.
+ *
+ * Compared on the Q16.16 integers, so the result is exact; ties go to
+ * the lowest index.
+ *
+ * @param q       Q16.16 outputs [rows][cols].
+ * @param y       Output: floats [rows][cols], or NULL.
+ * @param rows    Rows (batch size).
+ * @param cols    Classes per row (≥ 1).
+ * @param argmax  Output: index of the largest value per row [rows].
+ * @return        0 on success, CQ_ERROR_NULL_POINTER,
+ *                CQ_ERROR_DIMENSION_MISMATCH if cols is 0.
+ */
+int cq_dequantize_argmax(const cq_fixed16_t *q, float *y, size_t rows, size_t cols,
+                         uint32_t *argmax);
+
+/**
+ * @brief Per-row top-k of [rows][cols] classifier outputs, optionally
+ *        dequantizing the rows in the same pass.
+ *
+ * Row r's indices land in idx[r·k .. r·k + k) in descending value order,
+ * ties by lowest index, so idx[r·k] is the argmax.
+ *
+ * @param q     Q16.16 outputs [rows][cols].
+ * @param y     Output: floats [rows][cols], or NULL.
+ * @param rows  Rows (batch size).
+ * @param cols  Classes per row.
+ * @param k     Entries per row (1 ≤ k ≤ cols).
+ * @param idx   Output: indices [rows][k].
+ * @param val   Output: cq_q16_to_float() of the selected values
+ *              [rows][k], or NULL.
+ * @return      0 on success, CQ_ERROR_NULL_POINTER,
+ *              CQ_ERROR_DIMENSION_MISMATCH if k is 0 or exceeds cols.
+ */
+int cq_dequantize_topk(const cq_fixed16_t *q, float *y, size_t rows, size_t cols,
+                       uint32_t k, uint32_t *idx, float *val);
+
 #ifdef __cplusplus
 }
 #endif
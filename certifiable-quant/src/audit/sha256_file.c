@@ -0,0 +1,318 @@
+/**
+ * @file sha256_file.c
+ * @project Certifiable-Quant
+ * @brief Streaming SHA-256 over files (mmap and double-buffered reader)
+ *
+ * @details Keeps the storage device busy while the compression function
+ *          runs: mapped files are hashed one window at a time with the
+ *          next window already requested from the kernel, and unmappable
+ *          descriptors are fed by a reader thread through two buffers.
+ *          The digest is identical to cq_sha256() over the same bytes.
+ *
+ * @traceability CQ-MATH-001 §9, SRS-005-CERTIFICATE
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "sha256.h"
+#include "cq_types.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Alignment of reader buffers (direct-I/O friendly) */
+#define IO_ALIGN 4096
+
+/* ============================================================================
+ * Mapped Path
+ * ============================================================================ */
+
+static int hash_mapped(int fd, size_t size, uint8_t digest[CQ_SHA256_DIGEST_SIZE])
+{
+    void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) {
+        return CQ_ERROR_IO;
+    }
+
+    const uint8_t *base = (const uint8_t *)map;
+    (void)posix_madvise(map, size, POSIX_MADV_SEQUENTIAL);
+
+    cq_sha256_ctx_t ctx;
+    cq_sha256_init(&ctx);
+
+    for (size_t off = 0; off < size; off += CQ_SHA256_IO_CHUNK) {
+        size_t len = size - off;
+        if (len > CQ_SHA256_IO_CHUNK) {
+            len = CQ_SHA256_IO_CHUNK;
+        }
+
+        /* Start I/O for the next window before hashing this one */
+        size_t next = off + len;
+        if (next < size) {
+            size_t ahead = size - next;
+            if (ahead > CQ_SHA256_IO_CHUNK) {
+                ahead = CQ_SHA256_IO_CHUNK;
+            }
+            (void)posix_madvise((void *)(base + next), ahead, POSIX_MADV_WILLNEED);
+        }
+
+        cq_sha256_update(&ctx, base + off, len);
+    }
+
+    cq_sha256_final(&ctx, digest);
+    munmap(map, size);
+    return 0;
+}
+
+/* ============================================================================
+ * Double-Buffered Reader Path
+ * ============================================================================ */
+
+typedef struct {
+    uint8_t *data;
+    ssize_t len;            /* > 0 data, 0 EOF, < 0 error */
+    bool full;
+} io_slot_t;
+
+typedef struct {
+    int fd;
+    bool seekable;
+    io_slot_t slot[2];
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+} io_pipe_t;
+
+static ssize_t read_chunk(int fd, bool seekable, off_t offset,
+                          uint8_t *buf, size_t cap)
+{
+    size_t got = 0;
+
+    /* Fill the whole chunk unless EOF: short reads are common on pipes */
+    while (got < cap) {
+        ssize_t n = seekable
+            ? pread(fd, buf + got, cap - got, offset + (off_t)got)
+            : read(fd, buf + got, cap - got);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        if (n == 0) {
+            break;
+        }
+        got += (size_t)n;
+    }
+    return (ssize_t)got;
+}
+
+/* One thread, one buffer: small inputs, or when no reader can be started */
+static int hash_sync(int fd, bool seekable, uint8_t digest[CQ_SHA256_DIGEST_SIZE])
+{
+    uint8_t buf[64 * 1024];
+    cq_sha256_ctx_t ctx;
+    off_t offset = 0;
+
+    cq_sha256_init(&ctx);
+    for (;;) {
+        ssize_t n = read_chunk(fd, seekable, offset, buf, sizeof(buf));
+        if (n < 0) {
+            return CQ_ERROR_IO;
+        }
+        if (n == 0) {
+            break;
+        }
+        cq_sha256_update(&ctx, buf, (size_t)n);
+        offset += (off_t)n;
+    }
+    cq_sha256_final(&ctx, digest);
+    return 0;
+}
+
+static void *reader_main(void *arg)
+{
+    io_pipe_t *p = (io_pipe_t *)arg;
+    off_t offset = 0;
+    int i = 0;
+
+    for (;;) {
+        io_slot_t *s = &p->slot[i];
+
+        pthread_mutex_lock(&p->lock);
+        while (s->full) {
+            pthread_cond_wait(&p->cond, &p->lock);
+        }
+        pthread_mutex_unlock(&p->lock);
+
+        ssize_t n = read_chunk(p->fd, p->seekable, offset, s->data, CQ_SHA256_IO_CHUNK);
+
+        pthread_mutex_lock(&p->lock);
+        s->len = n;
+        s->full = true;
+        pthread_cond_broadcast(&p->cond);
+        pthread_mutex_unlock(&p->lock);
+
+        if (n <= 0) {
+            break;
+        }
+        offset += (off_t)n;
+        i ^= 1;
+    }
+    return NULL;
+}
+
+static int hash_streamed(int fd, bool seekable, uint8_t digest[CQ_SHA256_DIGEST_SIZE])
+{
+    io_pipe_t p;
+    void *mem = NULL;
+    pthread_t reader;
+    int ret = 0;
+
+    if (posix_memalign(&mem, IO_ALIGN, 2 * CQ_SHA256_IO_CHUNK) != 0) {
+        return hash_sync(fd, seekable, digest);
+    }
+
+    p.fd = fd;
+    p.seekable = seekable;
+    p.slot[0].data = (uint8_t *)mem;
+    p.slot[1].data = (uint8_t *)mem + CQ_SHA256_IO_CHUNK;
+    p.slot[0].full = p.slot[1].full = false;
+    p.slot[0].len = p.slot[1].len = 0;
+
+    /* Nothing is consumed before the reader starts, so any failure to
+       set it up falls back to the synchronous pass */
+    if (pthread_mutex_init(&p.lock, NULL) != 0) {
+        free(mem);
+        return hash_sync(fd, seekable, digest);
+    }
+    if (pthread_cond_init(&p.cond, NULL) != 0) {
+        pthread_mutex_destroy(&p.lock);
+        free(mem);
+        return hash_sync(fd, seekable, digest);
+    }
+    if (pthread_create(&reader, NULL, reader_main, &p) != 0) {
+        pthread_cond_destroy(&p.cond);
+        pthread_mutex_destroy(&p.lock);
+        free(mem);
+        return hash_sync(fd, seekable, digest);
+    }
+
+    cq_sha256_ctx_t ctx;
+    cq_sha256_init(&ctx);
+
+    for (int i = 0;; i ^= 1) {
+        io_slot_t *s = &p.slot[i];
+
+        pthread_mutex_lock(&p.lock);
+        while (!s->full) {
+            pthread_cond_wait(&p.cond, &p.lock);
+        }
+        ssize_t n = s->len;
+        pthread_mutex_unlock(&p.lock);
+
+        if (n <= 0) {
+            ret = (n < 0) ? CQ_ERROR_IO : 0;
+            break;
+        }
+
+        cq_sha256_update(&ctx, s->data, (size_t)n);
+
+        pthread_mutex_lock(&p.lock);
+        s->full = false;
+        pthread_cond_broadcast(&p.cond);
+        pthread_mutex_unlock(&p.lock);
+    }
+
+    pthread_join(reader, NULL);
+    pthread_cond_destroy(&p.cond);
+    pthread_mutex_destroy(&p.lock);
+    free(mem);
+
+    if (ret == 0) {
+        cq_sha256_final(&ctx, digest);
+    }
+    return ret;
+}
+
+/* ============================================================================
+ * Public Interface
+ * ============================================================================ */
+
+int cq_sha256_fd(int fd, uint8_t digest[CQ_SHA256_DIGEST_SIZE])
+{
+    if (digest == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (fd < 0) {
+        return CQ_ERROR_IO;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        return CQ_ERROR_IO;
+    }
+
+    if (!S_ISREG(st.st_mode)) {
+        return hash_streamed(fd, false, digest);
+    }
+
+    (void)posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    size_t size = (size_t)st.st_size;
+    if (size >= CQ_SHA256_MMAP_MIN && hash_mapped(fd, size, digest) == 0) {
+        return 0;
+    }
+
+    if (size < CQ_SHA256_IO_CHUNK) {
+        /* Small file: a single synchronous pass is cheaper than a thread */
+        return hash_sync(fd, true, digest);
+    }
+
+    return hash_streamed(fd, true, digest);
+}
+
+int cq_sha256_fd_read(int fd, uint8_t digest[CQ_SHA256_DIGEST_SIZE])
+{
+    if (digest == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (fd < 0) {
+        return CQ_ERROR_IO;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        return CQ_ERROR_IO;
+    }
+
+    (void)posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    return hash_streamed(fd, S_ISREG(st.st_mode), digest);
+}
+
+int cq_sha256_file(const char *path, uint8_t digest[CQ_SHA256_DIGEST_SIZE])
+{
+    if (path == NULL || digest == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    int fd;
+    do {
+        fd = open(path, O_RDONLY);
+    } while (fd < 0 && errno == EINTR);
+
+    if (fd < 0) {
+        return CQ_ERROR_IO;
+    }
+
+    int ret = cq_sha256_fd(fd, digest);
+    close(fd);
+    return ret;
+}
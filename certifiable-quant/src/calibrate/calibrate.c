@@ -85,6 +85,36 @@ void cq_tensor_stats_update_single(cq_tensor_stats_t *stats, float value)
     }
 }
 
+typedef struct {
+    cq_tensor_stats_t *stats;
+    const float *const *tensors;
+    const size_t *lens;
+} stats_job_t;
+
+static void stats_chunk(void *ctx, size_t begin, size_t end, uint32_t worker)
+{
+    const stats_job_t *job = (const stats_job_t *)ctx;
+    (void)worker;
+
+    for (size_t t = begin; t < end; t++) {
+        cq_tensor_stats_update(&job->stats[t], job->tensors[t], job->lens[t]);
+    }
+}
+
+void cq_tensor_stats_update_parallel(cq_pool_t *pool,
+                                     cq_tensor_stats_t *stats,
+                                     const float *const *tensors,
+                                     const size_t *lens,
+                                     uint32_t count)
+{
+    if (stats == NULL || tensors == NULL || lens == NULL) {
+        return;
+    }
+
+    stats_job_t job = { stats, tensors, lens };
+    cq_pool_run(pool, count, 1, stats_chunk, &job);
+}
+
 /* ============================================================================
  * FR-CAL-02: Coverage Computation
  * ============================================================================ */
@@ -0,0 +1,317 @@
+/**
+ * @file builder_cache.c
+ * @project Certifiable-Quant
+ * @brief Persisted certificate builder inputs for incremental re-issuance
+ *
+ * @details Cache file layout (multi-byte integers little-endian):
+ *            0   magic "CQDC", version, sizeof of the three digest structs
+ *            20  mask of inputs set (CQ_CERT_INPUT_*)
+ *            24  tool version, scope format, BN folded flag
+ *            32  fault bits, target param count, target layer count
+ *            48  source, BN, target hashes
+ *            144 SHA-256 of analysis, calibration, verification digests
+ *            240 analysis, calibration, verification digests (host layout)
+ *            end SHA-256 of all preceding bytes
+ *          The digests are stored as the raw bytes cq_certificate_build()
+ *          hashes, so the recorded struct sizes guard against loading a
+ *          cache written by a build with a different digest layout.
+ *
+ * @traceability SRS-005-CERTIFICATE, CQ-MATH-001 §9.2
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "certificate.h"
+#include "sha256.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#define CACHE_FIXED_SIZE    240
+#define CACHE_SIZE          (CACHE_FIXED_SIZE \
+                             + sizeof(cq_analysis_digest_t) \
+                             + sizeof(cq_calibration_digest_t) \
+                             + sizeof(cq_verification_digest_t) \
+                             + CQ_SHA256_DIGEST_SIZE)
+
+#define CACHE_PATH_MAX      4096
+
+/* ============================================================================
+ * Encoding Helpers
+ * ============================================================================ */
+
+static void put_u32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+    return (uint32_t)p[0]
+         | ((uint32_t)p[1] << 8)
+         | ((uint32_t)p[2] << 16)
+         | ((uint32_t)p[3] << 24);
+}
+
+static uint32_t faults_to_bits(const cq_fault_flags_t *f)
+{
+    return (uint32_t)f->overflow
+         | ((uint32_t)f->underflow << 1)
+         | ((uint32_t)f->div_zero << 2)
+         | ((uint32_t)f->range_exceed << 3)
+         | ((uint32_t)f->unfolded_bn << 4)
+         | ((uint32_t)f->asymmetric << 5)
+         | ((uint32_t)f->bound_violation << 6);
+}
+
+static void faults_from_bits(cq_fault_flags_t *f, uint32_t bits)
+{
+    cq_fault_clear(f);
+    f->overflow = bits & 1u;
+    f->underflow = (bits >> 1) & 1u;
+    f->div_zero = (bits >> 2) & 1u;
+    f->range_exceed = (bits >> 3) & 1u;
+    f->unfolded_bn = (bits >> 4) & 1u;
+    f->asymmetric = (bits >> 5) & 1u;
+    f->bound_violation = (bits >> 6) & 1u;
+}
+
+/* Make a rename in the directory holding `path` durable */
+static int sync_parent_dir(const char *path)
+{
+    char dir[CACHE_PATH_MAX];
+    const char *slash = strrchr(path, '/');
+    size_t len = (slash == NULL) ? 0u : (slash == path) ? 1u : (size_t)(slash - path);
+
+    if (len >= sizeof(dir)) {
+        return CQ_ERROR_IO;
+    }
+    if (len == 0) {
+        dir[len++] = '.';
+    } else {
+        memcpy(dir, path, len);
+    }
+    dir[len] = '\0';
+
+    int fd = open(dir, O_RDONLY);
+    if (fd < 0) {
+        return CQ_ERROR_IO;
+    }
+    int synced = fsync(fd);
+    close(fd);
+    return (synced == 0) ? 0 : CQ_ERROR_IO;
+}
+
+/* ============================================================================
+ * Input Tracking
+ * ============================================================================ */
+
+uint32_t cq_certificate_builder_missing(const cq_certificate_builder_t *builder)
+{
+    if (builder == NULL) {
+        return CQ_CERT_INPUT_ALL;
+    }
+
+    uint32_t missing = 0;
+    missing |= builder->source_model_hash_set ? 0u : CQ_CERT_INPUT_SOURCE;
+    missing |= builder->bn_info_set ? 0u : CQ_CERT_INPUT_BN;
+    missing |= builder->analysis_set ? 0u : CQ_CERT_INPUT_ANALYSIS;
+    missing |= builder->calibration_set ? 0u : CQ_CERT_INPUT_CALIBRATION;
+    missing |= builder->verification_set ? 0u : CQ_CERT_INPUT_VERIFICATION;
+    missing |= builder->target_set ? 0u : CQ_CERT_INPUT_TARGET;
+    return missing;
+}
+
+void cq_certificate_builder_invalidate(cq_certificate_builder_t *builder,
+                                       uint32_t inputs)
+{
+    if (builder == NULL) {
+        return;
+    }
+
+    if (inputs & CQ_CERT_INPUT_SOURCE) {
+        builder->source_model_hash_set = false;
+    }
+    if (inputs & CQ_CERT_INPUT_BN) {
+        builder->bn_info_set = false;
+    }
+    if (inputs & CQ_CERT_INPUT_ANALYSIS) {
+        builder->analysis_set = false;
+    }
+    if (inputs & CQ_CERT_INPUT_CALIBRATION) {
+        builder->calibration_set = false;
+    }
+    if (inputs & CQ_CERT_INPUT_VERIFICATION) {
+        builder->verification_set = false;
+    }
+    if (inputs & CQ_CERT_INPUT_TARGET) {
+        builder->target_set = false;
+    }
+}
+
+/* ============================================================================
+ * Save / Load
+ * ============================================================================ */
+
+int cq_certificate_builder_save(const cq_certificate_builder_t *builder,
+                                const char *path)
+{
+    uint8_t buf[CACHE_SIZE];
+    char tmp[CACHE_PATH_MAX];
+
+    if (builder == NULL || path == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    int n = snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    if (n < 0 || (size_t)n >= sizeof(tmp)) {
+        return CQ_ERROR_IO;
+    }
+
+    memset(buf, 0, sizeof(buf));
+    memcpy(buf, CQ_BUILDER_CACHE_MAGIC, 4);
+    put_u32(buf + 4, CQ_BUILDER_CACHE_VERSION);
+    put_u32(buf + 8, (uint32_t)sizeof(cq_analysis_digest_t));
+    put_u32(buf + 12, (uint32_t)sizeof(cq_calibration_digest_t));
+    put_u32(buf + 16, (uint32_t)sizeof(cq_verification_digest_t));
+    put_u32(buf + 20, CQ_CERT_INPUT_ALL & ~cq_certificate_builder_missing(builder));
+
+    memcpy(buf + 24, builder->tool_version, 4);
+    buf[28] = builder->scope_format;
+    buf[29] = builder->bn_folded ? 1u : 0u;
+    put_u32(buf + 32, faults_to_bits(&builder->faults));
+    put_u32(buf + 36, builder->target_param_count);
+    put_u32(buf + 40, builder->target_layer_count);
+
+    memcpy(buf + 48, builder->source_model_hash, 32);
+    memcpy(buf + 80, builder->bn_folding_hash, 32);
+    memcpy(buf + 112, builder->target_model_hash, 32);
+
+    /* Digest hashes, from the digests as they are now */
+    cq_sha256(&builder->analysis_digest, sizeof(cq_analysis_digest_t), buf + 144);
+    cq_sha256(&builder->calibration_digest, sizeof(cq_calibration_digest_t), buf + 176);
+    cq_sha256(&builder->verification_digest, sizeof(cq_verification_digest_t), buf + 208);
+
+    uint8_t *p = buf + CACHE_FIXED_SIZE;
+    memcpy(p, &builder->analysis_digest, sizeof(cq_analysis_digest_t));
+    p += sizeof(cq_analysis_digest_t);
+    memcpy(p, &builder->calibration_digest, sizeof(cq_calibration_digest_t));
+    p += sizeof(cq_calibration_digest_t);
+    memcpy(p, &builder->verification_digest, sizeof(cq_verification_digest_t));
+    p += sizeof(cq_verification_digest_t);
+
+    cq_sha256(buf, (size_t)(p - buf), p);
+
+    FILE *f = fopen(tmp, "wb");
+    if (f == NULL) {
+        return CQ_ERROR_IO;
+    }
+
+    /* Durable before the rename, or a crash can leave an empty cache */
+    size_t written = fwrite(buf, 1, sizeof(buf), f);
+    int synced = (fflush(f) == 0) ? fsync(fileno(f)) : -1;
+    int closed = fclose(f);
+
+    if (written != sizeof(buf) || synced != 0 || closed != 0 || rename(tmp, path) != 0) {
+        remove(tmp);
+        return CQ_ERROR_IO;
+    }
+
+    /* ... and the rename itself, or a crash can bring back the old cache */
+    return sync_parent_dir(path);
+}
+
+int cq_certificate_builder_load(cq_certificate_builder_t *builder,
+                                const char *path)
+{
+    uint8_t buf[CACHE_SIZE + 1];
+    uint8_t check[CQ_SHA256_DIGEST_SIZE];
+
+    if (builder == NULL || path == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return CQ_ERROR_IO;
+    }
+
+    /* One extra byte detects a file that is too long */
+    size_t got = fread(buf, 1, sizeof(buf), f);
+    int read_error = ferror(f);
+    fclose(f);
+
+    if (read_error) {
+        return CQ_ERROR_IO;
+    }
+
+    /* Magic and layout first: a cache from another layout has another size */
+    if (got < 24 || memcmp(buf, CQ_BUILDER_CACHE_MAGIC, 4) != 0) {
+        return CQ_ERROR_INVALID_HEADER;  /* Not a builder cache */
+    }
+    if (get_u32(buf + 4) != CQ_BUILDER_CACHE_VERSION ||
+        get_u32(buf + 8) != sizeof(cq_analysis_digest_t) ||
+        get_u32(buf + 12) != sizeof(cq_calibration_digest_t) ||
+        get_u32(buf + 16) != sizeof(cq_verification_digest_t)) {
+        return CQ_ERROR_INVALID_HEADER;  /* Incompatible version or digest layout */
+    }
+
+    size_t body = CACHE_SIZE - CQ_SHA256_DIGEST_SIZE;
+    cq_sha256(buf, body, check);
+    if (got != CACHE_SIZE || memcmp(check, buf + body, sizeof(check)) != 0) {
+        return CQ_ERROR_CORRUPT;  /* Truncated or corrupt */
+    }
+
+    /* The recorded digest hashes must still describe the digests */
+    const size_t digest_size[3] = {
+        sizeof(cq_analysis_digest_t),
+        sizeof(cq_calibration_digest_t),
+        sizeof(cq_verification_digest_t)
+    };
+    const uint8_t *d = buf + CACHE_FIXED_SIZE;
+    for (int i = 0; i < 3; i++) {
+        cq_sha256(d, digest_size[i], check);
+        if (memcmp(check, buf + 144 + 32 * i, sizeof(check)) != 0) {
+            return CQ_ERROR_CORRUPT;  /* Inconsistent digest hash */
+        }
+        d += digest_size[i];
+    }
+
+    uint32_t inputs = get_u32(buf + 20);
+
+    cq_certificate_builder_init(builder);
+    memcpy(builder->tool_version, buf + 24, 4);
+    builder->scope_format = buf[28];
+    builder->bn_folded = buf[29] != 0;
+    faults_from_bits(&builder->faults, get_u32(buf + 32));
+    builder->target_param_count = get_u32(buf + 36);
+    builder->target_layer_count = get_u32(buf + 40);
+
+    memcpy(builder->source_model_hash, buf + 48, 32);
+    memcpy(builder->bn_folding_hash, buf + 80, 32);
+    memcpy(builder->target_model_hash, buf + 112, 32);
+
+    const uint8_t *p = buf + CACHE_FIXED_SIZE;
+    memcpy(&builder->analysis_digest, p, sizeof(cq_analysis_digest_t));
+    p += sizeof(cq_analysis_digest_t);
+    memcpy(&builder->calibration_digest, p, sizeof(cq_calibration_digest_t));
+    p += sizeof(cq_calibration_digest_t);
+    memcpy(&builder->verification_digest, p, sizeof(cq_verification_digest_t));
+
+    builder->source_model_hash_set = (inputs & CQ_CERT_INPUT_SOURCE) != 0;
+    builder->bn_info_set = (inputs & CQ_CERT_INPUT_BN) != 0;
+    builder->analysis_set = (inputs & CQ_CERT_INPUT_ANALYSIS) != 0;
+    builder->calibration_set = (inputs & CQ_CERT_INPUT_CALIBRATION) != 0;
+    builder->verification_set = (inputs & CQ_CERT_INPUT_VERIFICATION) != 0;
+    builder->target_set = (inputs & CQ_CERT_INPUT_TARGET) != 0;
+
+    return 0;
+}
@@ -0,0 +1,303 @@
+/**
+ * @file cert_audit.c
+ * @project Certifiable-Quant
+ * @brief Parallel bulk certificate verification
+ *
+ * @details Workers claim CQ_AUDIT_CLAIM certificates at a time from a shared
+ *          cursor, so slow model re-hashes do not leave other threads idle.
+ *          Each claim is checked in place through cq_certificate_view_open()
+ *          and its signatures are verified as one Ed25519 batch.
+ *
+ * @traceability SRS-005-CERTIFICATE, CQ-STRUCT-001 §7.2
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "cert_audit.h"
+#include "ed25519.h"
+#include "sha256.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+typedef struct {
+    const uint8_t *records;
+    const char *const *paths;
+    size_t count;
+    cq_cert_audit_opts_t opts;
+    uint32_t *status;
+    pthread_mutex_t lock;
+    size_t next;                    /* First unclaimed certificate */
+    size_t passed;
+} audit_job_t;
+
+/* ============================================================================
+ * Single Certificate Checks
+ * ============================================================================ */
+
+/* Read exactly one certificate; anything else is a read failure. */
+static bool read_certificate(const char *path, uint8_t out[CQ_CERTIFICATE_SIZE])
+{
+    struct stat st;
+    size_t got = 0;
+    int fd;
+
+    do {
+        fd = open(path, O_RDONLY);
+    } while (fd < 0 && errno == EINTR);
+
+    if (fd < 0) {
+        return false;
+    }
+
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) ||
+        st.st_size != (off_t)CQ_CERTIFICATE_SIZE) {
+        close(fd);
+        return false;
+    }
+
+    while (got < CQ_CERTIFICATE_SIZE) {
+        ssize_t n = read(fd, out + got, CQ_CERTIFICATE_SIZE - got);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            break;
+        }
+        got += (size_t)n;
+    }
+
+    close(fd);
+    return got == CQ_CERTIFICATE_SIZE;
+}
+
+static uint32_t check_model(const char *model_dir, const uint8_t target_hash[32])
+{
+    static const char hex[] = "0123456789abcdef";
+    char path[CQ_AUDIT_PATH_MAX];
+    char name[65];
+    uint8_t digest[CQ_SHA256_DIGEST_SIZE];
+
+    for (int i = 0; i < 32; i++) {
+        name[2 * i] = hex[target_hash[i] >> 4];
+        name[2 * i + 1] = hex[target_hash[i] & 0x0F];
+    }
+    name[64] = '\0';
+
+    int n = snprintf(path, sizeof(path), "%s/%s", model_dir, name);
+    if (n < 0 || (size_t)n >= sizeof(path)) {
+        return CQ_AUDIT_FAIL_MODEL_IO;
+    }
+
+    if (cq_sha256_file(path, digest) != 0) {
+        return CQ_AUDIT_FAIL_MODEL_IO;
+    }
+
+    return (memcmp(digest, target_hash, 32) == 0) ? 0u : CQ_AUDIT_FAIL_MODEL_HASH;
+}
+
+static uint32_t check_certificate(const cq_cert_audit_opts_t *opts,
+                                  const uint8_t *record,
+                                  cq_certificate_view_t *view)
+{
+    switch (cq_certificate_view_open(view, record, CQ_CERTIFICATE_SIZE)) {
+    case 0:
+        break;
+    case CQ_ERROR_MERKLE_MISMATCH:
+        return CQ_AUDIT_FAIL_INTEGRITY;
+    default:
+        return CQ_AUDIT_FAIL_HEADER;
+    }
+
+    uint32_t st = 0;
+
+    /* Negated so that a NaN claim fails */
+    if (!(cq_certificate_view_epsilon_max(view) <= cq_certificate_view_epsilon_total(view))) {
+        st |= CQ_AUDIT_FAIL_BOUNDS;
+    }
+
+    if (opts->model_dir != NULL) {
+        st |= check_model(opts->model_dir, cq_certificate_view_target_hash(view));
+    }
+
+    return st;
+}
+
+/* ============================================================================
+ * Workers
+ * ============================================================================ */
+
+static void audit_claim(audit_job_t *job, size_t begin, size_t end)
+{
+    uint8_t local[CQ_AUDIT_CLAIM][CQ_CERTIFICATE_SIZE];
+    cq_certificate_view_t views[CQ_AUDIT_CLAIM];
+    cq_ed25519_item_t items[CQ_AUDIT_CLAIM];
+    bool item_ok[CQ_AUDIT_CLAIM];
+    size_t item_pos[CQ_AUDIT_CLAIM];
+    size_t n_items = 0;
+    size_t passed = 0;
+
+    for (size_t i = begin; i < end; i++) {
+        size_t k = i - begin;
+        const uint8_t *record;
+
+        if (job->paths != NULL) {
+            if (!read_certificate(job->paths[i], local[k])) {
+                job->status[i] = CQ_AUDIT_FAIL_READ;
+                continue;
+            }
+            record = local[k];
+        } else {
+            record = job->records + i * CQ_CERTIFICATE_SIZE;
+        }
+
+        job->status[i] = check_certificate(&job->opts, record, &views[k]);
+
+        if (job->opts.public_key != NULL && views[k].data != NULL) {
+            items[n_items].public_key = job->opts.public_key;
+            items[n_items].signature = cq_certificate_view_signature(&views[k]);
+            items[n_items].message = cq_certificate_view_merkle_root(&views[k]);
+            items[n_items].message_len = 32;
+            item_pos[n_items] = i;
+            n_items++;
+        }
+    }
+
+    if (n_items > 0) {
+        cq_ed25519_verify_batch(items, n_items, item_ok);
+        for (size_t k = 0; k < n_items; k++) {
+            if (!item_ok[k]) {
+                job->status[item_pos[k]] |= CQ_AUDIT_FAIL_SIGNATURE;
+            }
+        }
+    }
+
+    for (size_t i = begin; i < end; i++) {
+        passed += (job->status[i] == 0) ? 1u : 0u;
+    }
+
+    pthread_mutex_lock(&job->lock);
+    job->passed += passed;
+    pthread_mutex_unlock(&job->lock);
+}
+
+static void *audit_worker(void *arg)
+{
+    audit_job_t *job = (audit_job_t *)arg;
+
+    for (;;) {
+        pthread_mutex_lock(&job->lock);
+        size_t begin = job->next;
+        size_t end = (job->count - begin > CQ_AUDIT_CLAIM) ? begin + CQ_AUDIT_CLAIM : job->count;
+        job->next = end;
+        pthread_mutex_unlock(&job->lock);
+
+        if (begin >= end) {
+            break;
+        }
+        audit_claim(job, begin, end);
+    }
+    return NULL;
+}
+
+static size_t audit_run(const uint8_t *records,
+                        const char *const *paths,
+                        size_t count,
+                        const cq_cert_audit_opts_t *opts,
+                        uint32_t *status)
+{
+    pthread_t tids[CQ_AUDIT_MAX_THREADS];
+    audit_job_t job;
+    unsigned threads = cq_cert_audit_threads(opts, count);
+    unsigned started = 0;
+
+    memset(&job, 0, sizeof(job));
+    job.records = records;
+    job.paths = paths;
+    job.count = count;
+    job.status = status;
+    if (opts != NULL) {
+        job.opts = *opts;
+    }
+
+    pthread_mutex_init(&job.lock, NULL);
+
+    /* The calling thread is worker 0 */
+    for (unsigned t = 1; t < threads; t++) {
+        if (pthread_create(&tids[started], NULL, audit_worker, &job) == 0) {
+            started++;
+        }
+    }
+    audit_worker(&job);
+    for (unsigned t = 0; t < started; t++) {
+        pthread_join(tids[t], NULL);
+    }
+
+    pthread_mutex_destroy(&job.lock);
+    return job.passed;
+}
+
+/* ============================================================================
+ * Public Interface
+ * ============================================================================ */
+
+unsigned cq_cert_audit_threads(const cq_cert_audit_opts_t *opts, size_t count)
+{
+    unsigned threads = (opts != NULL) ? opts->threads : 0u;
+
+    if (threads == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (online > 0) ? (unsigned)online : 1u;
+    }
+    if (threads > CQ_AUDIT_MAX_THREADS) {
+        threads = CQ_AUDIT_MAX_THREADS;
+    }
+    if ((size_t)threads > (count + CQ_AUDIT_CLAIM - 1) / CQ_AUDIT_CLAIM) {
+        threads = (unsigned)((count + CQ_AUDIT_CLAIM - 1) / CQ_AUDIT_CLAIM);
+    }
+    return threads;
+}
+
+size_t cq_cert_audit_records(const uint8_t *records,
+                             size_t count,
+                             const cq_cert_audit_opts_t *opts,
+                             uint32_t *status)
+{
+    if (records == NULL || status == NULL || count == 0) {
+        return 0;
+    }
+    return audit_run(records, NULL, count, opts, status);
+}
+
+size_t cq_cert_audit_files(const char *const *paths,
+                           size_t count,
+                           const cq_cert_audit_opts_t *opts,
+                           uint32_t *status)
+{
+    if (paths == NULL || status == NULL || count == 0) {
+        return 0;
+    }
+    return audit_run(NULL, paths, count, opts, status);
+}
+
+const char *cq_cert_audit_reason(uint32_t bit)
+{
+    switch (bit) {
+    case CQ_AUDIT_FAIL_READ:       return "read";
+    case CQ_AUDIT_FAIL_HEADER:     return "header";
+    case CQ_AUDIT_FAIL_INTEGRITY:  return "integrity";
+    case CQ_AUDIT_FAIL_BOUNDS:     return "bounds";
+    case CQ_AUDIT_FAIL_SIGNATURE:  return "signature";
+    case CQ_AUDIT_FAIL_MODEL_IO:   return "model_io";
+    case CQ_AUDIT_FAIL_MODEL_HASH: return "model_hash";
+    default:                       return "unknown";
+    }
+}
@@ -0,0 +1,677 @@
+/**
+ * @file cert_store.c
+ * @project Certifiable-Quant
+ * @brief Indexed on-disk certificate store
+ *
+ * @details Index file layout (host byte order, rebuilt when foreign):
+ *            index_header_t
+ *            index_slot_t target_table[capacity]
+ *            index_slot_t source_table[capacity]
+ *          Tables use linear probing on the first 8 bytes of the SHA-256
+ *          key (already uniform) and are kept at most half full. A slot
+ *          stores record_index + 1 (0 = empty) and 32 more key bits as a
+ *          tag so most mismatches are rejected without touching the record.
+ *
+ * @traceability SRS-005-CERTIFICATE, CQ-STRUCT-001 §7
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "cert_store.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define INDEX_MAGIC         "CQIX"
+#define INDEX_VERSION       1u
+#define INDEX_BYTE_ORDER    0x01020304u
+
+#define TABLE_TARGET        0
+#define TABLE_SOURCE        1
+
+/* Probe hit a slot past the records or found no empty slot */
+#define INDEX_CORRUPT       1
+
+typedef struct {
+    uint8_t magic[4];
+    uint32_t byte_order;
+    uint32_t version;
+    uint32_t capacity;
+    uint32_t record_count;          /**< Records covered by the index */
+    uint32_t _reserved[3];
+} index_header_t;
+
+typedef struct {
+    uint32_t record;                /**< record_index + 1, 0 = empty */
+    uint32_t tag;                   /**< Key bits 32..63 */
+} index_slot_t;
+
+static const size_t key_offset[2] = {
+    CQ_CERT_OFF_TARGET_HASH,
+    CQ_CERT_OFF_SOURCE_HASH
+};
+
+/* ============================================================================
+ * Helpers
+ * ============================================================================ */
+
+static uint64_t key_hash(const uint8_t *key)
+{
+    uint64_t h = 0;
+    for (int i = 7; i >= 0; i--) {
+        h = (h << 8) | key[i];
+    }
+    return h;
+}
+
+static size_t index_bytes(uint32_t capacity)
+{
+    return sizeof(index_header_t) + 2u * (size_t)capacity * sizeof(index_slot_t);
+}
+
+static index_header_t *index_header(const cq_cert_store_t *store)
+{
+    return (index_header_t *)store->index;
+}
+
+static index_slot_t *index_table(const cq_cert_store_t *store, int which)
+{
+    index_slot_t *base = (index_slot_t *)(store->index + sizeof(index_header_t));
+    return base + (size_t)which * store->capacity;
+}
+
+static const uint8_t *record_at(const cq_cert_store_t *store, uint32_t record_index)
+{
+    return store->records + (size_t)record_index * CQ_CERTIFICATE_SIZE;
+}
+
+static int write_all(int fd, const uint8_t *buf, size_t len)
+{
+    while (len > 0) {
+        ssize_t n = write(fd, buf, len);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return CQ_ERROR_IO;
+        }
+        buf += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+/* ============================================================================
+ * Record Map
+ * ============================================================================ */
+
+/* Map at least `need` records; the map grows geometrically past EOF so
+ * that appends rarely remap. */
+static int map_records(cq_cert_store_t *store, size_t need)
+{
+    if (store->records != NULL && need <= store->records_mapped) {
+        return 0;
+    }
+
+    size_t cap = (store->records_mapped > CQ_CERT_STORE_MIN_CAPACITY)
+               ? store->records_mapped : CQ_CERT_STORE_MIN_CAPACITY;
+    while (cap < need) {
+        cap *= 2;
+    }
+
+    void *map = mmap(NULL, cap * CQ_CERTIFICATE_SIZE, PROT_READ, MAP_SHARED,
+                     store->data_fd, 0);
+    if (map == MAP_FAILED) {
+        return CQ_ERROR_IO;
+    }
+
+    if (store->records != NULL) {
+        munmap((void *)store->records, store->records_mapped * CQ_CERTIFICATE_SIZE);
+    }
+    store->records = (const uint8_t *)map;
+    store->records_mapped = cap;
+    return 0;
+}
+
+/* ============================================================================
+ * Hash Index
+ * ============================================================================ */
+
+/* Slots are validated before use, and probes stop after one lap, so a
+ * damaged index reports INDEX_CORRUPT instead of reading past the map. */
+static int index_insert(cq_cert_store_t *store, int which, uint32_t record_index)
+{
+    const uint8_t *key = record_at(store, record_index) + key_offset[which];
+    uint64_t h = key_hash(key);
+    uint32_t tag = (uint32_t)(h >> 32);
+    uint32_t mask = store->capacity - 1u;
+    uint32_t pos = (uint32_t)h & mask;
+    index_slot_t *table = index_table(store, which);
+
+    for (uint32_t n = 0; n < store->capacity; n++, pos = (pos + 1u) & mask) {
+        index_slot_t *slot = &table[pos];
+
+        if (slot->record == 0) {
+            slot->record = record_index + 1u;
+            slot->tag = tag;
+            return 0;
+        }
+        if (slot->record > store->record_count) {
+            return INDEX_CORRUPT;
+        }
+
+        /* Same key: the newer record shadows the older one */
+        if (slot->tag == tag &&
+            memcmp(record_at(store, slot->record - 1u) + key_offset[which], key, 32) == 0) {
+            slot->record = record_index + 1u;
+            return 0;
+        }
+    }
+    return INDEX_CORRUPT;
+}
+
+static int index_lookup(const cq_cert_store_t *store, int which,
+                        const uint8_t key[32], uint32_t *record_index)
+{
+    uint64_t h = key_hash(key);
+    uint32_t tag = (uint32_t)(h >> 32);
+    uint32_t mask = store->capacity - 1u;
+    uint32_t pos = (uint32_t)h & mask;
+    const index_slot_t *table = index_table(store, which);
+
+    for (uint32_t n = 0; n < store->capacity; n++, pos = (pos + 1u) & mask) {
+        const index_slot_t *slot = &table[pos];
+
+        if (slot->record == 0) {
+            return CQ_CERT_STORE_NOT_FOUND;
+        }
+        if (slot->record > store->record_count) {
+            return INDEX_CORRUPT;
+        }
+        if (slot->tag == tag &&
+            memcmp(record_at(store, slot->record - 1u) + key_offset[which], key, 32) == 0) {
+            *record_index = slot->record - 1u;
+            return 0;
+        }
+    }
+    return INDEX_CORRUPT;
+}
+
+/* Newest record with the key, without the index */
+static int scan_records(const cq_cert_store_t *store, int which,
+                        const uint8_t key[32], uint32_t *record_index)
+{
+    for (uint32_t i = store->record_count; i-- > 0;) {
+        if (memcmp(record_at(store, i) + key_offset[which], key, 32) == 0) {
+            *record_index = i;
+            return 0;
+        }
+    }
+    return CQ_CERT_STORE_NOT_FOUND;
+}
+
+/* Every slot names an existing record and no table holds more keys than
+ * records, so (at most half full) each keeps empty slots to stop probes. */
+static bool index_valid(const cq_cert_store_t *store)
+{
+    for (int which = TABLE_TARGET; which <= TABLE_SOURCE; which++) {
+        const index_slot_t *table = index_table(store, which);
+        uint32_t used = 0;
+
+        for (uint32_t i = 0; i < store->capacity; i++) {
+            if (table[i].record > store->record_count) {
+                return false;
+            }
+            used += (table[i].record != 0) ? 1u : 0u;
+        }
+        if (used > store->record_count) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint32_t capacity_for(uint32_t records)
+{
+    uint32_t cap = CQ_CERT_STORE_MIN_CAPACITY;
+
+    /* Keep each table at most half full */
+    while ((uint64_t)records * 2u > cap) {
+        cap *= 2u;
+    }
+    return cap;
+}
+
+/* Insert every record into the (zeroed) tables and stamp the header. */
+static int index_fill(cq_cert_store_t *store)
+{
+    for (uint32_t i = 0; i < store->record_count; i++) {
+        if (index_insert(store, TABLE_TARGET, i) != 0 ||
+            index_insert(store, TABLE_SOURCE, i) != 0) {
+            return CQ_ERROR_IO;
+        }
+    }
+
+    index_header_t *hdr = index_header(store);
+    memcpy(hdr->magic, INDEX_MAGIC, 4);
+    hdr->byte_order = INDEX_BYTE_ORDER;
+    hdr->version = INDEX_VERSION;
+    hdr->capacity = store->capacity;
+    hdr->record_count = store->record_count;
+    return 0;
+}
+
+/* Recreate the index file at `capacity` and insert every record. */
+static int index_rebuild(cq_cert_store_t *store, uint32_t capacity)
+{
+    size_t size = index_bytes(capacity);
+
+    if (store->index != NULL) {
+        munmap(store->index, store->index_size);
+        store->index = NULL;
+    }
+
+    /* Truncate to zero first so every slot reads back as empty */
+    if (ftruncate(store->index_fd, 0) != 0 ||
+        ftruncate(store->index_fd, (off_t)size) != 0) {
+        return CQ_ERROR_IO;
+    }
+
+    void *map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                     store->index_fd, 0);
+    if (map == MAP_FAILED) {
+        return CQ_ERROR_IO;
+    }
+
+    store->index = (uint8_t *)map;
+    store->index_size = size;
+    store->capacity = capacity;
+    return index_fill(store);
+}
+
+/* Map an existing index if it is current and sound; otherwise rebuild it. */
+static int index_load(cq_cert_store_t *store)
+{
+    struct stat st;
+    index_header_t hdr;
+
+    if (fstat(store->index_fd, &st) != 0) {
+        return CQ_ERROR_IO;
+    }
+
+    if ((size_t)st.st_size >= sizeof(hdr) &&
+        pread(store->index_fd, &hdr, sizeof(hdr), 0) == (ssize_t)sizeof(hdr) &&
+        memcmp(hdr.magic, INDEX_MAGIC, 4) == 0 &&
+        hdr.byte_order == INDEX_BYTE_ORDER &&
+        hdr.version == INDEX_VERSION &&
+        hdr.capacity >= CQ_CERT_STORE_MIN_CAPACITY &&
+        (hdr.capacity & (hdr.capacity - 1u)) == 0 &&
+        (size_t)st.st_size == index_bytes(hdr.capacity) &&
+        hdr.record_count == store->record_count &&
+        (uint64_t)store->record_count * 2u <= hdr.capacity) {
+
+        void *map = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED, store->index_fd, 0);
+        if (map != MAP_FAILED) {
+            store->index = (uint8_t *)map;
+            store->index_size = (size_t)st.st_size;
+            store->capacity = hdr.capacity;
+            if (index_valid(store)) {
+                return 0;
+            }
+        }
+    }
+
+    return index_rebuild(store, capacity_for(store->record_count));
+}
+
+/* ============================================================================
+ * Lifecycle
+ * ============================================================================ */
+
+/* Open the data file, count whole records and map them (both modes). */
+static int open_records(cq_cert_store_t *store, const char *path, int flags)
+{
+    memset(store, 0, sizeof(*store));
+    store->data_fd = -1;
+    store->index_fd = -1;
+
+    store->data_fd = open(path, flags, 0644);
+    if (store->data_fd < 0) {
+        return CQ_ERROR_IO;
+    }
+
+    struct stat st;
+    if (fstat(store->data_fd, &st) != 0) {
+        cq_cert_store_close(store);
+        return CQ_ERROR_IO;
+    }
+
+    uint64_t records = (uint64_t)st.st_size / CQ_CERTIFICATE_SIZE;
+    if (records > UINT32_MAX / 2u) {
+        cq_cert_store_close(store);
+        return CQ_ERROR_IO;
+    }
+    store->record_count = (uint32_t)records;
+    store->torn_tail_bytes = (uint32_t)((uint64_t)st.st_size - records * CQ_CERTIFICATE_SIZE);
+
+    if (map_records(store, store->record_count) != 0) {
+        cq_cert_store_close(store);
+        return CQ_ERROR_IO;
+    }
+    return 0;
+}
+
+int cq_cert_store_open(cq_cert_store_t *store, const char *path)
+{
+    if (store == NULL || path == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    int ret = open_records(store, path, O_RDWR | O_CREAT | O_APPEND);
+    if (ret != 0) {
+        return ret;
+    }
+
+    /* Drop a torn trailing record from an interrupted append */
+    if (store->torn_tail_bytes != 0 &&
+        ftruncate(store->data_fd, (off_t)store->record_count * CQ_CERTIFICATE_SIZE) != 0) {
+        cq_cert_store_close(store);
+        return CQ_ERROR_IO;
+    }
+
+    int n = snprintf(store->index_path, sizeof(store->index_path), "%s%s",
+                     path, CQ_CERT_STORE_INDEX_SUFFIX);
+    if (n < 0 || (size_t)n >= sizeof(store->index_path)) {
+        cq_cert_store_close(store);
+        return CQ_ERROR_IO;
+    }
+
+    store->index_fd = open(store->index_path, O_RDWR | O_CREAT, 0644);
+    if (store->index_fd < 0 || index_load(store) != 0) {
+        cq_cert_store_close(store);
+        return CQ_ERROR_IO;
+    }
+
+    return 0;
+}
+
+int cq_cert_store_open_readonly(cq_cert_store_t *store, const char *path)
+{
+    if (store == NULL || path == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    int ret = open_records(store, path, O_RDONLY);
+    if (ret != 0) {
+        return ret;
+    }
+    store->read_only = true;
+
+    /* Private index: nothing on disk is trusted or written */
+    store->capacity = capacity_for(store->record_count);
+    store->index_size = index_bytes(store->capacity);
+    store->index = (uint8_t *)calloc(1, store->index_size);
+    if (store->index == NULL || index_fill(store) != 0) {
+        cq_cert_store_close(store);
+        return CQ_ERROR_IO;
+    }
+
+    return 0;
+}
+
+void cq_cert_store_close(cq_cert_store_t *store)
+{
+    if (store == NULL) {
+        return;
+    }
+
+    if (store->read_only) {
+        free(store->index);
+    } else if (store->index != NULL) {
+        munmap(store->index, store->index_size);
+    }
+    if (store->records != NULL) {
+        munmap((void *)store->records, store->records_mapped * CQ_CERTIFICATE_SIZE);
+    }
+    if (store->index_fd >= 0) {
+        close(store->index_fd);
+    }
+    if (store->data_fd >= 0) {
+        close(store->data_fd);
+    }
+
+    store->index = NULL;
+    store->records = NULL;
+    store->index_fd = -1;
+    store->data_fd = -1;
+}
+
+int cq_cert_store_sync(cq_cert_store_t *store)
+{
+    if (store == NULL || store->index == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (store->read_only) {
+        return 0;
+    }
+
+    if (fsync(store->data_fd) != 0 ||
+        msync(store->index, store->index_size, MS_SYNC) != 0 ||
+        fsync(store->index_fd) != 0) {
+        return CQ_ERROR_IO;
+    }
+    return 0;
+}
+
+/* ============================================================================
+ * Append and Lookup
+ * ============================================================================ */
+
+int cq_cert_store_append(cq_cert_store_t *store,
+                         const cq_certificate_t *cert,
+                         uint32_t *record_index)
+{
+    uint8_t buffer[CQ_CERTIFICATE_SIZE];
+    cq_certificate_view_t view;
+    size_t size;
+
+    if (store == NULL || store->index == NULL || cert == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (store->read_only) {
+        return CQ_ERROR_IO;
+    }
+
+    cq_certificate_serialise(cert, buffer, &size);
+    int ret = cq_certificate_view_open(&view, buffer, size);
+    if (ret != 0) {
+        return ret;
+    }
+
+    uint32_t idx = store->record_count;
+    if (idx >= UINT32_MAX / 2u) {
+        return CQ_ERROR_IO;
+    }
+
+    if (write_all(store->data_fd, buffer, CQ_CERTIFICATE_SIZE) != 0) {
+        /* Leave no partial record behind */
+        (void)ftruncate(store->data_fd, (off_t)idx * CQ_CERTIFICATE_SIZE);
+        return CQ_ERROR_IO;
+    }
+
+    store->record_count = idx + 1u;
+    if (map_records(store, store->record_count) != 0) {
+        return CQ_ERROR_IO;
+    }
+
+    if ((uint64_t)store->record_count * 2u > store->capacity) {
+        ret = index_rebuild(store, store->capacity * 2u);
+    } else if (index_insert(store, TABLE_TARGET, idx) != 0 ||
+               index_insert(store, TABLE_SOURCE, idx) != 0) {
+        /* Damaged since open; the rebuild covers the new record too */
+        ret = index_rebuild(store, store->capacity);
+    } else {
+        /* Written last: a crash before this line forces a rebuild */
+        index_header(store)->record_count = store->record_count;
+    }
+    if (ret != 0) {
+        return ret;
+    }
+
+    if (record_index != NULL) {
+        *record_index = idx;
+    }
+    return 0;
+}
+
+int cq_cert_store_get(const cq_cert_store_t *store,
+                      uint32_t record_index,
+                      cq_certificate_view_t *view)
+{
+    if (store == NULL || store->records == NULL || view == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    if (record_index >= store->record_count) {
+        view->data = NULL;
+        return CQ_CERT_STORE_NOT_FOUND;
+    }
+
+    return cq_certificate_view_open(view, record_at(store, record_index),
+                                    CQ_CERTIFICATE_SIZE);
+}
+
+static int find_by(const cq_cert_store_t *store, int which,
+                   const uint8_t hash[32], cq_certificate_view_t *view)
+{
+    uint32_t record_index;
+
+    if (store == NULL || store->index == NULL || hash == NULL || view == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    view->data = NULL;
+    int ret = index_lookup(store, which, hash, &record_index);
+    if (ret == INDEX_CORRUPT) {
+        /* Lookups may run concurrently, so answer from the records and
+           leave the rebuild to the next append or open */
+        ret = scan_records(store, which, hash, &record_index);
+    }
+    if (ret != 0) {
+        return CQ_CERT_STORE_NOT_FOUND;
+    }
+
+    return cq_cert_store_get(store, record_index, view);
+}
+
+int cq_cert_store_find_target(const cq_cert_store_t *store,
+                              const uint8_t hash[32],
+                              cq_certificate_view_t *view)
+{
+    return find_by(store, TABLE_TARGET, hash, view);
+}
+
+int cq_cert_store_find_source(const cq_cert_store_t *store,
+                              const uint8_t hash[32],
+                              cq_certificate_view_t *view)
+{
+    return find_by(store, TABLE_SOURCE, hash, view);
+}
+
+/* ============================================================================
+ * Bulk Verification
+ * ============================================================================ */
+
+typedef struct {
+    const cq_cert_store_t *store;
+    uint32_t begin;
+    uint32_t end;
+    bool *results;
+    size_t valid;
+} verify_range_t;
+
+static void *verify_range(void *arg)
+{
+    verify_range_t *r = (verify_range_t *)arg;
+    cq_certificate_view_t view;
+
+    for (uint32_t i = r->begin; i < r->end; i++) {
+        bool ok = cq_certificate_view_open(&view, record_at(r->store, i),
+                                           CQ_CERTIFICATE_SIZE) == 0;
+        if (r->results != NULL) {
+            r->results[i] = ok;
+        }
+        r->valid += ok ? 1u : 0u;
+    }
+    return NULL;
+}
+
+#define VERIFY_MAX_THREADS 64
+
+size_t cq_cert_store_verify_all(const cq_cert_store_t *store,
+                                unsigned threads,
+                                bool *results)
+{
+    verify_range_t ranges[VERIFY_MAX_THREADS];
+    pthread_t tids[VERIFY_MAX_THREADS];
+    bool started[VERIFY_MAX_THREADS];
+    size_t valid = 0;
+
+    if (store == NULL || store->records == NULL) {
+        return 0;
+    }
+
+    if (threads == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (online > 0) ? (unsigned)online : 1u;
+    }
+    if (threads > VERIFY_MAX_THREADS) {
+        threads = VERIFY_MAX_THREADS;
+    }
+    if (threads > store->record_count) {
+        threads = (store->record_count > 0) ? store->record_count : 1u;
+    }
+
+    uint32_t per = store->record_count / threads;
+    uint32_t extra = store->record_count % threads;
+    uint32_t begin = 0;
+
+    for (unsigned t = 0; t < threads; t++) {
+        uint32_t len = per + ((t < extra) ? 1u : 0u);
+        ranges[t].store = store;
+        ranges[t].begin = begin;
+        ranges[t].end = begin + len;
+        ranges[t].results = results;
+        ranges[t].valid = 0;
+        begin += len;
+
+        /* Range 0 runs on the calling thread */
+        started[t] = (t > 0) &&
+                     pthread_create(&tids[t], NULL, verify_range, &ranges[t]) == 0;
+    }
+
+    for (unsigned t = 0; t < threads; t++) {
+        if (!started[t]) {
+            verify_range(&ranges[t]);
+        }
+    }
+    for (unsigned t = 0; t < threads; t++) {
+        if (started[t]) {
+            pthread_join(tids[t], NULL);
+        }
+        valid += ranges[t].valid;
+    }
+
+    return valid;
+}
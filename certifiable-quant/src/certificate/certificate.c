@@ -13,10 +13,72 @@
 
 #include "certificate.h"
 #include "sha256.h"
+#include "ed25519.h"
 #include <string.h>
 #include <stdio.h>
 #include <time.h>
 
+/* ============================================================================
+ * Wire Encoding (little-endian, CQ_CERT_OFF_* layout)
+ * ============================================================================ */
+
+static void store_le32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static void store_le64(uint8_t *p, uint64_t v)
+{
+    store_le32(p, (uint32_t)v);
+    store_le32(p + 4, (uint32_t)(v >> 32));
+}
+
+static void store_le_double(uint8_t *p, double d)
+{
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof(bits));
+    store_le64(p, bits);
+}
+
+/* Sections 1-6: the CQ_CERT_OFF_MERKLE_ROOT bytes covered by the root */
+static void encode_content(const cq_certificate_t *cert, uint8_t *d)
+{
+    /* 1. Metadata Header */
+    memcpy(d + CQ_CERT_OFF_MAGIC, cert->magic, 4);
+    memcpy(d + CQ_CERT_OFF_VERSION, cert->version, 4);
+    store_le64(d + CQ_CERT_OFF_TIMESTAMP, cert->timestamp);
+
+    /* 2. Scope Declaration */
+    d[CQ_CERT_OFF_SCOPE_SYMMETRIC] = cert->scope_symmetric_only;
+    d[CQ_CERT_OFF_SCOPE_FORMAT] = cert->scope_format;
+    memcpy(d + CQ_CERT_OFF_SCOPE_RESERVED, cert->_scope_reserved, 6);
+
+    /* 3. Source Identity */
+    memcpy(d + CQ_CERT_OFF_SOURCE_HASH, cert->source_model_hash, 32);
+    memcpy(d + CQ_CERT_OFF_BN_HASH, cert->bn_folding_hash, 32);
+    d[CQ_CERT_OFF_BN_STATUS] = cert->bn_folding_status;
+    memcpy(d + CQ_CERT_OFF_SOURCE_RESERVED, cert->_source_reserved, 7);
+
+    /* 4. Mathematical Core */
+    memcpy(d + CQ_CERT_OFF_ANALYSIS_DIGEST, cert->analysis_digest, 32);
+    memcpy(d + CQ_CERT_OFF_CALIBRATION_DIGEST, cert->calibration_digest, 32);
+    memcpy(d + CQ_CERT_OFF_VERIFICATION_DIGEST, cert->verification_digest, 32);
+
+    /* 5. Claims */
+    store_le_double(d + CQ_CERT_OFF_EPSILON_0, cert->epsilon_0_claimed);
+    store_le_double(d + CQ_CERT_OFF_EPSILON_TOTAL, cert->epsilon_total_claimed);
+    store_le_double(d + CQ_CERT_OFF_EPSILON_MAX, cert->epsilon_max_measured);
+    store_le_double(d + CQ_CERT_OFF_CLAIMS_RESERVED, cert->_claims_reserved);
+
+    /* 6. Target Identity */
+    memcpy(d + CQ_CERT_OFF_TARGET_HASH, cert->target_model_hash, 32);
+    store_le32(d + CQ_CERT_OFF_PARAM_COUNT, cert->target_param_count);
+    store_le32(d + CQ_CERT_OFF_LAYER_COUNT, cert->target_layer_count);
+}
+
 /* ============================================================================
  * Builder Interface
  * ============================================================================ */
@@ -258,17 +320,13 @@ void cq_certificate_compute_merkle(const cq_certificate_t *cert,
     /*
      * Merkle root computation:
      * Hash all sections except merkle_root and signature.
-     * This includes bytes 0 through 263 (264 bytes total before integrity section).
+     * This includes bytes 0 through 263 (264 bytes total before integrity section),
+     * in wire encoding so the root matches the serialised form on any host.
      */
-    cq_sha256_ctx_t ctx;
-    cq_sha256_init(&ctx);
-
-    /* Hash everything before the integrity section */
-    /* Sections 1-6: 264 bytes */
-    const size_t content_size = offsetof(cq_certificate_t, merkle_root);
-    cq_sha256_update(&ctx, (const uint8_t *)cert, content_size);
+    uint8_t content[CQ_CERT_OFF_MERKLE_ROOT];
+    encode_content(cert, content);
 
-    cq_sha256_final(&ctx, out_hash);
+    cq_sha256(content, sizeof(content), out_hash);
 }
 
 /* ============================================================================
@@ -312,6 +370,85 @@ bool cq_certificate_verify_header(const cq_certificate_t *cert)
     return true;
 }
 
+/* ============================================================================
+ * Signing
+ * ============================================================================ */
+
+int cq_certificate_sign(cq_certificate_t *cert,
+                        const uint8_t secret_key[64])
+{
+    if (cert == NULL || secret_key == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    if (!cq_certificate_verify_integrity(cert)) {
+        return CQ_ERROR_MERKLE_MISMATCH;
+    }
+
+    cq_ed25519_sign(secret_key, cert->merkle_root, 32, cert->signature);
+    return 0;
+}
+
+bool cq_certificate_verify_signature(const cq_certificate_t *cert,
+                                     const uint8_t public_key[32])
+{
+    if (cert == NULL || public_key == NULL) {
+        return false;
+    }
+
+    if (!cq_certificate_verify_integrity(cert)) {
+        return false;
+    }
+
+    return cq_ed25519_verify(public_key, cert->merkle_root, 32, cert->signature);
+}
+
+size_t cq_certificate_verify_signatures(const cq_certificate_t *certs,
+                                        const uint8_t (*public_keys)[32],
+                                        size_t count,
+                                        bool *results)
+{
+    cq_ed25519_item_t items[CQ_ED25519_BATCH_CHUNK];
+    bool item_ok[CQ_ED25519_BATCH_CHUNK];
+    size_t item_cert[CQ_ED25519_BATCH_CHUNK];
+    size_t valid = 0;
+
+    if (certs == NULL || public_keys == NULL) {
+        return 0;
+    }
+
+    for (size_t off = 0; off < count; off += CQ_ED25519_BATCH_CHUNK) {
+        size_t end = (count - off > CQ_ED25519_BATCH_CHUNK)
+                   ? off + CQ_ED25519_BATCH_CHUNK : count;
+        size_t n = 0;
+
+        for (size_t i = off; i < end; i++) {
+            if (results != NULL) {
+                results[i] = false;
+            }
+            if (!cq_certificate_verify_integrity(&certs[i])) {
+                continue;
+            }
+            items[n].public_key = public_keys[i];
+            items[n].signature = certs[i].signature;
+            items[n].message = certs[i].merkle_root;
+            items[n].message_len = 32;
+            item_cert[n] = i;
+            n++;
+        }
+
+        valid += cq_ed25519_verify_batch(items, n, item_ok);
+
+        if (results != NULL) {
+            for (size_t k = 0; k < n; k++) {
+                results[item_cert[k]] = item_ok[k];
+            }
+        }
+    }
+
+    return valid;
+}
+
 /* ============================================================================
  * Serialisation
  * ============================================================================ */
@@ -324,9 +461,11 @@ int cq_certificate_serialise(const cq_certificate_t *cert,
         return CQ_ERROR_NULL_POINTER;
     }
 
-    /* Certificate is already in serialisable form (fixed layout) */
-    memcpy(buffer, cert, sizeof(cq_certificate_t));
-    *size = sizeof(cq_certificate_t);
+    /* Fixed layout, explicit byte order: the view reads it on any host */
+    encode_content(cert, buffer);
+    memcpy(buffer + CQ_CERT_OFF_MERKLE_ROOT, cert->merkle_root, 32);
+    memcpy(buffer + CQ_CERT_OFF_SIGNATURE, cert->signature, 64);
+    *size = CQ_CERTIFICATE_SIZE;
 
     return 0;
 }
@@ -339,15 +478,17 @@ int cq_certificate_deserialise(const uint8_t *buffer,
         return CQ_ERROR_NULL_POINTER;
     }
 
-    if (size < sizeof(cq_certificate_t)) {
-        return -2;  /* Buffer too small */
+    if (size < CQ_CERTIFICATE_SIZE) {
+        return CQ_ERROR_BUFFER_TOO_SMALL;
     }
 
-    memcpy(cert, buffer, sizeof(cq_certificate_t));
+    /* Same little-endian decode as the view, without the root check */
+    const cq_certificate_view_t view = { buffer };
+    cq_certificate_view_decode(&view, cert);
 
     /* Verify header after deserialisation */
     if (!cq_certificate_verify_header(cert)) {
-        return -3;  /* Invalid header */
+        return CQ_ERROR_INVALID_HEADER;
     }
 
     return 0;
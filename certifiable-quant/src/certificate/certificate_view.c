@@ -0,0 +1,238 @@
+/**
+ * @file certificate_view.c
+ * @project Certifiable-Quant
+ * @brief Zero-copy validated view over serialised certificates
+ *
+ * @details Validates a serialised certificate where it lies and decodes
+ *          fields from their fixed wire offsets with explicit little-endian
+ *          loads, so archives can be scanned without copying each record
+ *          into a cq_certificate_t and without relying on the host's
+ *          struct layout.
+ *
+ * @traceability SRS-005-CERTIFICATE, CQ-STRUCT-001 §7
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include "certificate.h"
+#include "ed25519.h"
+#include "sha256.h"
+#include <string.h>
+
+/* ============================================================================
+ * Little-Endian Loads
+ * ============================================================================ */
+
+static uint32_t load_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0]
+         | ((uint32_t)p[1] << 8)
+         | ((uint32_t)p[2] << 16)
+         | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t load_le64(const uint8_t *p)
+{
+    return (uint64_t)load_le32(p) | ((uint64_t)load_le32(p + 4) << 32);
+}
+
+static double load_le_double(const uint8_t *p)
+{
+    uint64_t bits = load_le64(p);
+    double d;
+    memcpy(&d, &bits, sizeof(d));
+    return d;
+}
+
+/* ============================================================================
+ * Validation
+ * ============================================================================ */
+
+int cq_certificate_view_open(cq_certificate_view_t *view,
+                             const uint8_t *buffer,
+                             size_t size)
+{
+    if (view == NULL || buffer == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    view->data = NULL;
+
+    if (size < CQ_CERTIFICATE_SIZE) {
+        return CQ_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    /* Same checks as cq_certificate_verify_header() */
+    if (memcmp(buffer + CQ_CERT_OFF_MAGIC, CQ_CERTIFICATE_MAGIC, 4) != 0 ||
+        buffer[CQ_CERT_OFF_SCOPE_SYMMETRIC] != CQ_SCOPE_SYMMETRIC_ONLY ||
+        (buffer[CQ_CERT_OFF_SCOPE_FORMAT] != CQ_FORMAT_Q16_16_CODE &&
+         buffer[CQ_CERT_OFF_SCOPE_FORMAT] != CQ_FORMAT_Q8_24_CODE)) {
+        return CQ_ERROR_INVALID_HEADER;
+    }
+
+    uint8_t root[CQ_SHA256_DIGEST_SIZE];
+    cq_sha256(buffer, CQ_CERT_OFF_MERKLE_ROOT, root);
+    if (memcmp(root, buffer + CQ_CERT_OFF_MERKLE_ROOT, sizeof(root)) != 0) {
+        return CQ_ERROR_MERKLE_MISMATCH;
+    }
+
+    view->data = buffer;
+    return 0;
+}
+
+/* ============================================================================
+ * Field Accessors
+ * ============================================================================ */
+
+const uint8_t *cq_certificate_view_version(const cq_certificate_view_t *view)
+{
+    return view->data + CQ_CERT_OFF_VERSION;
+}
+
+uint64_t cq_certificate_view_timestamp(const cq_certificate_view_t *view)
+{
+    return load_le64(view->data + CQ_CERT_OFF_TIMESTAMP);
+}
+
+uint8_t cq_certificate_view_scope_format(const cq_certificate_view_t *view)
+{
+    return view->data[CQ_CERT_OFF_SCOPE_FORMAT];
+}
+
+uint8_t cq_certificate_view_bn_folding_status(const cq_certificate_view_t *view)
+{
+    return view->data[CQ_CERT_OFF_BN_STATUS];
+}
+
+const uint8_t *cq_certificate_view_source_hash(const cq_certificate_view_t *view)
+{
+    return view->data + CQ_CERT_OFF_SOURCE_HASH;
+}
+
+const uint8_t *cq_certificate_view_bn_hash(const cq_certificate_view_t *view)
+{
+    return view->data + CQ_CERT_OFF_BN_HASH;
+}
+
+const uint8_t *cq_certificate_view_analysis_digest(const cq_certificate_view_t *view)
+{
+    return view->data + CQ_CERT_OFF_ANALYSIS_DIGEST;
+}
+
+const uint8_t *cq_certificate_view_calibration_digest(const cq_certificate_view_t *view)
+{
+    return view->data + CQ_CERT_OFF_CALIBRATION_DIGEST;
+}
+
+const uint8_t *cq_certificate_view_verification_digest(const cq_certificate_view_t *view)
+{
+    return view->data + CQ_CERT_OFF_VERIFICATION_DIGEST;
+}
+
+double cq_certificate_view_epsilon_0(const cq_certificate_view_t *view)
+{
+    return load_le_double(view->data + CQ_CERT_OFF_EPSILON_0);
+}
+
+double cq_certificate_view_epsilon_total(const cq_certificate_view_t *view)
+{
+    return load_le_double(view->data + CQ_CERT_OFF_EPSILON_TOTAL);
+}
+
+double cq_certificate_view_epsilon_max(const cq_certificate_view_t *view)
+{
+    return load_le_double(view->data + CQ_CERT_OFF_EPSILON_MAX);
+}
+
+const uint8_t *cq_certificate_view_target_hash(const cq_certificate_view_t *view)
+{
+    return view->data + CQ_CERT_OFF_TARGET_HASH;
+}
+
+uint32_t cq_certificate_view_param_count(const cq_certificate_view_t *view)
+{
+    return load_le32(view->data + CQ_CERT_OFF_PARAM_COUNT);
+}
+
+uint32_t cq_certificate_view_layer_count(const cq_certificate_view_t *view)
+{
+    return load_le32(view->data + CQ_CERT_OFF_LAYER_COUNT);
+}
+
+const uint8_t *cq_certificate_view_merkle_root(const cq_certificate_view_t *view)
+{
+    return view->data + CQ_CERT_OFF_MERKLE_ROOT;
+}
+
+const uint8_t *cq_certificate_view_signature(const cq_certificate_view_t *view)
+{
+    return view->data + CQ_CERT_OFF_SIGNATURE;
+}
+
+/* ============================================================================
+ * Signature and Decode
+ * ============================================================================ */
+
+bool cq_certificate_view_verify_signature(const cq_certificate_view_t *view,
+                                          const uint8_t public_key[32])
+{
+    if (view == NULL || view->data == NULL || public_key == NULL) {
+        return false;
+    }
+
+    return cq_ed25519_verify(public_key,
+                             view->data + CQ_CERT_OFF_MERKLE_ROOT, 32,
+                             view->data + CQ_CERT_OFF_SIGNATURE);
+}
+
+int cq_certificate_view_decode(const cq_certificate_view_t *view,
+                               cq_certificate_t *cert)
+{
+    if (view == NULL || view->data == NULL || cert == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    const uint8_t *d = view->data;
+
+    memset(cert, 0, sizeof(*cert));
+
+    /* 1. Metadata Header */
+    memcpy(cert->magic, d + CQ_CERT_OFF_MAGIC, 4);
+    memcpy(cert->version, d + CQ_CERT_OFF_VERSION, 4);
+    cert->timestamp = load_le64(d + CQ_CERT_OFF_TIMESTAMP);
+
+    /* 2. Scope Declaration */
+    cert->scope_symmetric_only = d[CQ_CERT_OFF_SCOPE_SYMMETRIC];
+    cert->scope_format = d[CQ_CERT_OFF_SCOPE_FORMAT];
+    memcpy(cert->_scope_reserved, d + CQ_CERT_OFF_SCOPE_RESERVED, 6);
+
+    /* 3. Source Identity */
+    memcpy(cert->source_model_hash, d + CQ_CERT_OFF_SOURCE_HASH, 32);
+    memcpy(cert->bn_folding_hash, d + CQ_CERT_OFF_BN_HASH, 32);
+    cert->bn_folding_status = d[CQ_CERT_OFF_BN_STATUS];
+    memcpy(cert->_source_reserved, d + CQ_CERT_OFF_SOURCE_RESERVED, 7);
+
+    /* 4. Mathematical Core */
+    memcpy(cert->analysis_digest, d + CQ_CERT_OFF_ANALYSIS_DIGEST, 32);
+    memcpy(cert->calibration_digest, d + CQ_CERT_OFF_CALIBRATION_DIGEST, 32);
+    memcpy(cert->verification_digest, d + CQ_CERT_OFF_VERIFICATION_DIGEST, 32);
+
+    /* 5. Claims */
+    cert->epsilon_0_claimed = load_le_double(d + CQ_CERT_OFF_EPSILON_0);
+    cert->epsilon_total_claimed = load_le_double(d + CQ_CERT_OFF_EPSILON_TOTAL);
+    cert->epsilon_max_measured = load_le_double(d + CQ_CERT_OFF_EPSILON_MAX);
+    cert->_claims_reserved = load_le_double(d + CQ_CERT_OFF_CLAIMS_RESERVED);
+
+    /* 6. Target Identity */
+    memcpy(cert->target_model_hash, d + CQ_CERT_OFF_TARGET_HASH, 32);
+    cert->target_param_count = load_le32(d + CQ_CERT_OFF_PARAM_COUNT);
+    cert->target_layer_count = load_le32(d + CQ_CERT_OFF_LAYER_COUNT);
+
+    /* 7. Integrity */
+    memcpy(cert->merkle_root, d + CQ_CERT_OFF_MERKLE_ROOT, 32);
+    memcpy(cert->signature, d + CQ_CERT_OFF_SIGNATURE, 64);
+
+    return 0;
+}
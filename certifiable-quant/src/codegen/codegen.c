@@ -0,0 +1,857 @@
+/**
+ * @file codegen.c
+ * @project Certifiable-Quant
+ * @brief Model-specialized C code generator
+ *
+ * @traceability CQ-MATH-001 §3-§4, CQ-STRUCT-001 §5.3
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include "codegen.h"
+#include <string.h>
+
+/* Softmax constants (Q16.16, CQ-MATH-001 §4.2.2); must match layers.c */
+#define SOFTMAX_LOG2E   94548
+#define SOFTMAX_C1      45426
+#define SOFTMAX_C2      15744
+
+/* Values per line in emitted arrays */
+#define VALUES_PER_LINE 8u
+
+typedef struct {
+    FILE *out;
+    const cq_engine_t *engine;
+    char name[CQ_CODEGEN_MAX_PREFIX + 1];
+    char macro[CQ_CODEGEN_MAX_PREFIX + 1];
+    uint32_t unroll;
+} gen_t;
+
+/* How a weighted kernel decides between int64 and saturating MACs */
+typedef enum {
+    FAST_NEVER = 0,                 /* Fast path disabled */
+    FAST_ALWAYS,                    /* Proof holds for every int32 input */
+    FAST_CHECK                      /* Compare max|x| with a constant bound */
+} fast_mode_t;
+
+/* ============================================================================
+ * DVM Primitives (emitted verbatim; semantics of primitives.c)
+ * ============================================================================ */
+
+static const char *const primitives[] = {
+    "#define CQG_OVERFLOW   0x01u",
+    "#define CQG_UNDERFLOW  0x02u",
+    "",
+    "static inline int32_t cqg_clamp32(int64_t x, uint32_t *f)",
+    "{",
+    "    if (x > INT32_MAX) { *f |= CQG_OVERFLOW; return INT32_MAX; }",
+    "    if (x < INT32_MIN) { *f |= CQG_UNDERFLOW; return INT32_MIN; }",
+    "    return (int32_t)x;",
+    "}",
+    "",
+    "static inline int64_t cqg_add64_sat(int64_t a, int64_t b, uint32_t *f)",
+    "{",
+    "    if (b > 0 && a > INT64_MAX - b) { *f |= CQG_OVERFLOW; return INT64_MAX; }",
+    "    if (b < 0 && a < INT64_MIN - b) { *f |= CQG_UNDERFLOW; return INT64_MIN; }",
+    "    return a + b;",
+    "}",
+    "",
+    "static inline int32_t cqg_round_shift_rne(int64_t x, uint32_t shift, uint32_t *f)",
+    "{",
+    "    if (shift > 62u) { *f |= CQG_OVERFLOW; return 0; }",
+    "    if (shift == 0u) { return cqg_clamp32(x, f); }",
+    "    const int64_t divisor = (int64_t)1 << shift;",
+    "    const int64_t half = divisor / 2;",
+    "    int64_t quot = x / divisor;",
+    "    const int64_t rem = x % divisor;",
+    "    if (rem > half) { quot += 1; }",
+    "    else if (rem < -half) { quot -= 1; }",
+    "    else if (rem == half) { quot += (quot & 1); }",
+    "    else if (rem == -half) { quot -= (quot & 1); }",
+    "    return cqg_clamp32(quot, f);",
+    "}",
+    "",
+    "static inline int32_t cqg_requantize(int64_t acc, int32_t shift, uint32_t *f)",
+    "{",
+    "    if (shift > 0) { return cqg_round_shift_rne(acc, (uint32_t)shift, f); }",
+    "    if (shift == 0) { return cqg_clamp32(acc, f); }",
+    "    const int32_t up = -shift;",
+    "    if (up >= 32) {",
+    "        return (acc == 0) ? 0 : cqg_clamp32((acc > 0) ? INT64_MAX : INT64_MIN, f);",
+    "    }",
+    "    if (acc > ((int64_t)INT32_MAX >> up) || acc < -((int64_t)1 << (31 - up))) {",
+    "        return cqg_clamp32((acc > 0) ? INT64_MAX : INT64_MIN, f);",
+    "    }",
+    "    return (int32_t)(acc * ((int64_t)1 << up));",
+    "}",
+    "",
+    "static inline int64_t cqg_mac(int64_t acc, int32_t w, int32_t x, int fast, uint32_t *f)",
+    "{",
+    "    const int64_t p = (int64_t)w * (int64_t)x;",
+    "    return fast ? acc + p : cqg_add64_sat(acc, p, f);",
+    "}",
+    "",
+    "static inline uint32_t cqg_max_abs(const int32_t *x, uint32_t n)",
+    "{",
+    "    uint32_t m = 0;",
+    "    for (uint32_t i = 0; i < n; i++) {",
+    "        const uint32_t mag = (x[i] < 0) ? (uint32_t)0 - (uint32_t)x[i] : (uint32_t)x[i];",
+    "        m = (mag > m) ? mag : m;",
+    "    }",
+    "    return m;",
+    "}",
+    "",
+    "static inline int64_t cqg_rne_shift64(int64_t x, uint32_t shift)",
+    "{",
+    "    const int64_t divisor = (int64_t)1 << shift;",
+    "    const int64_t half = divisor / 2;",
+    "    int64_t quot = x / divisor;",
+    "    const int64_t rem = x % divisor;",
+    "    if (rem > half || (rem == half && (quot & 1))) { quot += 1; }",
+    "    else if (rem < -half || (rem == -half && (quot & 1))) { quot -= 1; }",
+    "    return quot;",
+    "}",
+    "",
+    "static inline int64_t cqg_div_rne(int64_t num, int64_t den)",
+    "{",
+    "    int64_t quot = num / den;",
+    "    const int64_t rem = num % den;",
+    "    const int64_t abs_rem2 = (rem >= 0) ? 2 * rem : -2 * rem;",
+    "    if (abs_rem2 > den || (abs_rem2 == den && (quot & 1))) {",
+    "        quot += (num >= 0) ? 1 : -1;",
+    "    }",
+    "    return quot;",
+    "}",
+    "",
+};
+
+/* exp_q16 of layers.c, only emitted for models with a Softmax layer */
+static const char *const softmax_exp[] = {
+    "static inline int64_t cqg_exp_q16(int64_t d)",
+    "{",
+    "    const int64_t t = cqg_rne_shift64(d * CQG_LOG2E, 16u);",
+    "    int64_t k = t / 65536;",
+    "    if (k * 65536 > t) { k -= 1; }",
+    "    const int64_t fr = t - k * 65536;",
+    "    const int64_t f2 = cqg_rne_shift64(fr * fr, 16u);",
+    "    const int64_t poly = 65536 + cqg_rne_shift64(CQG_C1 * fr, 16u)",
+    "                               + cqg_rne_shift64(CQG_C2 * f2, 16u);",
+    "    if (k == 0) { return poly; }",
+    "    if (-k > 40) { return 0; }",
+    "    return cqg_rne_shift64(poly, (uint32_t)(-k));",
+    "}",
+    "",
+};
+
+/* ============================================================================
+ * Helpers
+ * ============================================================================ */
+
+static void emit_lines(gen_t *g, const char *const *lines, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        fprintf(g->out, "%s\n", lines[i]);
+    }
+}
+
+static bool is_weighted(uint32_t type)
+{
+    return type == CQ_LAYER_LINEAR || type == CQ_LAYER_CONV2D;
+}
+
+/* Same rule as the engine: a weighted layer followed by ReLU is one kernel */
+static bool fuses_with_next(const cq_engine_t *engine, uint32_t i)
+{
+    return i + 1 < engine->layer_count &&
+           is_weighted(engine->headers[i].layer_type) &&
+           engine->headers[i + 1].layer_type == CQ_LAYER_RELU;
+}
+
+static int32_t acc_shift(const cq_layer_header_t *h)
+{
+    return (int32_t)h->weight_spec.scale_exp
+         + (int32_t)h->input_spec.scale_exp
+         - (int32_t)h->output_spec.scale_exp;
+}
+
+static int32_t act_shift(const cq_layer_header_t *h)
+{
+    return (int32_t)h->input_spec.scale_exp - (int32_t)h->output_spec.scale_exp;
+}
+
+static bool valid_prefix(const char *p)
+{
+    size_t n = strlen(p);
+
+    if (n == 0 || n > CQ_CODEGEN_MAX_PREFIX) {
+        return false;
+    }
+    for (size_t i = 0; i < n; i++) {
+        const char c = p[i];
+        const bool alpha = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+        if (!alpha && (i == 0 || c < '0' || c > '9')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* int32 literal; INT32_MIN has no literal form */
+static void emit_i32(gen_t *g, int32_t v)
+{
+    if (v == INT32_MIN) {
+        fputs("INT32_MIN", g->out);
+    } else {
+        fprintf(g->out, "%ld", (long)v);
+    }
+}
+
+static void emit_i64(gen_t *g, int64_t v)
+{
+    if (v == INT64_MIN) {
+        fputs("INT64_MIN", g->out);
+    } else {
+        fprintf(g->out, "INT64_C(%lld)", (long long)v);
+    }
+}
+
+static const void *layer_bias(const cq_engine_t *engine, const cq_layer_header_t *h)
+{
+    return (h->bias_len != 0) ? (const void *)(engine->blob + h->bias_offset) : NULL;
+}
+
+/* Row-major weight k of a layer, whatever its blob layout and storage */
+static int32_t weight_at(const cq_layer_header_t *h, const void *w, uint32_t k)
+{
+    if (h->weight_spec.storage == CQ_STORAGE_INT16) {
+        return ((const int16_t *)w)[k];
+    }
+    if (h->weight_layout == CQ_WEIGHT_LAYOUT_PANEL) {
+        const uint32_t r = k / h->weight_cols;
+        const uint32_t c = k % h->weight_cols;
+        return ((const int32_t *)w)[((size_t)(r / CQ_PANEL_ROWS) * h->weight_cols + c) *
+                                    CQ_PANEL_ROWS + r % CQ_PANEL_ROWS];
+    }
+    return ((const int32_t *)w)[k];
+}
+
+/* C type of the emitted weight array: int16 storage stays int16 */
+static const char *weight_type(const cq_layer_header_t *h)
+{
+    return (h->weight_spec.storage == CQ_STORAGE_INT16) ? "int16_t" : "int32_t";
+}
+
+/* Weights (always row-major) and bias of layer i as static const arrays */
+static void emit_params(gen_t *g, uint32_t i)
+{
+    const cq_layer_header_t *h = &g->engine->headers[i];
+    const void *w = (const void *)(g->engine->blob + h->weight_offset);
+    const uint32_t count = h->weight_rows * h->weight_cols;
+    const void *bias = layer_bias(g->engine, h);
+
+    fprintf(g->out, "static const %s %s_w%u[%uu] = {",
+            weight_type(h), g->name, (unsigned)i, (unsigned)count);
+    for (uint32_t k = 0; k < count; k++) {
+        fputs((k % VALUES_PER_LINE == 0) ? "\n    " : " ", g->out);
+        emit_i32(g, weight_at(h, w, k));
+        fputc(',', g->out);
+    }
+    fputs("\n};\n\n", g->out);
+
+    if (bias == NULL) {
+        return;
+    }
+    const bool wide = (h->bias_spec.format == CQ_FORMAT_Q32_32);
+    fprintf(g->out, "static const %s %s_b%u[%uu] = {",
+            wide ? "int64_t" : "int32_t", g->name, (unsigned)i, (unsigned)h->bias_len);
+    for (uint32_t k = 0; k < h->bias_len; k++) {
+        fputs((k % VALUES_PER_LINE == 0) ? "\n    " : " ", g->out);
+        if (wide) {
+            emit_i64(g, ((const int64_t *)bias)[k]);
+        } else {
+            emit_i32(g, ((const int32_t *)bias)[k]);
+        }
+        fputc(',', g->out);
+    }
+    fputs("\n};\n\n", g->out);
+}
+
+/*
+ * Overflow proof of a weighted layer as a bound on max|x|:
+ * n·|w| ≤ ⌊(2^63 − 1) / |x|⌋  ⇔  |x| ≤ ⌊(2^63 − 1) / (n·|w|)⌋ (CQ-MATH-001 §3.4).
+ */
+static fast_mode_t fast_mode(const gen_t *g, uint32_t i, uint64_t *limit)
+{
+    const cq_layer_header_t *h = &g->engine->headers[i];
+    const uint64_t partial = (uint64_t)h->weight_cols * g->engine->state[i].weight_max_mag;
+
+    *limit = 0;
+    if (!g->engine->fast_path_enabled) {
+        return FAST_NEVER;
+    }
+    if (partial == 0) {
+        return FAST_ALWAYS;
+    }
+    *limit = ((((uint64_t)1 << 63) - 1) / partial);
+    /* |x| of an int32 is at most 2^31 */
+    return (*limit >= ((uint64_t)1 << 31)) ? FAST_ALWAYS : FAST_CHECK;
+}
+
+/*
+ * With wide_acc_enabled the engine accumulates a dense row-major layer in
+ * 128 bits whenever its proof fails; the generated kernels only saturate,
+ * so such a layer would give different results for large inputs.
+ */
+static bool may_widen(const cq_engine_t *engine, uint32_t i)
+{
+    const cq_layer_header_t *h = &engine->headers[i];
+    const uint64_t partial = (uint64_t)h->weight_cols * engine->state[i].weight_max_mag;
+
+    if (!engine->wide_acc_enabled || !is_weighted(h->layer_type) ||
+        engine->state[i].csr != NULL || h->weight_layout != CQ_WEIGHT_LAYOUT_ROW_MAJOR ||
+        partial == 0) {
+        return false;
+    }
+    /* Proof fails for some int32 input (|x| ≤ 2^31) */
+    return ((((uint64_t)1 << 63) - 1) / partial) < ((uint64_t)1 << 31);
+}
+
+static void emit_fast_decl(gen_t *g, fast_mode_t mode, uint64_t limit, uint32_t in_len)
+{
+    if (mode == FAST_CHECK) {
+        fprintf(g->out, "    const int fast = cqg_max_abs(x, %uu) <= %lluu;\n\n",
+                (unsigned)in_len, (unsigned long long)limit);
+    }
+}
+
+static const char *fast_expr(fast_mode_t mode)
+{
+    return (mode == FAST_CHECK) ? "fast" : (mode == FAST_ALWAYS) ? "1" : "0";
+}
+
+/* Bias, requantization and fused ReLU; same order as layers.c epilogue() */
+static void emit_epilogue(gen_t *g, uint32_t i, const char *row, const char *dst,
+                          const char *indent)
+{
+    const cq_layer_header_t *h = &g->engine->headers[i];
+    FILE *o = g->out;
+
+    if (h->bias_len != 0) {
+        fprintf(o, "%sacc = cqg_add64_sat(acc, %s_b%u[%s], f);\n",
+                indent, g->name, (unsigned)i, row);
+    }
+    fprintf(o, "%s{\n", indent);
+    fprintf(o, "%s    int32_t v = cqg_requantize(acc, %ld, f);\n", indent, (long)acc_shift(h));
+    if (fuses_with_next(g->engine, i)) {
+        const int32_t relu_shift = act_shift(&g->engine->headers[i + 1]);
+        fprintf(o, "%s    v = (v > 0) ? v : 0;\n", indent);
+        if (relu_shift != 0) {
+            fprintf(o, "%s    v = cqg_requantize(v, %ld, f);\n", indent, (long)relu_shift);
+        }
+    }
+    fprintf(o, "%s    %s = v;\n", indent, dst);
+    fprintf(o, "%s}\n", indent);
+}
+
+/* ============================================================================
+ * Layer Kernels
+ * ============================================================================ */
+
+/* Plain int64 dot product of row w with x, unrolled */
+static void emit_fast_dot(gen_t *g, uint32_t cols, const char *indent)
+{
+    FILE *o = g->out;
+    const uint32_t u = g->unroll;
+    uint32_t c0 = 0;
+
+    if (cols > u) {
+        const uint32_t main_len = cols - cols % u;
+
+        fprintf(o, "%sfor (uint32_t c = 0; c < %uu; c += %uu) {\n",
+                indent, (unsigned)main_len, (unsigned)u);
+        fprintf(o, "%s    acc += (int64_t)w[c] * x[c];\n", indent);
+        for (uint32_t k = 1; k < u; k++) {
+            fprintf(o, "%s    acc += (int64_t)w[c + %uu] * x[c + %uu];\n",
+                    indent, (unsigned)k, (unsigned)k);
+        }
+        fprintf(o, "%s}\n", indent);
+        c0 = main_len;
+    }
+    for (uint32_t c = c0; c < cols; c++) {
+        fprintf(o, "%sacc += (int64_t)w[%u] * x[%u];\n", indent, (unsigned)c, (unsigned)c);
+    }
+}
+
+static void emit_linear(gen_t *g, uint32_t i)
+{
+    const cq_layer_header_t *h = &g->engine->headers[i];
+    const uint32_t rows = h->weight_rows;
+    const uint32_t cols = h->weight_cols;
+    uint64_t limit;
+    const fast_mode_t mode = fast_mode(g, i, &limit);
+    FILE *o = g->out;
+
+    fprintf(o, "/* Layer %u: Linear %u x %u, requantize %ld%s */\n",
+            (unsigned)i, (unsigned)rows, (unsigned)cols, (long)acc_shift(h),
+            fuses_with_next(g->engine, i) ? ", ReLU" : "");
+    fprintf(o, "static void %s_l%u(const int32_t *x, int32_t *y, uint32_t *f)\n{\n",
+            g->name, (unsigned)i);
+    emit_fast_decl(g, mode, limit, cols);
+    fprintf(o, "    for (uint32_t r = 0; r < %uu; r++) {\n", (unsigned)rows);
+    fprintf(o, "        const %s *w = %s_w%u + r * %uu;\n",
+            weight_type(h), g->name, (unsigned)i, (unsigned)cols);
+    fprintf(o, "        int64_t acc = 0;\n\n");
+
+    if (mode == FAST_ALWAYS) {
+        emit_fast_dot(g, cols, "        ");
+    } else {
+        const char *indent = "        ";
+        if (mode == FAST_CHECK) {
+            fprintf(o, "        if (fast) {\n");
+            emit_fast_dot(g, cols, "            ");
+            fprintf(o, "        } else {\n");
+            indent = "            ";
+        }
+        fprintf(o, "%sfor (uint32_t c = 0; c < %uu; c++) {\n", indent, (unsigned)cols);
+        fprintf(o, "%s    acc = cqg_add64_sat(acc, (int64_t)w[c] * x[c], f);\n", indent);
+        fprintf(o, "%s}\n", indent);
+        if (mode == FAST_CHECK) {
+            fprintf(o, "        }\n");
+        }
+    }
+    fputc('\n', o);
+    emit_epilogue(g, i, "r", "y[r]", "        ");
+    fprintf(o, "    }\n}\n\n");
+}
+
+/* One kernel tap; kx is a literal or "kx" */
+static void emit_conv_tap(gen_t *g, const cq_layer_shape_t *sh, const char *kx,
+                          int64_t kx_val, const char *mode, const char *indent)
+{
+    FILE *o = g->out;
+    const unsigned s = (unsigned)sh->stride;
+    const unsigned p = (unsigned)sh->padding;
+    const unsigned wd = (unsigned)sh->in_width;
+
+    if (p == 0) {
+        fprintf(o, "%sacc = cqg_mac(acc, w_row[%s], x_row[ox * %uu + %s], %s, f);\n",
+                indent, kx, s, kx, mode);
+        return;
+    }
+    if (kx_val < 0) {
+        /* Loop variable: unsigned wrap marks columns in the zero padding */
+        fprintf(o, "%sif (ox * %uu + kx >= %uu && ox * %uu + kx - %uu < %uu) {\n",
+                indent, s, p, s, p, wd);
+        fprintf(o, "%s    acc = cqg_mac(acc, w_row[kx], x_row[ox * %uu + kx - %uu], %s, f);\n",
+                indent, s, p, mode);
+    } else if ((uint64_t)kx_val >= p) {
+        const unsigned d = (unsigned)kx_val - p;
+        fprintf(o, "%sif (ox * %uu + %uu < %uu) {\n", indent, s, d, wd);
+        fprintf(o, "%s    acc = cqg_mac(acc, w_row[%s], x_row[ox * %uu + %uu], %s, f);\n",
+                indent, kx, s, d, mode);
+    } else {
+        const unsigned d = p - (unsigned)kx_val;
+        fprintf(o, "%sif (ox * %uu >= %uu && ox * %uu - %uu < %uu) {\n",
+                indent, s, d, s, d, wd);
+        fprintf(o, "%s    acc = cqg_mac(acc, w_row[%s], x_row[ox * %uu - %uu], %s, f);\n",
+                indent, kx, s, d, mode);
+    }
+    fprintf(o, "%s}\n", indent);
+}
+
+static void emit_conv2d(gen_t *g, uint32_t i)
+{
+    const cq_layer_header_t *h = &g->engine->headers[i];
+    const cq_layer_shape_t *sh = &g->engine->shapes[i];
+    const cq_layer_state_t *st = &g->engine->state[i];
+    const unsigned C = (unsigned)sh->in_channels;
+    const unsigned H = (unsigned)sh->in_height;
+    const unsigned W = (unsigned)sh->in_width;
+    const unsigned kh = (unsigned)sh->kernel_h;
+    const unsigned kw = (unsigned)sh->kernel_w;
+    const unsigned s = (unsigned)sh->stride;
+    const unsigned p = (unsigned)sh->padding;
+    uint64_t limit;
+    const fast_mode_t mode = fast_mode(g, i, &limit);
+    const char *m = fast_expr(mode);
+    FILE *o = g->out;
+    char dst[96];
+
+    fprintf(o, "/* Layer %u: Conv2D %u x %u x %u x %u over %u x %u x %u, stride %u, "
+               "padding %u, requantize %ld%s */\n",
+            (unsigned)i, (unsigned)h->weight_rows, C, kh, kw, C, H, W, s, p,
+            (long)acc_shift(h), fuses_with_next(g->engine, i) ? ", ReLU" : "");
+    fprintf(o, "static void %s_l%u(const int32_t *x, int32_t *y, uint32_t *f)\n{\n",
+            g->name, (unsigned)i);
+    emit_fast_decl(g, mode, limit, st->in_len);
+    fprintf(o, "    for (uint32_t oc = 0; oc < %uu; oc++) {\n", (unsigned)h->weight_rows);
+    fprintf(o, "        const %s *w_oc = %s_w%u + oc * %uu;\n\n",
+            weight_type(h), g->name, (unsigned)i, (unsigned)h->weight_cols);
+    fprintf(o, "        for (uint32_t oy = 0; oy < %uu; oy++) {\n", (unsigned)st->out_height);
+    fprintf(o, "            for (uint32_t ox = 0; ox < %uu; ox++) {\n", (unsigned)st->out_width);
+    fprintf(o, "                int64_t acc = 0;\n\n");
+    fprintf(o, "                for (uint32_t ic = 0; ic < %uu; ic++) {\n", C);
+    fprintf(o, "                    for (uint32_t ky = 0; ky < %uu; ky++) {\n", kh);
+    if (p == 0) {
+        fprintf(o, "                        const uint32_t iy = oy * %uu + ky;\n", s);
+    } else {
+        fprintf(o, "                        const uint32_t iy = oy * %uu + ky - %uu;\n", s, p);
+        fprintf(o, "                        if (oy * %uu + ky < %uu || iy >= %uu) {\n", s, p, H);
+        fprintf(o, "                            continue;\n");
+        fprintf(o, "                        }\n");
+    }
+    fprintf(o, "                        const int32_t *x_row = x + (ic * %uu + iy) * %uu;\n", H, W);
+    fprintf(o, "                        const %s *w_row = w_oc + (ic * %uu + ky) * %uu;\n\n",
+            weight_type(h), kh, kw);
+
+    if (kw <= g->unroll) {
+        for (unsigned k = 0; k < kw; k++) {
+            char lit[16];
+            snprintf(lit, sizeof(lit), "%u", k);
+            emit_conv_tap(g, sh, lit, (int64_t)k, m, "                        ");
+        }
+    } else {
+        fprintf(o, "                        for (uint32_t kx = 0; kx < %uu; kx++) {\n", kw);
+        emit_conv_tap(g, sh, "kx", -1, m, "                            ");
+        fprintf(o, "                        }\n");
+    }
+    fprintf(o, "                    }\n");
+    fprintf(o, "                }\n\n");
+
+    snprintf(dst, sizeof(dst), "y[(oc * %uu + oy) * %uu + ox]",
+             (unsigned)st->out_height, (unsigned)st->out_width);
+    emit_epilogue(g, i, "oc", dst, "                ");
+    fprintf(o, "            }\n        }\n    }\n}\n\n");
+}
+
+static void emit_relu(gen_t *g, uint32_t i)
+{
+    const cq_layer_header_t *h = &g->engine->headers[i];
+    const int32_t shift = act_shift(h);
+    FILE *o = g->out;
+
+    fprintf(o, "/* Layer %u: ReLU, rescale %ld */\n", (unsigned)i, (long)shift);
+    fprintf(o, "static void %s_l%u(const int32_t *x, int32_t *y, uint32_t *f)\n{\n",
+            g->name, (unsigned)i);
+    if (shift == 0) {
+        fprintf(o, "    (void)f;\n");
+    }
+    fprintf(o, "    for (uint32_t i = 0; i < %uu; i++) {\n", (unsigned)g->engine->state[i].in_len);
+    fprintf(o, "        const int32_t v = (x[i] > 0) ? x[i] : 0;\n");
+    if (shift == 0) {
+        fprintf(o, "        y[i] = v;\n");
+    } else {
+        fprintf(o, "        y[i] = cqg_requantize(v, %ld, f);\n", (long)shift);
+    }
+    fprintf(o, "    }\n}\n\n");
+}
+
+static void emit_pool(gen_t *g, uint32_t i)
+{
+    const cq_layer_header_t *h = &g->engine->headers[i];
+    const cq_layer_shape_t *sh = &g->engine->shapes[i];
+    const cq_layer_state_t *st = &g->engine->state[i];
+    const bool is_max = (h->layer_type == CQ_LAYER_MAXPOOL);
+    const unsigned H = (unsigned)sh->in_height;
+    const unsigned W = (unsigned)sh->in_width;
+    const unsigned kh = (unsigned)sh->kernel_h;
+    const unsigned kw = (unsigned)sh->kernel_w;
+    const unsigned s = (unsigned)sh->stride;
+    FILE *o = g->out;
+
+    fprintf(o, "/* Layer %u: %s %u x %u, stride %u over %u x %u x %u, rescale %ld */\n",
+            (unsigned)i, is_max ? "MaxPool" : "AvgPool", kh, kw, s,
+            (unsigned)sh->in_channels, H, W, (long)act_shift(h));
+    fprintf(o, "static void %s_l%u(const int32_t *x, int32_t *y, uint32_t *f)\n{\n",
+            g->name, (unsigned)i);
+    fprintf(o, "    for (uint32_t c = 0; c < %uu; c++) {\n", (unsigned)sh->in_channels);
+    fprintf(o, "        for (uint32_t oy = 0; oy < %uu; oy++) {\n", (unsigned)st->out_height);
+    fprintf(o, "            for (uint32_t ox = 0; ox < %uu; ox++) {\n", (unsigned)st->out_width);
+    fprintf(o, "                const int32_t *win = x + (c * %uu + oy * %uu) * %uu + ox * %uu;\n",
+            H, s, W, s);
+    fprintf(o, "                int64_t acc = %s;\n\n", is_max ? "INT64_MIN" : "0");
+    fprintf(o, "                for (uint32_t ky = 0; ky < %uu; ky++) {\n", kh);
+    fprintf(o, "                    const int32_t *row = win + ky * %uu;\n", W);
+    if (kw <= g->unroll) {
+        for (unsigned k = 0; k < kw; k++) {
+            if (is_max) {
+                fprintf(o, "                    acc = (row[%u] > acc) ? row[%u] : acc;\n", k, k);
+            } else {
+                fprintf(o, "                    acc += row[%u];\n", k);
+            }
+        }
+    } else {
+        fprintf(o, "                    for (uint32_t kx = 0; kx < %uu; kx++) {\n", kw);
+        if (is_max) {
+            fprintf(o, "                        acc = (row[kx] > acc) ? row[kx] : acc;\n");
+        } else {
+            fprintf(o, "                        acc += row[kx];\n");
+        }
+        fprintf(o, "                    }\n");
+    }
+    fprintf(o, "                }\n\n");
+    if (!is_max) {
+        fprintf(o, "                acc = cqg_div_rne(acc, %u);\n", kh * kw);
+    }
+    fprintf(o, "                y[(c * %uu + oy) * %uu + ox] = cqg_requantize(acc, %ld, f);\n",
+            (unsigned)st->out_height, (unsigned)st->out_width, (long)act_shift(h));
+    fprintf(o, "            }\n        }\n    }\n}\n\n");
+}
+
+/* cq_layer_softmax() with the input conversion resolved at generation time */
+static void emit_softmax(gen_t *g, uint32_t i)
+{
+    const cq_layer_header_t *h = &g->engine->headers[i];
+    const uint32_t n = g->engine->state[i].in_len;
+    const int32_t in_exp = h->input_spec.scale_exp;
+    const int32_t out_shift = CQ_Q16_SHIFT - (int32_t)h->output_spec.scale_exp;
+    const int64_t floor_q16 = -((int64_t)1 << 31);
+    FILE *o = g->out;
+
+    fprintf(o, "/* Layer %u: Softmax over %u, input exp %ld, requantize %ld */\n",
+            (unsigned)i, (unsigned)n, (long)in_exp, (long)out_shift);
+    fprintf(o, "static void %s_l%u(const int32_t *x, int32_t *y, uint32_t *f)\n{\n",
+            g->name, (unsigned)i);
+    fprintf(o, "    int32_t m = x[0];\n");
+    fprintf(o, "    for (uint32_t i = 1; i < %uu; i++) {\n", (unsigned)n);
+    fprintf(o, "        m = (x[i] > m) ? x[i] : m;\n");
+    fprintf(o, "    }\n\n");
+    fprintf(o, "    int64_t sum = 0;\n");
+    fprintf(o, "    for (uint32_t i = 0; i < %uu; i++) {\n", (unsigned)n);
+    fprintf(o, "        int64_t d = (int64_t)x[i] - m;\n");
+    if (in_exp > CQ_Q16_SHIFT) {
+        fprintf(o, "        d = (d == 0) ? 0 : -cqg_rne_shift64(-d, %uu);\n",
+                (unsigned)(in_exp - CQ_Q16_SHIFT));
+    } else if (in_exp < CQ_Q16_SHIFT) {
+        const int32_t up = CQ_Q16_SHIFT - in_exp;
+        if (up >= 32) {
+            fprintf(o, "        d = ");
+            emit_i64(g, floor_q16);
+            fprintf(o, ";\n");
+        } else {
+            fprintf(o, "        d = (d < ");
+            emit_i64(g, floor_q16 / ((int64_t)1 << up));
+            fprintf(o, ") ? ");
+            emit_i64(g, floor_q16);
+            fprintf(o, " : d * ");
+            emit_i64(g, (int64_t)1 << up);
+            fprintf(o, ";\n");
+        }
+    }
+    fprintf(o, "        if (d < ");
+    emit_i64(g, floor_q16);
+    fprintf(o, ") {\n            d = ");
+    emit_i64(g, floor_q16);
+    fprintf(o, ";\n        }\n");
+    fprintf(o, "        const int64_t e = cqg_exp_q16(d);\n");
+    fprintf(o, "        y[i] = (int32_t)e;\n");
+    fprintf(o, "        sum += e;\n");
+    fprintf(o, "    }\n\n");
+    fprintf(o, "    const int64_t recip = cqg_div_rne((int64_t)1 << 48, sum);\n");
+    fprintf(o, "    for (uint32_t i = 0; i < %uu; i++) {\n", (unsigned)n);
+    fprintf(o, "        const int64_t p = cqg_rne_shift64((int64_t)y[i] * recip, 32u);\n");
+    fprintf(o, "        y[i] = cqg_requantize(p, %ld, f);\n", (long)out_shift);
+    fprintf(o, "    }\n}\n\n");
+}
+
+/* ============================================================================
+ * Model
+ * ============================================================================ */
+
+static void emit_preamble(gen_t *g, bool has_softmax)
+{
+    const cq_engine_t *e = g->engine;
+    FILE *o = g->out;
+
+    fprintf(o, "/*\n");
+    fprintf(o, " * %s.c - generated by cq_codegen_emit(); do not edit.\n", g->name);
+    fprintf(o, " *\n");
+    fprintf(o, " * %u layers, %u inputs, %u outputs (Q16.16 activations). Outputs and\n",
+            (unsigned)e->layer_count, (unsigned)e->state[0].in_len,
+            (unsigned)e->state[e->layer_count - 1].out_len);
+    fprintf(o, " * faults are bit-identical to cq_engine_run() on the source model.\n");
+    fprintf(o, " *\n");
+    fprintf(o, " *   void %s_run(const int32_t *input, int32_t *output, uint32_t *faults);\n",
+            g->name);
+    fprintf(o, " *\n");
+    fprintf(o, " * faults receives cq_fault_code_t bits. Activations are static, so\n");
+    fprintf(o, " * %s_run() is not reentrant. Define %s_HARNESS for a test driver.\n",
+            g->name, g->macro);
+    fprintf(o, " */\n\n");
+    fprintf(o, "#include <stdint.h>\n\n");
+    fprintf(o, "#define %s_INPUT_LEN   %uu\n", g->macro, (unsigned)e->state[0].in_len);
+    fprintf(o, "#define %s_OUTPUT_LEN  %uu\n\n", g->macro,
+            (unsigned)e->state[e->layer_count - 1].out_len);
+
+    emit_lines(g, primitives, sizeof(primitives) / sizeof(primitives[0]));
+    if (has_softmax) {
+        fprintf(o, "#define CQG_LOG2E  %d\n", SOFTMAX_LOG2E);
+        fprintf(o, "#define CQG_C1     %d\n", SOFTMAX_C1);
+        fprintf(o, "#define CQG_C2     %d\n\n", SOFTMAX_C2);
+        emit_lines(g, softmax_exp, sizeof(softmax_exp) / sizeof(softmax_exp[0]));
+    }
+}
+
+static void emit_run(gen_t *g)
+{
+    const cq_engine_t *e = g->engine;
+    FILE *o = g->out;
+    uint32_t span = 0;
+    uint32_t kernels = 0;
+
+    /* Activations passed between kernels (fused ReLU outputs stay in registers) */
+    for (uint32_t i = 0; i < e->layer_count; i++) {
+        if (i > 0) {
+            span = (e->state[i].in_len > span) ? e->state[i].in_len : span;
+        }
+        kernels++;
+        if (fuses_with_next(e, i)) {
+            i++;
+        }
+    }
+
+    if (kernels > 1) {
+        fprintf(o, "static int32_t %s_act[2][%uu];\n\n", g->name, (unsigned)span);
+    }
+    fprintf(o, "void %s_run(const int32_t *input, int32_t *output, uint32_t *faults);\n\n",
+            g->name);
+    fprintf(o, "void %s_run(const int32_t *input, int32_t *output, uint32_t *faults)\n{\n",
+            g->name);
+    fprintf(o, "    uint32_t f = 0;\n\n");
+
+    uint32_t k = 0;
+    int src = -1;                       /* -1 = input, else act buffer */
+    for (uint32_t i = 0; i < e->layer_count; i++) {
+        const bool last = (k + 1 == kernels);
+        const int dst = (src == 0) ? 1 : 0;
+        char in_name[64];
+        char out_name[64];
+
+        if (src < 0) {
+            snprintf(in_name, sizeof(in_name), "input");
+        } else {
+            snprintf(in_name, sizeof(in_name), "%s_act[%d]", g->name, src);
+        }
+        if (last) {
+            snprintf(out_name, sizeof(out_name), "output");
+        } else {
+            snprintf(out_name, sizeof(out_name), "%s_act[%d]", g->name, dst);
+        }
+        fprintf(o, "    %s_l%u(%s, %s, &f);\n", g->name, (unsigned)i, in_name, out_name);
+
+        src = dst;
+        k++;
+        if (fuses_with_next(e, i)) {
+            i++;
+        }
+    }
+    fprintf(o, "    *faults = f;\n}\n\n");
+}
+
+static void emit_harness(gen_t *g)
+{
+    FILE *o = g->out;
+    const char *m = g->macro;
+
+    fprintf(o, "#ifdef %s_HARNESS\n", m);
+    fprintf(o, "#include <stdio.h>\n\n");
+    fprintf(o, "/* stdin: raw int32 inputs [%s_INPUT_LEN] per sample until EOF.\n", m);
+    fprintf(o, "   stdout: outputs [%s_OUTPUT_LEN], then the fault word, per sample. */\n", m);
+    fprintf(o, "int main(void)\n{\n");
+    fprintf(o, "    static int32_t in[%s_INPUT_LEN];\n", m);
+    fprintf(o, "    static int32_t out[%s_OUTPUT_LEN];\n", m);
+    fprintf(o, "    uint32_t faults;\n\n");
+    fprintf(o, "    while (fread(in, sizeof(in[0]), %s_INPUT_LEN, stdin) == %s_INPUT_LEN) {\n",
+            m, m);
+    fprintf(o, "        %s_run(in, out, &faults);\n", g->name);
+    fprintf(o, "        if (fwrite(out, sizeof(out[0]), %s_OUTPUT_LEN, stdout) != %s_OUTPUT_LEN ||\n",
+            m, m);
+    fprintf(o, "            fwrite(&faults, sizeof(faults), 1, stdout) != 1) {\n");
+    fprintf(o, "            return 1;\n");
+    fprintf(o, "        }\n");
+    fprintf(o, "    }\n");
+    fprintf(o, "    return 0;\n}\n");
+    fprintf(o, "#endif /* %s_HARNESS */\n", m);
+}
+
+int cq_codegen_emit(const cq_engine_t *engine,
+                    const cq_codegen_opts_t *opts,
+                    FILE *out)
+{
+    if (engine == NULL || out == NULL || engine->headers == NULL ||
+        engine->shapes == NULL || engine->state == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (engine->layer_count == 0) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+
+    gen_t g;
+    const char *prefix = (opts != NULL && opts->prefix != NULL) ?
+                         opts->prefix : CQ_CODEGEN_DEFAULT_PREFIX;
+
+    memset(&g, 0, sizeof(g));
+    g.out = out;
+    g.engine = engine;
+    g.unroll = (opts != NULL && opts->unroll != 0) ? opts->unroll : CQ_CODEGEN_DEFAULT_UNROLL;
+
+    if (!valid_prefix(prefix) || g.unroll > CQ_CODEGEN_MAX_UNROLL) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+    for (size_t k = 0; prefix[k] != '\0'; k++) {
+        const char c = prefix[k];
+        g.name[k] = c;
+        g.macro[k] = (c >= 'a' && c <= 'z') ? (char)(c - 'a' + 'A') : c;
+    }
+
+    bool has_softmax = false;
+    for (uint32_t i = 0; i < engine->layer_count; i++) {
+        const cq_layer_header_t *h = &engine->headers[i];
+        if (is_weighted(h->layer_type) &&
+            (uint64_t)h->weight_rows * h->weight_cols > UINT32_MAX) {
+            return CQ_ERROR_DIMENSION_MISMATCH;
+        }
+        if (may_widen(engine, i)) {
+            return CQ_ERROR_DIMENSION_MISMATCH;
+        }
+        has_softmax = has_softmax || (h->layer_type == CQ_LAYER_SOFTMAX);
+    }
+
+    emit_preamble(&g, has_softmax);
+
+    for (uint32_t i = 0; i < engine->layer_count; i++) {
+        if (is_weighted(engine->headers[i].layer_type)) {
+            emit_params(&g, i);
+        }
+    }
+
+    for (uint32_t i = 0; i < engine->layer_count; i++) {
+        switch (engine->headers[i].layer_type) {
+        case CQ_LAYER_LINEAR:
+            emit_linear(&g, i);
+            break;
+        case CQ_LAYER_CONV2D:
+            emit_conv2d(&g, i);
+            break;
+        case CQ_LAYER_RELU:
+            emit_relu(&g, i);
+            break;
+        case CQ_LAYER_SOFTMAX:
+            emit_softmax(&g, i);
+            break;
+        default:
+            emit_pool(&g, i);
+            break;
+        }
+        if (fuses_with_next(engine, i)) {
+            i++;
+        }
+    }
+
+    emit_run(&g);
+    emit_harness(&g);
+
+    return (fflush(out) != 0 || ferror(out)) ? CQ_ERROR_IO : 0;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file compact.c
+ * @project Certifiable-Quant
+ * @brief Int16 storage of quantized weights
+ *
+ * @traceability SRS-003-CONVERT, CQ-STRUCT-001 §5.2
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include "convert.h"
+
+/* ============================================================================
+ * Range Check
+ * ============================================================================ */
+
+static bool fits_int16(cq_fixed16_t v)
+{
+    return v >= INT16_MIN && v <= INT16_MAX;
+}
+
+bool cq_weights_fit_int16(const cq_fixed16_t *w_q, size_t count)
+{
+    if (w_q == NULL) {
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (!fits_int16(w_q[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* ============================================================================
+ * Narrowing
+ * ============================================================================ */
+
+int cq_narrow_weights(const cq_fixed16_t *w_q, size_t count, int16_t *w16)
+{
+    if (w_q == NULL || w16 == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (!fits_int16(w_q[i])) {
+            return CQ_ERROR_DIMENSION_MISMATCH;
+        }
+        w16[i] = (int16_t)w_q[i];
+    }
+    return 0;
+}
+
+int cq_convert_weights_compact(const float *w_fp,
+                               cq_fixed16_t *w_q,
+                               int16_t *w16,
+                               size_t count,
+                               cq_tensor_spec_t *spec,
+                               cq_fault_flags_t *faults)
+{
+    if (!w_fp || !w_q || !w16 || !spec || !faults) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    int ret = cq_convert_weights(w_fp, w_q, count, spec, faults);
+    if (ret != 0) {
+        return ret;
+    }
+
+    /* Selected after RNE and saturation, on the values actually stored */
+    if (cq_narrow_weights(w_q, count, w16) == 0) {
+        spec->storage = CQ_STORAGE_INT16;
+    } else {
+        spec->storage = CQ_STORAGE_INT32;
+    }
+    return 0;
+}
@@ -0,0 +1,164 @@
+/**
+ * @file input_quant.c
+ * @project Certifiable-Quant
+ * @brief Serving-time FP32 input quantization
+ *
+ * The weight path (cq_quantize_weight_rne) rounds with libm round() and a
+ * tie fix-up, which is fine offline but not on every request. Here the
+ * product x·2^e is exact in FP64 (a 24-bit significand times a power of
+ * two within ±128 never rounds), so any exact RNE of it matches the
+ * reference bit for bit: _mm_round_pd with an explicit rounding mode
+ * when built with SSE4.1, truncate-and-compare otherwise. Elements that
+ * would saturate or are not finite take the reference path.
+ *
+ * @traceability CQ-MATH-001 §3.6.1, §5.2
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include "convert.h"
+#include <math.h>
+
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+
+/* RNE results outside [INT32_MIN, INT32_MAX] start beyond these */
+#define Q16_ROUND_HI    2147483647.5
+#define Q16_ROUND_LO    (-2147483648.5)
+
+/* ============================================================================
+ * Scalar Kernel
+ * ============================================================================ */
+
+/* Saturating or non-finite element: the reference, plus the finite check */
+static cq_fixed16_t quantize_slow(float v, double scale, cq_fault_flags_t *faults)
+{
+    if (!isfinite(v)) {
+        faults->range_exceed = 1;
+        if (isnan(v)) {
+            return 0;
+        }
+    }
+    return cq_quantize_weight_rne(v, scale, faults);
+}
+
+static cq_fixed16_t quantize_one(float v, double scale, cq_fault_flags_t *faults)
+{
+    const double s = (double)v * scale;
+
+    /* False for NaN and ±Inf as well */
+    if (!(s > Q16_ROUND_LO && s < Q16_ROUND_HI)) {
+        return quantize_slow(v, scale, faults);
+    }
+
+    /* |s| < 2^31 + 1: truncation and the fraction are exact. Flags
+       rather than branches: the fraction of real inputs is random. */
+    const int64_t t = (int64_t)s;
+    const double frac = s - (double)t;
+    const int odd = (int)(t & 1);
+    const int up = (frac > 0.5) | ((frac == 0.5) & odd);
+    const int down = (frac < -0.5) | ((frac == -0.5) & odd);
+
+    return (cq_fixed16_t)(t + up - down);
+}
+
+/* ============================================================================
+ * SSE4.1 Kernel
+ * ============================================================================ */
+
+#if defined(__SSE4_1__)
+/* Whole groups of 4 that need no saturation; returns elements done */
+static size_t quantize_sse41(const float *x, cq_fixed16_t *x_q, size_t count,
+                             double scale, float *lo, float *hi)
+{
+    const __m128d s = _mm_set1_pd(scale);
+    const __m128d top = _mm_set1_pd(2147483647.0);
+    const __m128d bottom = _mm_set1_pd(-2147483648.0);
+    __m128 vmin = _mm_set1_ps(*lo);
+    __m128 vmax = _mm_set1_ps(*hi);
+    size_t i = 0;
+
+    for (; i + 4u <= count; i += 4u) {
+        const __m128 v = _mm_loadu_ps(x + i);
+        __m128d a = _mm_mul_pd(_mm_cvtps_pd(v), s);
+        __m128d b = _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(v, v)), s);
+
+        a = _mm_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        b = _mm_round_pd(b, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+        /* False for NaN and for anything that saturates */
+        const int ok = _mm_movemask_pd(_mm_and_pd(_mm_cmple_pd(a, top), _mm_cmpge_pd(a, bottom)))
+                     & _mm_movemask_pd(_mm_and_pd(_mm_cmple_pd(b, top), _mm_cmpge_pd(b, bottom)));
+        if (ok != 3) {
+            break;
+        }
+
+        /* Integral and in range: the conversion is exact in any mode */
+        _mm_storeu_si128((__m128i *)(x_q + i),
+                         _mm_unpacklo_epi64(_mm_cvtpd_epi32(a), _mm_cvtpd_epi32(b)));
+        vmin = _mm_min_ps(v, vmin);
+        vmax = _mm_max_ps(v, vmax);
+    }
+
+    float m[4];
+    _mm_storeu_ps(m, vmin);
+    for (int k = 0; k < 4; k++) {
+        *lo = (m[k] < *lo) ? m[k] : *lo;
+    }
+    _mm_storeu_ps(m, vmax);
+    for (int k = 0; k < 4; k++) {
+        *hi = (m[k] > *hi) ? m[k] : *hi;
+    }
+    return i;
+}
+#endif
+
+/* ============================================================================
+ * Input Ingress
+ * ============================================================================ */
+
+int cq_quantize_input(const float *x,
+                      cq_fixed16_t *x_q,
+                      size_t count,
+                      const cq_tensor_spec_t *spec,
+                      const cq_tensor_stats_t *safe,
+                      cq_fault_flags_t *faults)
+{
+    if (!x || !x_q || !spec || !faults) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    int ret = cq_verify_symmetric(spec, faults);
+    if (ret != 0) return CQ_FAULT_ASYMMETRIC_PARAMS;
+
+    const double scale = ldexp(1.0, spec->scale_exp);
+    float lo = INFINITY;
+    float hi = -INFINITY;
+    size_t i = 0;
+
+    while (i < count) {
+#if defined(__SSE4_1__)
+        i += quantize_sse41(x + i, x_q + i, count - i, scale, &lo, &hi);
+        if (i == count) {
+            break;
+        }
+#endif
+        /* Tail, or a group the vector kernel handed back */
+        const size_t end = (count - i < 4u) ? count : i + 4u;
+        for (; i < end; i++) {
+            x_q[i] = quantize_one(x[i], scale, faults);
+            lo = (x[i] < lo) ? x[i] : lo;
+            hi = (x[i] > hi) ? x[i] : hi;
+        }
+    }
+
+    /* Range veto on the live input (NaN never updates lo/hi) */
+    if (safe != NULL && count > 0 && (lo < safe->min_safe || hi > safe->max_safe)) {
+        faults->range_exceed = 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,197 @@
+/**
+ * @file pack.c
+ * @project Certifiable-Quant
+ * @brief Weight prepacking into kernel layouts and the model digest
+ *
+ * @traceability SRS-003-CONVERT, CQ-STRUCT-001 §5.3
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include "convert.h"
+#include "sha256.h"
+#include <math.h>
+#include <string.h>
+
+/* ============================================================================
+ * Layouts
+ * ============================================================================ */
+
+uint64_t cq_weight_layout_count(uint32_t layout, uint32_t rows, uint32_t cols)
+{
+    switch (layout) {
+    case CQ_WEIGHT_LAYOUT_ROW_MAJOR:
+        return (uint64_t)rows * cols;
+    case CQ_WEIGHT_LAYOUT_PANEL:
+        return ((uint64_t)rows + CQ_PANEL_ROWS - 1) / CQ_PANEL_ROWS * CQ_PANEL_ROWS * cols;
+    default:
+        return 0;
+    }
+}
+
+/* Position of element (r, c) in a panel-packed matrix */
+static size_t panel_index(uint32_t r, uint32_t c, uint32_t cols)
+{
+    return ((size_t)(r / CQ_PANEL_ROWS) * cols + c) * CQ_PANEL_ROWS + r % CQ_PANEL_ROWS;
+}
+
+int cq_pack_weights(const cq_fixed16_t *w_q,
+                    uint32_t rows,
+                    uint32_t cols,
+                    uint32_t layout,
+                    cq_fixed16_t *packed)
+{
+    if (!w_q || !packed) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    const uint64_t count = cq_weight_layout_count(layout, rows, cols);
+    if (count == 0 && (uint64_t)rows * cols != 0) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+
+    if (layout == CQ_WEIGHT_LAYOUT_ROW_MAJOR) {
+        memcpy(packed, w_q, (size_t)count * sizeof(cq_fixed16_t));
+        return 0;
+    }
+
+    /* Zero first so the tail of the last panel is padding */
+    memset(packed, 0, (size_t)count * sizeof(cq_fixed16_t));
+    for (uint32_t r = 0; r < rows; r++) {
+        const cq_fixed16_t *w = w_q + (size_t)r * cols;
+        for (uint32_t c = 0; c < cols; c++) {
+            packed[panel_index(r, c, cols)] = w[c];
+        }
+    }
+    return 0;
+}
+
+int cq_convert_weights_packed(const float *w_fp,
+                              cq_fixed16_t *w_packed,
+                              uint32_t rows,
+                              uint32_t cols,
+                              uint32_t layout,
+                              const cq_tensor_spec_t *spec,
+                              cq_fault_flags_t *faults)
+{
+    if (!w_fp || !w_packed || !spec || !faults) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    const uint64_t count = cq_weight_layout_count(layout, rows, cols);
+    if (count == 0 && (uint64_t)rows * cols != 0) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+    if (layout == CQ_WEIGHT_LAYOUT_ROW_MAJOR) {
+        return cq_convert_weights(w_fp, w_packed, (size_t)count, spec, faults);
+    }
+
+    int ret = cq_verify_symmetric(spec, faults);
+    if (ret != 0) return CQ_FAULT_ASYMMETRIC_PARAMS;
+
+    double scale = ldexp(1.0, spec->scale_exp);
+
+    memset(w_packed, 0, (size_t)count * sizeof(cq_fixed16_t));
+    for (uint32_t r = 0; r < rows; r++) {
+        const float *w = w_fp + (size_t)r * cols;
+        for (uint32_t c = 0; c < cols; c++) {
+            w_packed[panel_index(r, c, cols)] = cq_quantize_weight_rne(w[c], scale, faults);
+        }
+    }
+    return 0;
+}
+
+/* ============================================================================
+ * Model Digest
+ * ============================================================================ */
+
+/* Domain separation for the model digest encoding */
+static const char MODEL_HASH_TAG[] = "CQ-MODEL-v2";
+
+static void put_u32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static void put_u64(uint8_t *p, uint64_t v)
+{
+    put_u32(p, (uint32_t)v);
+    put_u32(p + 4, (uint32_t)(v >> 32));
+}
+
+static void put_spec(uint8_t *p, const cq_tensor_spec_t *s)
+{
+    p[0] = (uint8_t)s->scale_exp;
+    p[1] = s->format;
+    p[2] = s->is_symmetric ? 1u : 0u;
+    p[3] = s->storage;
+}
+
+/* Encoded header size: 2 ids, 4 specs, 4 dimensions, 2 offsets, 1 flag */
+#define HEADER_BYTES    (2 * 4 + 4 * 4 + 4 * 4 + 2 * 8 + 1)
+
+/* Encoded shape size: input dims, kernel, stride, padding */
+#define SHAPE_BYTES     (7 * 4)
+
+int cq_model_hash(const cq_layer_header_t *headers,
+                  const cq_layer_shape_t *shapes,
+                  uint32_t layer_count,
+                  const uint8_t *blob,
+                  size_t blob_size,
+                  uint8_t digest[32])
+{
+    if (!headers || !shapes || !digest || (!blob && blob_size != 0)) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    cq_sha256_ctx_t ctx;
+    uint8_t buf[HEADER_BYTES + SHAPE_BYTES];
+
+    cq_sha256_init(&ctx);
+    cq_sha256_update(&ctx, MODEL_HASH_TAG, sizeof(MODEL_HASH_TAG) - 1);
+    put_u32(buf, layer_count);
+    cq_sha256_update(&ctx, buf, 4);
+
+    for (uint32_t i = 0; i < layer_count; i++) {
+        const cq_layer_header_t *h = &headers[i];
+        const cq_layer_shape_t *sh = &shapes[i];
+
+        put_u32(buf, h->layer_index);
+        put_u32(buf + 4, h->layer_type);
+        put_spec(buf + 8, &h->weight_spec);
+        put_spec(buf + 12, &h->input_spec);
+        put_spec(buf + 16, &h->bias_spec);
+        put_spec(buf + 20, &h->output_spec);
+        put_u32(buf + 24, h->weight_rows);
+        put_u32(buf + 28, h->weight_cols);
+        put_u32(buf + 32, h->bias_len);
+        put_u32(buf + 36, h->weight_layout);
+        put_u64(buf + 40, h->weight_offset);
+        put_u64(buf + 48, h->bias_offset);
+        buf[56] = h->dyadic_valid ? 1u : 0u;
+
+        /* Conv/pool geometry is outside the header but changes the output */
+        uint8_t *g = buf + HEADER_BYTES;
+        put_u32(g, sh->in_channels);
+        put_u32(g + 4, sh->in_height);
+        put_u32(g + 8, sh->in_width);
+        put_u32(g + 12, sh->kernel_h);
+        put_u32(g + 16, sh->kernel_w);
+        put_u32(g + 20, sh->stride);
+        put_u32(g + 24, sh->padding);
+        cq_sha256_update(&ctx, buf, sizeof(buf));
+    }
+
+    put_u64(buf, (uint64_t)blob_size);
+    cq_sha256_update(&ctx, buf, 8);
+    if (blob_size != 0) {
+        cq_sha256_update(&ctx, blob, blob_size);
+    }
+    cq_sha256_final(&ctx, digest);
+    return 0;
+}
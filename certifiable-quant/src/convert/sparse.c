@@ -0,0 +1,122 @@
+/**
+ * @file sparse.c
+ * @project Certifiable-Quant
+ * @brief Sparse (CSR) storage of quantized weights
+ *
+ * @traceability SRS-003-CONVERT, CQ-MATH-001 §3.4
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include "convert.h"
+
+/* ============================================================================
+ * Sparsity
+ * ============================================================================ */
+
+double cq_weight_sparsity(const cq_fixed16_t *w_q, size_t count)
+{
+    if (w_q == NULL || count == 0) {
+        return 0.0;
+    }
+
+    size_t zeros = 0;
+    for (size_t i = 0; i < count; i++) {
+        zeros += (w_q[i] == 0) ? 1u : 0u;
+    }
+    return (double)zeros / (double)count;
+}
+
+/* ============================================================================
+ * CSR Construction
+ * ============================================================================ */
+
+int cq_csr_from_dense(const cq_fixed16_t *w_q,
+                      uint32_t rows,
+                      uint32_t cols,
+                      cq_csr_q16_t *csr)
+{
+    if (w_q == NULL || csr == NULL || csr->row_ptr == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (csr->capacity > 0 && (csr->col_idx == NULL || csr->values == NULL)) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    /* Count first so that nothing is written past capacity */
+    uint64_t nnz = 0;
+    uint32_t max_row = 0;
+    for (uint32_t r = 0; r < rows; r++) {
+        const cq_fixed16_t *w = w_q + (size_t)r * cols;
+        uint32_t row_nnz = 0;
+
+        for (uint32_t c = 0; c < cols; c++) {
+            row_nnz += (w[c] != 0) ? 1u : 0u;
+        }
+        max_row = (row_nnz > max_row) ? row_nnz : max_row;
+        nnz += row_nnz;
+    }
+
+    csr->rows = rows;
+    csr->cols = cols;
+    csr->max_row_nnz = max_row;
+
+    if (nnz > csr->capacity) {
+        csr->nnz = (nnz > UINT32_MAX) ? UINT32_MAX : (uint32_t)nnz;
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+
+    uint32_t k = 0;
+    csr->row_ptr[0] = 0;
+    for (uint32_t r = 0; r < rows; r++) {
+        const cq_fixed16_t *w = w_q + (size_t)r * cols;
+
+        for (uint32_t c = 0; c < cols; c++) {
+            if (w[c] != 0) {
+                csr->col_idx[k] = c;
+                csr->values[k] = w[c];
+                k++;
+            }
+        }
+        csr->row_ptr[r + 1] = k;
+    }
+    csr->nnz = k;
+
+    return 0;
+}
+
+/* ============================================================================
+ * Conversion
+ * ============================================================================ */
+
+int cq_convert_weights_sparse(const float *w_fp,
+                              cq_fixed16_t *w_q,
+                              uint32_t rows,
+                              uint32_t cols,
+                              const cq_tensor_spec_t *spec,
+                              double min_sparsity,
+                              cq_csr_q16_t *csr,
+                              bool *is_sparse,
+                              cq_fault_flags_t *faults)
+{
+    if (!csr || !is_sparse) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    *is_sparse = false;
+
+    const size_t count = (size_t)rows * cols;
+    int ret = cq_convert_weights(w_fp, w_q, count, spec, faults);
+    if (ret != 0) return ret;
+
+    if (cq_weight_sparsity(w_q, count) <= min_sparsity) {
+        return 0;
+    }
+
+    ret = cq_csr_from_dense(w_q, rows, cols, csr);
+    if (ret != 0) return ret;
+
+    *is_sparse = true;
+    return 0;
+}
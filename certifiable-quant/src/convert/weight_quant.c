@@ -12,6 +12,7 @@
 
 #include "convert.h"
 #include <math.h>
+#include <string.h>
 
 /* ============================================================================
  * FR-CNV-01: Quantization Kernel (RNE)
@@ -121,3 +122,48 @@ int cq_convert_weights(const float *w_fp,
 
     return 0;
 }
+
+typedef struct {
+    const float *w_fp;
+    cq_fixed16_t *w_q;
+    double scale;
+    cq_fault_flags_t faults[CQ_POOL_MAX_THREADS];
+} convert_job_t;
+
+static void convert_chunk(void *ctx, size_t begin, size_t end, uint32_t worker)
+{
+    convert_job_t *job = (convert_job_t *)ctx;
+
+    for (size_t i = begin; i < end; i++) {
+        job->w_q[i] = cq_quantize_weight_rne(job->w_fp[i], job->scale, &job->faults[worker]);
+    }
+}
+
+int cq_convert_weights_parallel(cq_pool_t *pool,
+                                const float *w_fp,
+                                cq_fixed16_t *w_q,
+                                size_t count,
+                                const cq_tensor_spec_t *spec,
+                                cq_fault_flags_t *faults)
+{
+    if (!w_fp || !w_q || !spec || !faults) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    int ret = cq_verify_symmetric(spec, faults);
+    if (ret != 0) return CQ_FAULT_ASYMMETRIC_PARAMS;
+
+    convert_job_t job;
+    memset(&job, 0, sizeof(job));
+    job.w_fp = w_fp;
+    job.w_q = w_q;
+    job.scale = ldexp(1.0, spec->scale_exp);
+
+    cq_pool_run(pool, count, CQ_CONVERT_GRAIN, convert_chunk, &job);
+
+    for (uint32_t w = 0; w < cq_pool_threads(pool); w++) {
+        cq_fault_merge(faults, &job.faults[w]);
+    }
+
+    return 0;
+}
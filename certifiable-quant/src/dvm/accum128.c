@@ -0,0 +1,152 @@
+/**
+ * @file accum128.c
+ * @project Certifiable-Quant
+ * @brief Exact 128-bit accumulation and requantization
+ *
+ * Two-word two's complement arithmetic in plain C99, so every compiler
+ * produces the same bits; add-with-carry chains compile to add/adc.
+ *
+ * @traceability CQ-MATH-001 §3.4-§3.5
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include "dvm.h"
+
+#define SIGN64      ((uint64_t)1 << 63)
+
+/* ============================================================================
+ * Overflow Safety
+ * ============================================================================ */
+
+bool cq_overflow_is_safe128(const cq_overflow_proof_t *proof)
+{
+    /* n·|w| < 2^64; multiply by |x| < 2^32 in 32-bit halves */
+    const uint64_t nw = (uint64_t)proof->dot_product_len * (uint64_t)proof->max_weight_mag;
+    const uint64_t x = proof->max_input_mag;
+    const uint64_t low = (nw & 0xFFFFFFFFu) * x;
+    const uint64_t mid = (nw >> 32) * x;
+    uint64_t lo = low + (mid << 32);
+    uint64_t hi = (mid >> 32) + (lo < low ? 1u : 0u);
+
+    /* Worst-case int64 bias */
+    lo += SIGN64;
+    hi += (lo < SIGN64) ? 1u : 0u;
+    return hi < SIGN64;
+}
+
+uint32_t cq_acc128_chunk_len(const cq_overflow_proof_t *proof)
+{
+    const uint64_t p = (uint64_t)proof->max_weight_mag * (uint64_t)proof->max_input_mag;
+    uint64_t len = (p == 0) ? UINT64_MAX : (SIGN64 - 1u) / p;
+
+    if (len > proof->dot_product_len) {
+        len = proof->dot_product_len;
+    }
+    return (len > 0) ? (uint32_t)len : 1u;
+}
+
+/* ============================================================================
+ * Accumulation
+ * ============================================================================ */
+
+void cq_acc128_set(cq_accum128_t *acc, int64_t v)
+{
+    acc->lo = (uint64_t)v;
+    acc->hi = (v < 0) ? UINT64_MAX : 0u;
+}
+
+void cq_acc128_add64(cq_accum128_t *acc, int64_t v)
+{
+    const uint64_t lo = acc->lo + (uint64_t)v;
+
+    acc->hi += ((v < 0) ? UINT64_MAX : 0u) + ((lo < acc->lo) ? 1u : 0u);
+    acc->lo = lo;
+}
+
+void cq_mac128_q16(cq_accum128_t *acc, cq_fixed16_t a, cq_fixed16_t b)
+{
+    /* |a·b| ≤ 2^62: the product itself is exact in int64 */
+    cq_acc128_add64(acc, (int64_t)a * (int64_t)b);
+}
+
+/* ============================================================================
+ * Requantization
+ * ============================================================================ */
+
+/* Bit k (0..127) of hi:lo */
+static uint64_t bit128(uint64_t hi, uint64_t lo, uint32_t k)
+{
+    return (k < 64u) ? (lo >> k) & 1u : (hi >> (k - 64u)) & 1u;
+}
+
+/* Any of bits [0, k) of hi:lo set (k ≤ 128) */
+static bool any_below(uint64_t hi, uint64_t lo, uint32_t k)
+{
+    if (k == 0u) {
+        return false;
+    }
+    if (k < 64u) {
+        return (lo & (((uint64_t)1 << k) - 1u)) != 0u;
+    }
+    if (k == 64u) {
+        return lo != 0u;
+    }
+    if (k < 128u) {
+        return lo != 0u || (hi & (((uint64_t)1 << (k - 64u)) - 1u)) != 0u;
+    }
+    return lo != 0u || hi != 0u;
+}
+
+int32_t cq_requantize128(const cq_accum128_t *acc, int32_t shift, cq_fault_flags_t *faults)
+{
+    const bool negative = (acc->hi & SIGN64) != 0u;
+
+    /* int64 range: hi is the sign extension of lo */
+    if (acc->hi == (((acc->lo & SIGN64) != 0u) ? UINT64_MAX : 0u)) {
+        const int64_t v = (acc->lo <= (uint64_t)INT64_MAX) ?
+                          (int64_t)acc->lo : -(int64_t)(~acc->lo) - 1;
+        return cq_requantize(v, shift, faults);
+    }
+
+    /* |v| ≥ 2^63: only a right shift can bring it into range */
+    if (shift <= 0) {
+        return cq_clamp32(negative ? INT64_MIN : INT64_MAX, faults);
+    }
+
+    /* Magnitude m = |v| ≤ 2^127 */
+    uint64_t m_lo = acc->lo;
+    uint64_t m_hi = acc->hi;
+    if (negative) {
+        m_lo = ~m_lo + 1u;
+        m_hi = ~m_hi + ((m_lo == 0u) ? 1u : 0u);
+    }
+
+    const uint32_t s = (uint32_t)shift;
+    uint64_t q_lo;
+    uint64_t q_hi;
+    if (s >= 128u) {
+        q_lo = 0u;
+        q_hi = 0u;
+    } else if (s >= 64u) {
+        q_lo = (s == 64u) ? m_hi : m_hi >> (s - 64u);
+        q_hi = 0u;
+    } else {
+        q_lo = (m_lo >> s) | (m_hi << (64u - s));
+        q_hi = m_hi >> s;
+    }
+
+    /* RNE on the magnitude: symmetric, so it matches rounding v itself */
+    const bool round_bit = (s <= 128u) && bit128(m_hi, m_lo, s - 1u) != 0u;
+    const bool sticky = any_below(m_hi, m_lo, s - 1u);
+    if (q_hi != 0u || q_lo > ((uint64_t)1 << 32)) {
+        return cq_clamp32(negative ? INT64_MIN : INT64_MAX, faults);
+    }
+    if (round_bit && (sticky || (q_lo & 1u) != 0u)) {
+        q_lo += 1u;
+    }
+
+    return cq_clamp32(negative ? -(int64_t)q_lo : (int64_t)q_lo, faults);
+}
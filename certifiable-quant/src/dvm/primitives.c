@@ -113,11 +113,11 @@ cq_fixed16_t cq_div_q16(cq_fixed16_t a, cq_fixed16_t b, cq_fault_flags_t *faults
         return 0;
     }
 
-    int64_t wide_a = (int64_t)a << CQ_Q16_SHIFT;
+    int64_t wide_a = (int64_t)a * ((int64_t)1 << CQ_Q16_SHIFT);
     int64_t quot = wide_a / b;
     int64_t rem = wide_a % b;
 
-    int64_t half_b = (b > 0) ? (b / 2) : ((-b) / 2);
+    int64_t half_b = (b > 0) ? (b / 2) : (-(int64_t)b / 2);
     int64_t abs_rem = (rem >= 0) ? rem : -rem;
 
     if (abs_rem > half_b) {
@@ -147,6 +147,30 @@ cq_fixed16_t cq_acc_to_q16(cq_accum64_t acc, cq_fault_flags_t *faults)
     return cq_round_shift_rne(acc, CQ_Q16_SHIFT, faults);
 }
 
+/* ============================================================================
+ * Requantization
+ * ============================================================================ */
+
+int32_t cq_requantize(int64_t acc, int32_t shift, cq_fault_flags_t *faults)
+{
+    if (shift > 0) {
+        return cq_round_shift_rne(acc, (uint32_t)shift, faults);
+    }
+    if (shift == 0) {
+        return cq_clamp32(acc, faults);
+    }
+
+    /* Scale up: exact unless the result leaves the int32 range */
+    int32_t up = -shift;
+    if (up >= 32) {
+        return (acc == 0) ? 0 : cq_clamp32((acc > 0) ? INT64_MAX : INT64_MIN, faults);
+    }
+    if (acc > ((int64_t)INT32_MAX >> up) || acc < -((int64_t)1 << (31 - up))) {
+        return cq_clamp32((acc > 0) ? INT64_MAX : INT64_MIN, faults);
+    }
+    return (int32_t)(acc * ((int64_t)1 << up));
+}
+
 /* ============================================================================
  * Overflow Safety
  * ============================================================================ */
@@ -157,10 +181,14 @@ bool cq_overflow_is_safe(const cq_overflow_proof_t *proof)
         return true;
     }
 
-    uint64_t product = (uint64_t)proof->dot_product_len *
-                       (uint64_t)proof->max_weight_mag *
-                       (uint64_t)proof->max_input_mag;
-    return product < ((uint64_t)1 << 63);
+    if (proof->max_weight_mag == 0 || proof->max_input_mag == 0) {
+        return true;
+    }
+
+    /* n·|w| < 2^64 always; divide instead of multiplying by |x| again */
+    uint64_t partial = (uint64_t)proof->dot_product_len *
+                       (uint64_t)proof->max_weight_mag;
+    return partial <= (((uint64_t)1 << 63) - 1) / proof->max_input_mag;
 }
 
 /* ============================================================================
@@ -0,0 +1,221 @@
+/**
+ * @file thread_pool.c
+ * @project Certifiable-Quant
+ * @brief Deterministic work-partitioning thread pool
+ *
+ * @details Workers sleep on a condition variable until the job generation
+ *          changes, then claim chunks from a shared cursor. Which worker runs
+ *          which chunk varies between runs; chunk boundaries and the outputs
+ *          each chunk writes do not, which is what keeps results identical.
+ *
+ * @traceability CQ-MATH-001 §6
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#if defined(__linux__)
+#define _GNU_SOURCE             /* pthread_setaffinity_np */
+#else
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "thread_pool.h"
+#include <sched.h>
+#include <string.h>
+#include <unistd.h>
+
+/* ============================================================================
+ * Job Execution
+ * ============================================================================ */
+
+/* Claim and run chunks until none are left (lock held on entry and exit) */
+static void drain_chunks(cq_pool_t *pool, uint32_t worker)
+{
+    while (pool->next_chunk < pool->chunk_count) {
+        size_t chunk = pool->next_chunk++;
+        size_t begin = chunk * pool->grain;
+        size_t end = (pool->n - begin > pool->grain) ? begin + pool->grain : pool->n;
+        cq_pool_fn_t fn = pool->fn;
+        void *ctx = pool->ctx;
+
+        pthread_mutex_unlock(&pool->lock);
+        fn(ctx, begin, end, worker);
+        pthread_mutex_lock(&pool->lock);
+    }
+}
+
+static void pin_to_cpu(cq_pool_t *pool, pthread_t thread, uint32_t cpu)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+
+    CPU_ZERO(&set);
+    CPU_SET((int)(cpu % (uint32_t)((online > 0) ? online : 1)), &set);
+    if (pthread_setaffinity_np(thread, sizeof(set), &set) != 0) {
+        pool->pinned = false;
+    }
+#else
+    (void)thread;
+    (void)cpu;
+    pool->pinned = false;
+#endif
+}
+
+static void *worker_main(void *arg)
+{
+    const cq_pool_worker_t *wa = (const cq_pool_worker_t *)arg;
+    cq_pool_t *pool = (cq_pool_t *)wa->pool;
+    uint32_t worker = wa->index;
+    /* Generation 0 is "no job". A job only completes once every worker has
+       passed through it, so a worker can never miss one. */
+    uint64_t seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+
+    for (;;) {
+        while (!pool->stop && pool->generation == seen) {
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+        if (pool->stop) {
+            break;
+        }
+        seen = pool->generation;
+
+        drain_chunks(pool, worker);
+
+        if (--pool->active == 0) {
+            pthread_cond_signal(&pool->finished);
+        }
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+/* ============================================================================
+ * Public API
+ * ============================================================================ */
+
+int cq_pool_init(cq_pool_t *pool, const cq_pool_opts_t *opts)
+{
+    if (pool == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    uint32_t threads = (opts != NULL) ? opts->threads : 0u;
+    if (threads == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (online > 0) ? (uint32_t)online : 1u;
+    }
+    if (threads > CQ_POOL_MAX_THREADS) {
+        threads = CQ_POOL_MAX_THREADS;
+    }
+
+    memset(pool, 0, sizeof(*pool));
+    pool->thread_count = threads;
+    pool->pinned = (opts != NULL && opts->pin);
+
+    if (pthread_mutex_init(&pool->lock, NULL) != 0) {
+        return CQ_ERROR_IO;
+    }
+    if (pthread_cond_init(&pool->start, NULL) != 0) {
+        pthread_mutex_destroy(&pool->lock);
+        return CQ_ERROR_IO;
+    }
+    if (pthread_cond_init(&pool->finished, NULL) != 0) {
+        pthread_cond_destroy(&pool->start);
+        pthread_mutex_destroy(&pool->lock);
+        return CQ_ERROR_IO;
+    }
+
+    if (pool->pinned) {
+        pin_to_cpu(pool, pthread_self(), opts->first_cpu);
+    }
+
+    /* Worker w ≥ 1 runs on its own thread; worker 0 is the caller */
+    for (uint32_t w = 1; w < threads; w++) {
+        pool->worker_args[w].pool = pool;
+        pool->worker_args[w].index = w;
+
+        if (pthread_create(&pool->workers[w], NULL, worker_main, &pool->worker_args[w]) != 0) {
+            cq_pool_destroy(pool);
+            return CQ_ERROR_IO;
+        }
+        pool->started++;
+
+        if (opts != NULL && opts->pin) {
+            pin_to_cpu(pool, pool->workers[w], opts->first_cpu + w);
+        }
+    }
+
+    return 0;
+}
+
+void cq_pool_destroy(cq_pool_t *pool)
+{
+    if (pool == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = true;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (uint32_t w = 1; w <= pool->started; w++) {
+        pthread_join(pool->workers[w], NULL);
+    }
+
+    pthread_cond_destroy(&pool->finished);
+    pthread_cond_destroy(&pool->start);
+    pthread_mutex_destroy(&pool->lock);
+    pool->started = 0;
+    pool->thread_count = 0;
+}
+
+uint32_t cq_pool_threads(const cq_pool_t *pool)
+{
+    return (pool != NULL && pool->thread_count > 0) ? pool->thread_count : 1u;
+}
+
+void cq_pool_run(cq_pool_t *pool, size_t n, size_t grain, cq_pool_fn_t fn, void *ctx)
+{
+    if (fn == NULL || n == 0) {
+        return;
+    }
+    if (grain == 0) {
+        grain = 1;
+    }
+
+    size_t chunks = (n + grain - 1) / grain;
+
+    /* Single-threaded mode: same chunks, in order, on the caller */
+    if (pool == NULL || pool->started == 0 || chunks == 1) {
+        for (size_t c = 0; c < chunks; c++) {
+            size_t begin = c * grain;
+            fn(ctx, begin, (n - begin > grain) ? begin + grain : n, 0);
+        }
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->fn = fn;
+    pool->ctx = ctx;
+    pool->n = n;
+    pool->grain = grain;
+    pool->next_chunk = 0;
+    pool->chunk_count = chunks;
+    pool->active = pool->started;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+
+    drain_chunks(pool, 0);
+
+    while (pool->active > 0) {
+        pthread_cond_wait(&pool->finished, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
@@ -0,0 +1,902 @@
+/**
+ * @file engine.c
+ * @project Certifiable-Quant
+ * @brief Model validation and layer sequencing for the inference engine
+ *
+ * @traceability CQ-MATH-001 §3.4-§3.5, §6, CQ-STRUCT-001 §5.3
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include "engine.h"
+#include "convert.h"
+#include "dvm.h"
+#include <stddef.h>
+#include <string.h>
+
+/* ============================================================================
+ * Validation Helpers
+ * ============================================================================ */
+
+static bool is_weighted(uint32_t type)
+{
+    return type == CQ_LAYER_LINEAR || type == CQ_LAYER_CONV2D;
+}
+
+/* Product of three dimensions, 0 if it does not fit uint32 */
+static uint32_t volume(uint32_t a, uint32_t b, uint32_t c)
+{
+    uint64_t v = (uint64_t)a * b * c;
+    return (v > UINT32_MAX) ? 0u : (uint32_t)v;
+}
+
+static uint32_t max_abs(const cq_fixed16_t *x, uint64_t n)
+{
+    uint32_t m = 0;
+    for (uint64_t i = 0; i < n; i++) {
+        uint32_t mag = (x[i] < 0) ? (uint32_t)0 - (uint32_t)x[i] : (uint32_t)x[i];
+        m = (mag > m) ? mag : m;
+    }
+    return m;
+}
+
+/* Bytes per stored weight, 0 for an unknown storage */
+static uint64_t weight_elem_size(const cq_layer_header_t *h)
+{
+    switch (h->weight_spec.storage) {
+    case CQ_STORAGE_INT32:
+        return sizeof(cq_fixed16_t);
+    case CQ_STORAGE_INT16:
+        return sizeof(int16_t);
+    default:
+        return 0;
+    }
+}
+
+/* max |w_int| over a layer's blob weights in their storage and layout */
+static uint32_t weight_max_abs(const cq_engine_t *engine, const cq_layer_header_t *h)
+{
+    const uint8_t *w = engine->blob + h->weight_offset;
+    const uint64_t n = cq_weight_layout_count(h->weight_layout, h->weight_rows, h->weight_cols);
+
+    if (h->weight_spec.storage == CQ_STORAGE_INT16) {
+        const int16_t *w16 = (const int16_t *)w;
+        uint32_t m = 0;
+        for (uint64_t i = 0; i < n; i++) {
+            uint32_t mag = (uint32_t)((w16[i] < 0) ? -(int32_t)w16[i] : (int32_t)w16[i]);
+            m = (mag > m) ? mag : m;
+        }
+        return m;
+    }
+    return max_abs((const cq_fixed16_t *)w, n);
+}
+
+/* [offset, offset + bytes) inside the blob and aligned to align */
+static bool in_blob(const cq_engine_t *engine, uint64_t offset, uint64_t bytes, uint64_t align)
+{
+    return offset % align == 0 &&
+           offset <= engine->blob_size &&
+           bytes <= engine->blob_size - offset;
+}
+
+static int check_params(const cq_engine_t *engine,
+                        const cq_layer_header_t *h,
+                        cq_layer_state_t *st)
+{
+    /* Panel packing is a Linear (GEMV) layout of int32 weights only */
+    const uint64_t w_elem = weight_elem_size(h);
+    uint64_t w_count = ((h->layer_type == CQ_LAYER_LINEAR &&
+                         h->weight_spec.storage == CQ_STORAGE_INT32) ||
+                        h->weight_layout == CQ_WEIGHT_LAYOUT_ROW_MAJOR) ?
+                       cq_weight_layout_count(h->weight_layout, h->weight_rows, h->weight_cols) : 0;
+
+    if (w_count == 0 || w_elem == 0 ||
+        !in_blob(engine, h->weight_offset, w_count * w_elem, w_elem)) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+
+    if (h->bias_len != 0) {
+        uint64_t elem = (h->bias_spec.format == CQ_FORMAT_Q32_32) ? 8u : 4u;
+
+        if (h->bias_len != h->weight_rows ||
+            !in_blob(engine, h->bias_offset, (uint64_t)h->bias_len * elem, elem)) {
+            return CQ_ERROR_DIMENSION_MISMATCH;
+        }
+        if (cq_verify_symmetric(&h->bias_spec, NULL) != 0) {
+            return CQ_FAULT_ASYMMETRIC_PARAMS;
+        }
+        if ((int32_t)h->bias_spec.scale_exp !=
+            (int32_t)h->weight_spec.scale_exp + (int32_t)h->input_spec.scale_exp) {
+            return CQ_ERROR_DYADIC_VIOLATION;
+        }
+    }
+
+    if (cq_verify_symmetric(&h->weight_spec, NULL) != 0) {
+        return CQ_FAULT_ASYMMETRIC_PARAMS;
+    }
+
+    /* max |w| for the run-time overflow proof */
+    st->weight_max_mag = weight_max_abs(engine, h);
+
+    return 0;
+}
+
+static int validate_layer(const cq_engine_t *engine,
+                      const cq_layer_header_t *h,
+                      const cq_layer_shape_t *sh,
+                      cq_layer_state_t *st)
+{
+    uint32_t C = sh->in_channels;
+    uint32_t H = sh->in_height;
+    uint32_t W = sh->in_width;
+
+    memset(st, 0, sizeof(*st));
+    st->in_len = volume(C, H, W);
+    if (st->in_len == 0) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+
+    if (cq_verify_symmetric(&h->input_spec, NULL) != 0 ||
+        cq_verify_symmetric(&h->output_spec, NULL) != 0) {
+        return CQ_FAULT_ASYMMETRIC_PARAMS;
+    }
+
+    if (is_weighted(h->layer_type)) {
+        int ret = check_params(engine, h, st);
+        if (ret != 0) {
+            return ret;
+        }
+    }
+
+    switch (h->layer_type) {
+    case CQ_LAYER_LINEAR:
+        if (h->weight_cols != st->in_len) {
+            return CQ_ERROR_DIMENSION_MISMATCH;
+        }
+        st->out_channels = h->weight_rows;
+        st->out_height = 1;
+        st->out_width = 1;
+        st->macs = (uint64_t)h->weight_rows * h->weight_cols;
+        break;
+
+    case CQ_LAYER_CONV2D:
+        if (sh->kernel_h == 0 || sh->kernel_w == 0 || sh->stride == 0 ||
+            (uint64_t)H + 2u * (uint64_t)sh->padding < sh->kernel_h ||
+            (uint64_t)W + 2u * (uint64_t)sh->padding < sh->kernel_w ||
+            sh->padding >= sh->kernel_h || sh->padding >= sh->kernel_w ||
+            h->weight_cols != volume(C, sh->kernel_h, sh->kernel_w)) {
+            return CQ_ERROR_DIMENSION_MISMATCH;
+        }
+        st->out_channels = h->weight_rows;
+        st->out_height = (H + 2 * sh->padding - sh->kernel_h) / sh->stride + 1;
+        st->out_width = (W + 2 * sh->padding - sh->kernel_w) / sh->stride + 1;
+        st->macs = (uint64_t)h->weight_rows * st->out_height * st->out_width * h->weight_cols;
+        break;
+
+    case CQ_LAYER_RELU:
+    case CQ_LAYER_SOFTMAX:
+        st->out_channels = C;
+        st->out_height = H;
+        st->out_width = W;
+        break;
+
+    case CQ_LAYER_MAXPOOL:
+    case CQ_LAYER_AVGPOOL:
+        if (sh->kernel_h == 0 || sh->kernel_w == 0 || sh->stride == 0 ||
+            H < sh->kernel_h || W < sh->kernel_w) {
+            return CQ_ERROR_DIMENSION_MISMATCH;
+        }
+        st->out_channels = C;
+        st->out_height = (H - sh->kernel_h) / sh->stride + 1;
+        st->out_width = (W - sh->kernel_w) / sh->stride + 1;
+        break;
+
+    default:
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+
+    st->out_len = volume(st->out_channels, st->out_height, st->out_width);
+    return (st->out_len == 0) ? CQ_ERROR_DIMENSION_MISMATCH : 0;
+}
+
+/* ============================================================================
+ * Initialisation
+ * ============================================================================ */
+
+int cq_engine_init(cq_engine_t *engine,
+                   const cq_layer_header_t *headers,
+                   const cq_layer_shape_t *shapes,
+                   cq_layer_state_t *state,
+                   uint32_t layer_count,
+                   const uint8_t *blob,
+                   size_t blob_size)
+{
+    if (engine == NULL || headers == NULL || shapes == NULL || state == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (blob == NULL && blob_size != 0) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (layer_count == 0 || ((uintptr_t)blob % sizeof(int64_t)) != 0) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+
+    memset(engine, 0, sizeof(*engine));
+    engine->headers = headers;
+    engine->shapes = shapes;
+    engine->state = state;
+    engine->layer_count = layer_count;
+    engine->blob = blob;
+    engine->blob_size = blob_size;
+    engine->batch_size = CQ_ENGINE_DEFAULT_BATCH;
+    engine->fast_path_enabled = true;
+    engine->fusion_enabled = true;
+    engine->split_k_enabled = true;
+
+    uint32_t max_act = 0;
+
+    for (uint32_t i = 0; i < layer_count; i++) {
+        int ret = validate_layer(engine, &headers[i], &shapes[i], &state[i]);
+        if (ret != 0) {
+            return ret;
+        }
+
+        /* Chaining: previous output is this layer's input */
+        if (i > 0) {
+            if (state[i].in_len != state[i - 1].out_len) {
+                return CQ_ERROR_DIMENSION_MISMATCH;
+            }
+            if (headers[i].input_spec.scale_exp != headers[i - 1].output_spec.scale_exp) {
+                return CQ_ERROR_DYADIC_VIOLATION;
+            }
+        }
+
+        /* The network input and output are caller buffers */
+        if (i > 0 && state[i].in_len > max_act) {
+            max_act = state[i].in_len;
+        }
+    }
+
+    engine->max_activation = max_act;
+    return 0;
+}
+
+/* Row pointers bound the arrays, columns ascend, max_row_nnz is exact */
+static bool csr_well_formed(const cq_csr_q16_t *csr)
+{
+    if (csr->row_ptr == NULL || csr->row_ptr[0] != 0 ||
+        csr->row_ptr[csr->rows] != csr->nnz || csr->nnz > csr->capacity ||
+        (csr->nnz > 0 && (csr->col_idx == NULL || csr->values == NULL))) {
+        return false;
+    }
+
+    uint32_t max_row = 0;
+    for (uint32_t r = 0; r < csr->rows; r++) {
+        const uint32_t k0 = csr->row_ptr[r];
+        const uint32_t k1 = csr->row_ptr[r + 1];
+
+        if (k1 < k0 || k1 > csr->nnz) {
+            return false;
+        }
+        for (uint32_t k = k0; k < k1; k++) {
+            if (csr->col_idx[k] >= csr->cols || (k > k0 && csr->col_idx[k] <= csr->col_idx[k - 1])) {
+                return false;
+            }
+        }
+        max_row = (k1 - k0 > max_row) ? k1 - k0 : max_row;
+    }
+    return max_row == csr->max_row_nnz;
+}
+
+int cq_engine_attach_csr(cq_engine_t *engine, uint32_t layer, const cq_csr_q16_t *csr)
+{
+    if (engine == NULL || engine->state == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (layer >= engine->layer_count || engine->headers[layer].layer_type != CQ_LAYER_LINEAR) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+
+    const cq_layer_header_t *h = &engine->headers[layer];
+    cq_layer_state_t *st = &engine->state[layer];
+
+    if (csr == NULL) {
+        st->csr = NULL;
+        st->macs = (uint64_t)h->weight_rows * h->weight_cols;
+        st->weight_max_mag = weight_max_abs(engine, h);
+        return 0;
+    }
+
+    if (csr->rows != h->weight_rows || csr->cols != h->weight_cols || !csr_well_formed(csr)) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+
+    st->csr = csr;
+    st->macs = csr->nnz;
+    st->weight_max_mag = max_abs(csr->values, csr->nnz);
+    return 0;
+}
+
+size_t cq_engine_workspace_size(const cq_engine_t *engine)
+{
+    if (engine == NULL || engine->layer_count < 2) {
+        return 0;
+    }
+    if (engine->slots != NULL) {
+        return (size_t)engine->arena_len * sizeof(cq_fixed16_t);
+    }
+    /* Ping-pong between two activation buffers */
+    return 2u * (size_t)engine->max_activation * sizeof(cq_fixed16_t);
+}
+
+/* ============================================================================
+ * Execution
+ * ============================================================================ */
+
+/* A weighted layer followed by ReLU (inside [.., end)) is run as one kernel */
+static bool fuses_with_next(const cq_engine_t *engine, uint32_t i, uint32_t end)
+{
+    return engine->fusion_enabled &&
+           i + 1 < end &&
+           is_weighted(engine->headers[i].layer_type) &&
+           engine->headers[i + 1].layer_type == CQ_LAYER_RELU;
+}
+
+/* Rows per weight tile for a layer's row size */
+static uint32_t tile_rows_for(const cq_engine_t *engine, const cq_layer_header_t *h)
+{
+    if (engine->tile_rows != 0) {
+        return engine->tile_rows;
+    }
+    uint32_t rows = CQ_ENGINE_TILE_BYTES / (h->weight_cols * (uint32_t)weight_elem_size(h));
+    return (rows > 0) ? rows : 1u;
+}
+
+/* Weighted layer work shared by all pool workers */
+typedef struct {
+    const cq_layer_header_t *h;
+    const cq_layer_shape_t *sh;
+    const void *W;
+    const cq_csr_q16_t *csr;
+    const void *bias;
+    const cq_fixed16_t *x;
+    cq_fixed16_t *y;
+    uint32_t batch;
+    uint32_t tile_rows;
+    uint32_t in_len;
+    uint32_t out_len;
+    bool fast;
+    bool wide;                      /* 128-bit accumulation, chunk products per int64 part */
+    bool counting;                  /* engine->fault_counts is set */
+    uint32_t chunk;
+    const cq_epilogue_t *epi;
+    cq_fault_flags_t faults[CQ_POOL_MAX_THREADS];
+    cq_fault_counts_t counts[CQ_POOL_MAX_THREADS];  /* Last: cleared only when counting */
+} layer_job_t;
+
+/* A chunk's epilogue; when counting, a copy counting into the worker's sink */
+static const cq_epilogue_t *chunk_epilogue(layer_job_t *job, uint32_t worker, cq_epilogue_t *buf)
+{
+    if (!job->counting) {
+        return job->epi;
+    }
+    if (job->epi != NULL) {
+        *buf = *job->epi;
+    } else {
+        memset(buf, 0, sizeof(*buf));
+    }
+    buf->counts = &job->counts[worker];
+    return buf;
+}
+
+/* Items are output rows; a row is never split */
+static void linear_chunk(void *ctx, size_t begin, size_t end, uint32_t worker)
+{
+    layer_job_t *job = (layer_job_t *)ctx;
+    cq_epilogue_t epi_buf;
+    const cq_epilogue_t *epi = chunk_epilogue(job, worker, &epi_buf);
+
+    if (job->wide) {
+        for (uint32_t b = 0; b < job->batch; b++) {
+            cq_layer_linear_rows_wide(job->h, job->W, job->bias,
+                                      job->x + (size_t)b * job->in_len,
+                                      job->y + (size_t)b * job->out_len,
+                                      (uint32_t)begin, (uint32_t)end,
+                                      job->chunk, epi, &job->faults[worker]);
+        }
+    } else if (job->csr != NULL) {
+        for (uint32_t b = 0; b < job->batch; b++) {
+            cq_layer_linear_csr_rows(job->h, job->csr, job->bias,
+                                     job->x + (size_t)b * job->in_len,
+                                     job->y + (size_t)b * job->out_len,
+                                     (uint32_t)begin, (uint32_t)end,
+                                     job->fast, epi, &job->faults[worker]);
+        }
+    } else if (job->h->weight_layout == CQ_WEIGHT_LAYOUT_PANEL) {
+        /* Batched items are whole tiles, so each tile stays resident */
+        for (uint32_t b = 0; b < job->batch; b++) {
+            cq_layer_linear_panel_rows(job->h, job->W, job->bias,
+                                       job->x + (size_t)b * job->in_len,
+                                       job->y + (size_t)b * job->out_len,
+                                       (uint32_t)begin, (uint32_t)end,
+                                       job->fast, epi, &job->faults[worker]);
+        }
+    } else if (job->batch > 1) {
+        cq_layer_linear_batch_rows(job->h, job->W, job->bias, job->x, job->y,
+                                   job->batch, job->tile_rows,
+                                   (uint32_t)begin, (uint32_t)end,
+                                   job->fast, epi, &job->faults[worker]);
+    } else {
+        cq_layer_linear_rows(job->h, job->W, job->bias, job->x, job->y,
+                             (uint32_t)begin, (uint32_t)end,
+                             job->fast, epi, &job->faults[worker]);
+    }
+}
+
+/* Items are output channels, applied to every sample of the batch */
+static void conv_chunk(void *ctx, size_t begin, size_t end, uint32_t worker)
+{
+    layer_job_t *job = (layer_job_t *)ctx;
+    cq_epilogue_t epi_buf;
+    const cq_epilogue_t *epi = chunk_epilogue(job, worker, &epi_buf);
+
+    for (uint32_t b = 0; b < job->batch; b++) {
+        if (job->wide) {
+            cq_layer_conv2d_channels_wide(job->h, job->sh, job->W, job->bias,
+                                          job->x + (size_t)b * job->in_len,
+                                          job->y + (size_t)b * job->out_len,
+                                          (uint32_t)begin, (uint32_t)end,
+                                          job->chunk, epi, &job->faults[worker]);
+        } else {
+            cq_layer_conv2d_channels(job->h, job->sh, job->W, job->bias,
+                                     job->x + (size_t)b * job->in_len,
+                                     job->y + (size_t)b * job->out_len,
+                                     (uint32_t)begin, (uint32_t)end,
+                                     job->fast, epi, &job->faults[worker]);
+        }
+    }
+}
+
+/* Split-K: one item per fan-in slice of a block of outputs */
+typedef struct {
+    layer_job_t *job;
+    const cq_fixed16_t *x;
+    uint32_t out_begin;             /* Rows (Linear) or output channels (Conv2D) */
+    uint32_t out_end;
+    uint32_t slice_len;             /* Columns or input channels per slice */
+    uint32_t k_len;
+    cq_accum64_t partial[CQ_ENGINE_SPLITK_SLICES][CQ_ENGINE_ROW_GRAIN];
+} splitk_job_t;
+
+static void splitk_chunk(void *ctx, size_t begin, size_t end, uint32_t worker)
+{
+    splitk_job_t *sk = (splitk_job_t *)ctx;
+    const layer_job_t *job = sk->job;
+
+    for (size_t s = begin; s < end; s++) {
+        const uint32_t k0 = (uint32_t)s * sk->slice_len;
+        const uint32_t k1 = (sk->k_len - k0 > sk->slice_len) ? k0 + sk->slice_len : sk->k_len;
+
+        if (job->h->layer_type == CQ_LAYER_LINEAR) {
+            cq_layer_linear_partial(job->h, job->W, sk->x, sk->out_begin, sk->out_end,
+                                    k0, k1, sk->partial[s]);
+        } else {
+            cq_layer_conv2d_partial(job->h, job->sh, job->W, sk->x, sk->out_begin, sk->out_end,
+                                    k0, k1, sk->partial[s]);
+        }
+    }
+}
+
+/* Fan-in slices for split-K, or 0 to partition rows: the proof must hold
+   (exact int64 sums are associative) and rows must leave workers idle */
+static uint32_t splitk_slices(const cq_engine_t *engine,
+                              cq_pool_t *pool,
+                              const layer_job_t *job,
+                              size_t grain,
+                              uint32_t *per_row,
+                              uint32_t *slice_len)
+{
+    const cq_layer_header_t *h = job->h;
+    const uint32_t threads = cq_pool_threads(pool);
+    uint32_t k_len = h->weight_cols;
+    uint32_t unit = 1;              /* Fan-in per k step */
+
+    if (!engine->split_k_enabled || !job->fast || job->csr != NULL || threads < 2 ||
+        h->weight_layout != CQ_WEIGHT_LAYOUT_ROW_MAJOR ||
+        (h->weight_rows + grain - 1) / grain >= threads) {
+        return 0;
+    }
+
+    *per_row = 1;
+    if (h->layer_type == CQ_LAYER_CONV2D) {
+        /* Slices are input channels; a block of outputs must fit the partials */
+        *per_row = job->out_len / h->weight_rows;
+        k_len = job->sh->in_channels;
+        unit = job->sh->kernel_h * job->sh->kernel_w;
+        if (*per_row > CQ_ENGINE_ROW_GRAIN) {
+            return 0;
+        }
+    }
+
+    uint32_t len = (CQ_ENGINE_SPLITK_GRAIN + unit - 1) / unit;
+    if (k_len / CQ_ENGINE_SPLITK_SLICES >= len) {
+        len = (k_len + CQ_ENGINE_SPLITK_SLICES - 1) / CQ_ENGINE_SPLITK_SLICES;
+    }
+    const uint32_t slices = (k_len + len - 1) / len;
+
+    *slice_len = len;
+    return (slices >= 2) ? slices : 0;
+}
+
+/* Workers reduce fan-in slices of a block of outputs; the calling thread
+   sums the partials in slice order and finishes each output */
+static void run_split_k(cq_pool_t *pool, layer_job_t *job,
+                        uint32_t slices, uint32_t slice_len, uint32_t per_row)
+{
+    const cq_layer_header_t *h = job->h;
+    const uint32_t block = CQ_ENGINE_ROW_GRAIN / per_row;
+    cq_accum64_t acc[CQ_ENGINE_ROW_GRAIN];
+    cq_epilogue_t epi_buf;
+    const cq_epilogue_t *epi = chunk_epilogue(job, 0, &epi_buf);
+    splitk_job_t sk;
+
+    sk.job = job;
+    sk.slice_len = slice_len;
+    sk.k_len = (h->layer_type == CQ_LAYER_LINEAR) ? h->weight_cols : job->sh->in_channels;
+
+    for (uint32_t b = 0; b < job->batch; b++) {
+        cq_fixed16_t *y = job->y + (size_t)b * job->out_len;
+
+        sk.x = job->x + (size_t)b * job->in_len;
+        for (uint32_t r0 = 0; r0 < h->weight_rows; r0 += block) {
+            const uint32_t r1 = (h->weight_rows - r0 > block) ? r0 + block : h->weight_rows;
+            const uint32_t n = (r1 - r0) * per_row;
+
+            sk.out_begin = r0;
+            sk.out_end = r1;
+            cq_pool_run(pool, slices, 1, splitk_chunk, &sk);
+
+            for (uint32_t j = 0; j < n; j++) {
+                acc[j] = 0;
+                for (uint32_t s = 0; s < slices; s++) {
+                    acc[j] += sk.partial[s][j];
+                }
+            }
+            cq_layer_finish_rows(h, job->bias, acc, y, r0, r1, per_row, epi, &job->faults[0]);
+        }
+    }
+}
+
+static void run_weighted(const cq_engine_t *engine,
+                         cq_pool_t *pool,
+                         uint32_t i,
+                         const cq_fixed16_t *x,
+                         cq_fixed16_t *y,
+                         uint32_t batch,
+                         const cq_epilogue_t *epi)
+{
+    const cq_layer_header_t *h = &engine->headers[i];
+    cq_layer_state_t *st = &engine->state[i];
+    layer_job_t job;
+
+    memset(&job, 0, offsetof(layer_job_t, counts));
+    job.h = h;
+    job.sh = &engine->shapes[i];
+    job.W = (const void *)(engine->blob + h->weight_offset);
+    job.csr = st->csr;
+    job.bias = (h->bias_len != 0) ? (const void *)(engine->blob + h->bias_offset) : NULL;
+    job.x = x;
+    job.y = y;
+    job.batch = batch;
+    job.tile_rows = tile_rows_for(engine, h);
+    if (h->weight_layout == CQ_WEIGHT_LAYOUT_PANEL && job.tile_rows <= UINT32_MAX - CQ_PANEL_ROWS) {
+        /* Whole panels per tile */
+        job.tile_rows = (job.tile_rows + CQ_PANEL_ROWS - 1) / CQ_PANEL_ROWS * CQ_PANEL_ROWS;
+    }
+    job.in_len = st->in_len;
+    job.out_len = st->out_len;
+    job.epi = epi;
+    job.counting = (engine->fault_counts != NULL);
+    if (job.counting) {
+        for (uint32_t w = 0; w < cq_pool_threads(pool); w++) {
+            cq_fault_counts_clear(&job.counts[w]);
+        }
+    }
+
+    if (engine->fast_path_enabled || engine->wide_acc_enabled) {
+        /* One proof for the whole batch: safe for all ⇒ safe for each */
+        cq_overflow_proof_t proof;
+        memset(&proof, 0, sizeof(proof));
+        proof.max_weight_mag = st->weight_max_mag;
+        proof.max_input_mag = max_abs(x, (uint64_t)st->in_len * batch);
+        /* Sparse rows: fan-in is the longest row's non-zero count */
+        proof.dot_product_len = (st->csr != NULL) ? st->csr->max_row_nnz : h->weight_cols;
+
+        const bool safe = cq_overflow_is_safe(&proof);
+        job.fast = engine->fast_path_enabled && safe;
+        /* Exact instead of saturating; dense row-major weights only */
+        job.wide = engine->wide_acc_enabled && !safe && st->csr == NULL &&
+                   h->weight_layout == CQ_WEIGHT_LAYOUT_ROW_MAJOR &&
+                   cq_overflow_is_safe128(&proof);
+        job.chunk = cq_acc128_chunk_len(&proof);
+    }
+
+    /* Batched Linear: whole tiles per item so each tile stays with one core */
+    const size_t grain = (h->layer_type != CQ_LAYER_LINEAR) ? 1u :
+                         (batch > 1) ? job.tile_rows : CQ_ENGINE_ROW_GRAIN;
+    uint32_t per_row = 1;
+    uint32_t slice_len = 0;
+    const uint32_t slices = splitk_slices(engine, pool, &job, grain, &per_row, &slice_len);
+
+    if (slices != 0) {
+        run_split_k(pool, &job, slices, slice_len, per_row);
+    } else if (h->layer_type == CQ_LAYER_LINEAR) {
+        cq_pool_run(pool, h->weight_rows, grain, linear_chunk, &job);
+    } else {
+        cq_pool_run(pool, h->weight_rows, 1, conv_chunk, &job);
+    }
+
+    for (uint32_t w = 0; w < cq_pool_threads(pool); w++) {
+        cq_fault_merge(&st->faults, &job.faults[w]);
+        if (job.counting) {
+            cq_fault_counts_merge(&engine->fault_counts[i], &job.counts[w]);
+        }
+    }
+    st->fast_path = job.fast;
+    st->split_k = (slices != 0);
+    st->wide_acc = job.wide;
+}
+
+/* Layer i over batch samples stored back to back */
+static void run_layer(const cq_engine_t *engine,
+                      cq_pool_t *pool,
+                      uint32_t i,
+                      const cq_fixed16_t *x,
+                      cq_fixed16_t *y,
+                      uint32_t batch,
+                      const cq_epilogue_t *epi)
+{
+    const cq_layer_header_t *h = &engine->headers[i];
+    const cq_layer_shape_t *sh = &engine->shapes[i];
+    cq_layer_state_t *st = &engine->state[i];
+
+    st->fused = (epi != NULL);
+
+    if (is_weighted(h->layer_type)) {
+        run_weighted(engine, pool, i, x, y, batch, epi);
+        return;
+    }
+    st->fast_path = false;
+    st->split_k = false;
+    st->wide_acc = false;
+
+    cq_fault_counts_t *counts = (engine->fault_counts != NULL) ? &engine->fault_counts[i] : NULL;
+
+    for (uint32_t b = 0; b < batch; b++) {
+        const cq_fixed16_t *xb = x + (size_t)b * st->in_len;
+        cq_fixed16_t *yb = y + (size_t)b * st->out_len;
+
+        switch (h->layer_type) {
+        case CQ_LAYER_RELU:
+            cq_layer_relu(h, xb, yb, st->in_len, &st->faults, counts);
+            break;
+        case CQ_LAYER_SOFTMAX:
+            cq_layer_softmax(h, xb, yb, st->in_len, &st->faults, counts);
+            break;
+        default:
+            cq_layer_pool(h, sh, xb, yb, &st->faults, counts);
+            break;
+        }
+    }
+}
+
+/* Compulsory traffic of layer i over batch samples (see profile.h) */
+static uint64_t layer_bytes(const cq_engine_t *engine, uint32_t i, uint32_t out, uint32_t batch)
+{
+    const cq_layer_header_t *h = &engine->headers[i];
+    const cq_layer_state_t *st = &engine->state[i];
+    uint64_t bytes = ((uint64_t)st->in_len + engine->state[out].out_len) *
+                     sizeof(cq_fixed16_t) * batch;
+
+    if (!is_weighted(h->layer_type)) {
+        return bytes;
+    }
+    if (st->csr != NULL) {
+        bytes += (uint64_t)st->csr->nnz * (sizeof(uint32_t) + sizeof(cq_fixed16_t)) +
+                 ((uint64_t)st->csr->rows + 1) * sizeof(uint32_t);
+    } else {
+        bytes += cq_weight_layout_count(h->weight_layout, h->weight_rows, h->weight_cols) *
+                 weight_elem_size(h);
+    }
+    return bytes + (uint64_t)h->bias_len * ((h->bias_spec.format == CQ_FORMAT_Q32_32) ? 8u : 4u);
+}
+
+/* Largest activation passed between layers of [first, end) */
+static uint32_t range_span(const cq_engine_t *engine, uint32_t first, uint32_t end)
+{
+    uint32_t span = 0;
+    for (uint32_t i = first + 1; i < end; i++) {
+        span = (engine->state[i].in_len > span) ? engine->state[i].in_len : span;
+    }
+    return span;
+}
+
+/* Layers [first, end) over batch samples; per-layer faults accumulate.
+   The activation plan covers the whole model only. */
+static void execute(cq_engine_t *engine,
+                    cq_pool_t *pool,
+                    cq_profile_t *prof,
+                    uint32_t first,
+                    uint32_t end,
+                    const cq_fixed16_t *input,
+                    cq_fixed16_t *output,
+                    uint32_t batch,
+                    cq_fixed16_t *workspace)
+{
+    const bool planned = engine->slots != NULL && first == 0 && end == engine->layer_count;
+    cq_fixed16_t *ping = workspace;
+    cq_fixed16_t *pong = (ping != NULL) ?
+                         ping + (size_t)range_span(engine, first, end) * batch : NULL;
+    const cq_fixed16_t *x = input;
+
+    for (uint32_t i = first; i < end; i++) {
+        cq_epilogue_t epi;
+        const cq_epilogue_t *epi_ptr = NULL;
+        uint32_t out = i;               /* Layer whose output is produced */
+        cq_fixed16_t *y;
+
+        if (fuses_with_next(engine, i, end)) {
+            const cq_layer_header_t *relu = &engine->headers[i + 1];
+            memset(&epi, 0, sizeof(epi));
+            epi.relu = true;
+            epi.relu_shift = (int32_t)relu->input_spec.scale_exp
+                           - (int32_t)relu->output_spec.scale_exp;
+            epi_ptr = &epi;
+            out = i + 1;
+        }
+
+        if (out + 1 == end) {
+            y = output;
+        } else if (planned) {
+            /* Slot lifetimes are per layer, so scaling offsets by the
+               batch keeps the plan valid */
+            y = ping + (size_t)engine->slots[out].offset * batch;
+        } else {
+            y = (x == ping) ? pong : ping;
+        }
+
+        uint64_t t0 = 0;
+        uint64_t c0 = 0;
+        if (prof != NULL) {
+            t0 = cq_profile_now_ns();
+            c0 = cq_profile_cycles();
+        }
+
+        run_layer(engine, pool, i, x, y, batch, epi_ptr);
+
+        if (prof != NULL) {
+            cq_profile_record(prof, i, batch, out != i,
+                              engine->state[i].macs * batch,
+                              layer_bytes(engine, i, out, batch), t0, c0);
+        }
+
+        if (out != i) {
+            /* The ReLU ran inside the epilogue; its faults are layer i's */
+            engine->state[out].fast_path = false;
+            engine->state[out].split_k = false;
+            engine->state[out].wide_acc = false;
+            engine->state[out].fused = true;
+            i = out;
+        }
+        x = y;
+    }
+}
+
+static void clear_layer_faults(cq_engine_t *engine)
+{
+    for (uint32_t i = 0; i < engine->layer_count; i++) {
+        cq_fault_clear(&engine->state[i].faults);
+    }
+}
+
+static void merge_layer_faults(const cq_engine_t *engine, cq_fault_flags_t *faults)
+{
+    cq_fault_clear(faults);
+    for (uint32_t i = 0; i < engine->layer_count; i++) {
+        cq_fault_merge(faults, &engine->state[i].faults);
+    }
+}
+
+int cq_engine_run(cq_engine_t *engine,
+                  const cq_fixed16_t *input,
+                  cq_fixed16_t *output,
+                  void *workspace,
+                  cq_fault_flags_t *faults)
+{
+    if (engine == NULL || input == NULL || output == NULL || faults == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (workspace == NULL && engine->layer_count > 1) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    clear_layer_faults(engine);
+    execute(engine, engine->pool, engine->profile, 0, engine->layer_count, input, output, 1,
+            (cq_fixed16_t *)workspace);
+    merge_layer_faults(engine, faults);
+
+    return 0;
+}
+
+size_t cq_engine_layers_workspace_size(const cq_engine_t *engine, uint32_t first, uint32_t end)
+{
+    if (engine == NULL || end > engine->layer_count || first >= end) {
+        return 0;
+    }
+    return 2u * (size_t)range_span(engine, first, end) * sizeof(cq_fixed16_t);
+}
+
+int cq_engine_run_layers(cq_engine_t *engine,
+                         uint32_t first,
+                         uint32_t end,
+                         const cq_fixed16_t *input,
+                         cq_fixed16_t *output,
+                         void *workspace)
+{
+    if (engine == NULL || input == NULL || output == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (end > engine->layer_count || first >= end) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+    if (workspace == NULL && end - first > 1) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    execute(engine, NULL, NULL, first, end, input, output, 1, (cq_fixed16_t *)workspace);
+    return 0;
+}
+
+size_t cq_engine_batch_workspace_size(const cq_engine_t *engine)
+{
+    if (engine == NULL) {
+        return 0;
+    }
+    uint32_t batch = (engine->batch_size > 0) ? engine->batch_size : 1u;
+    return cq_engine_workspace_size(engine) * batch;
+}
+
+int cq_engine_run_batch(cq_engine_t *engine,
+                        const cq_fixed16_t *inputs,
+                        cq_fixed16_t *outputs,
+                        size_t count,
+                        void *workspace,
+                        cq_fault_flags_t *faults)
+{
+    if (engine == NULL || inputs == NULL || outputs == NULL || faults == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (workspace == NULL && engine->layer_count > 1) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    const uint32_t B = (engine->batch_size > 0) ? engine->batch_size : 1u;
+    const size_t in_len = engine->state[0].in_len;
+    const size_t out_len = engine->state[engine->layer_count - 1].out_len;
+
+    clear_layer_faults(engine);
+
+    for (size_t done = 0; done < count; ) {
+        uint32_t n = (count - done > B) ? B : (uint32_t)(count - done);
+
+        execute(engine, engine->pool, engine->profile, 0, engine->layer_count,
+                inputs + done * in_len, outputs + done * out_len, n,
+                (cq_fixed16_t *)workspace);
+        done += n;
+    }
+
+    merge_layer_faults(engine, faults);
+    return 0;
+}
@@ -0,0 +1,915 @@
+/**
+ * @file layers.c
+ * @project Certifiable-Quant
+ * @brief Reference layer kernels for the inference engine
+ *
+ * @traceability CQ-MATH-001 §3.2-§3.5, §4.1-§4.2
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include "engine.h"
+#include "dvm.h"
+
+/* Softmax constants (Q16.16, CQ-MATH-001 §4.2.2) */
+#define SOFTMAX_LOG2E   94548   /* log2(e) ≈ 1.442695 */
+#define SOFTMAX_C1      45426   /* ≈ 0.6931 */
+#define SOFTMAX_C2      15744   /* ≈ 0.2402 */
+
+/* ============================================================================
+ * Helpers
+ * ============================================================================ */
+
+static int64_t bias_at(const cq_layer_header_t *hdr, const void *bias, uint32_t i)
+{
+    if (bias == NULL) {
+        return 0;
+    }
+    if (hdr->bias_spec.format == CQ_FORMAT_Q32_32) {
+        return ((const int64_t *)bias)[i];
+    }
+    return (int64_t)((const int32_t *)bias)[i];
+}
+
+/* Accumulator scale minus output scale (CQ-MATH-001 §3.5) */
+static int32_t acc_shift(const cq_layer_header_t *hdr)
+{
+    return (int32_t)hdr->weight_spec.scale_exp
+         + (int32_t)hdr->input_spec.scale_exp
+         - (int32_t)hdr->output_spec.scale_exp;
+}
+
+static int32_t act_shift(const cq_layer_header_t *hdr)
+{
+    return (int32_t)hdr->input_spec.scale_exp - (int32_t)hdr->output_spec.scale_exp;
+}
+
+/* RNE right shift on 64 bits, no saturation (shift 1..62) */
+static int64_t rne_shift64(int64_t x, uint32_t shift)
+{
+    int64_t divisor = (int64_t)1 << shift;
+    int64_t half = divisor / 2;
+    int64_t quot = x / divisor;
+    int64_t rem = x % divisor;
+
+    if (rem > half || (rem == half && (quot & 1))) {
+        quot += 1;
+    } else if (rem < -half || (rem == -half && (quot & 1))) {
+        quot -= 1;
+    }
+    return quot;
+}
+
+/* RNE integer division, den > 0 */
+static int64_t div_rne(int64_t num, int64_t den)
+{
+    int64_t quot = num / den;
+    int64_t rem = num % den;
+    int64_t abs_rem2 = (rem >= 0) ? 2 * rem : -2 * rem;
+
+    if (abs_rem2 > den || (abs_rem2 == den && (quot & 1))) {
+        quot += (num >= 0) ? 1 : -1;
+    }
+    return quot;
+}
+
+/* div_rne() by a divisor precomputed with cq_divisor_init(), den > 0 */
+static int64_t div_rne_inv(int64_t num, const cq_divisor_t *den)
+{
+    const uint64_t mag = (num < 0) ? ~(uint64_t)num + 1u : (uint64_t)num;
+    uint64_t rem;
+    uint64_t quot = cq_divu64(mag, den, &rem);
+
+    /* 2·rem against den, without forming 2·rem */
+    if (rem > den->mag - rem || (rem == den->mag - rem && (quot & 1u))) {
+        quot += 1u;
+    }
+    if (num >= 0 || quot == 0u) {
+        return (int64_t)quot;
+    }
+    return -(int64_t)(quot - 1u) - 1;
+}
+
+/* Weight i of a row-major tensor, widened from its storage */
+static cq_fixed16_t weight_at(const cq_layer_header_t *hdr, const void *W, size_t i)
+{
+    if (hdr->weight_spec.storage == CQ_STORAGE_INT16) {
+        return (cq_fixed16_t)((const int16_t *)W)[i];
+    }
+    return ((const cq_fixed16_t *)W)[i];
+}
+
+/* Dot product of weight row r with x. Int16 weights are widened on load,
+   so both storages give the same products in the same order. */
+static cq_accum64_t dot_row(const cq_layer_header_t *hdr,
+                            const void *W,
+                            uint32_t r,
+                            const cq_fixed16_t *x,
+                            bool fast,
+                            cq_fault_flags_t *faults)
+{
+    const uint32_t cols = hdr->weight_cols;
+    cq_accum64_t acc = 0;
+
+    if (hdr->weight_spec.storage == CQ_STORAGE_INT16) {
+        const int16_t *w = (const int16_t *)W + (size_t)r * cols;
+
+        if (fast) {
+            for (uint32_t c = 0; c < cols; c++) {
+                acc += (int64_t)w[c] * (int64_t)x[c];
+            }
+        } else {
+            for (uint32_t c = 0; c < cols; c++) {
+                cq_mac_q16(&acc, w[c], x[c], faults);
+            }
+        }
+        return acc;
+    }
+
+    const cq_fixed16_t *w = (const cq_fixed16_t *)W + (size_t)r * cols;
+
+    if (fast) {
+        /* Overflow proof holds: no partial sum can saturate */
+        for (uint32_t c = 0; c < cols; c++) {
+            acc += (int64_t)w[c] * (int64_t)x[c];
+        }
+    } else {
+        for (uint32_t c = 0; c < cols; c++) {
+            cq_mac_q16(&acc, w[c], x[c], faults);
+        }
+    }
+    return acc;
+}
+
+/* Fault target of one output: a cleared local when counting, so that each
+   kind is counted once per output, else the sticky flags directly */
+static cq_fault_flags_t *output_faults(cq_fault_flags_t *local,
+                                       cq_fault_flags_t *faults,
+                                       const cq_fault_counts_t *counts)
+{
+    if (counts == NULL) {
+        return faults;
+    }
+    cq_fault_clear(local);
+    return local;
+}
+
+static void output_done(const cq_fault_flags_t *local,
+                        cq_fault_flags_t *faults,
+                        cq_fault_counts_t *counts)
+{
+    if (counts != NULL) {
+        cq_fault_count(counts, local);
+        cq_fault_merge(faults, local);
+    }
+}
+
+static cq_fault_counts_t *epi_counts(const cq_epilogue_t *epi)
+{
+    return (epi != NULL) ? epi->counts : NULL;
+}
+
+/* Fused ReLU and its rescale, applied to a requantized output */
+static cq_fixed16_t relu_tail(cq_fixed16_t v, const cq_epilogue_t *epi, cq_fault_flags_t *faults)
+{
+    if (epi != NULL && epi->relu) {
+        v = (v > 0) ? v : 0;
+        if (epi->relu_shift != 0) {
+            v = cq_requantize(v, epi->relu_shift, faults);
+        }
+    }
+    return v;
+}
+
+/* Bias, requantization and fused ReLU for one output (CQ-MATH-001 §3.5) */
+static cq_fixed16_t epilogue(cq_accum64_t acc,
+                             const cq_layer_header_t *hdr,
+                             const void *bias,
+                             uint32_t row,
+                             int32_t shift,
+                             const cq_epilogue_t *epi,
+                             cq_fault_flags_t *faults)
+{
+    if (bias != NULL) {
+        acc = cq_add64_sat(acc, bias_at(hdr, bias, row), faults);
+    }
+
+    return relu_tail(cq_requantize(acc, shift, faults), epi, faults);
+}
+
+/* epilogue() over an exact 128-bit accumulator; the bias add is exact too */
+static cq_fixed16_t epilogue128(cq_accum128_t *acc,
+                                const cq_layer_header_t *hdr,
+                                const void *bias,
+                                uint32_t row,
+                                int32_t shift,
+                                const cq_epilogue_t *epi,
+                                cq_fault_flags_t *faults)
+{
+    if (bias != NULL) {
+        cq_acc128_add64(acc, bias_at(hdr, bias, row));
+    }
+    return relu_tail(cq_requantize128(acc, shift, faults), epi, faults);
+}
+
+/* ============================================================================
+ * Linear
+ * ============================================================================ */
+
+void cq_layer_linear_rows(const cq_layer_header_t *hdr,
+                          const void *W,
+                          const void *bias,
+                          const cq_fixed16_t *x,
+                          cq_fixed16_t *y,
+                          uint32_t row_begin,
+                          uint32_t row_end,
+                          bool fast,
+                          const cq_epilogue_t *epi,
+                          cq_fault_flags_t *faults)
+{
+    const int32_t shift = acc_shift(hdr);
+    cq_fault_counts_t *counts = epi_counts(epi);
+
+    for (uint32_t r = row_begin; r < row_end; r++) {
+        cq_fault_flags_t local;
+        cq_fault_flags_t *f = output_faults(&local, faults, counts);
+        cq_accum64_t acc = dot_row(hdr, W, r, x, fast, f);
+
+        y[r] = epilogue(acc, hdr, bias, r, shift, epi, f);
+        output_done(&local, faults, counts);
+    }
+}
+
+void cq_layer_linear(const cq_layer_header_t *hdr,
+                     const void *W,
+                     const void *bias,
+                     const cq_fixed16_t *x,
+                     cq_fixed16_t *y,
+                     bool fast,
+                     const cq_epilogue_t *epi,
+                     cq_fault_flags_t *faults)
+{
+    cq_layer_linear_rows(hdr, W, bias, x, y, 0, hdr->weight_rows, fast, epi, faults);
+}
+
+void cq_layer_linear_csr_rows(const cq_layer_header_t *hdr,
+                              const cq_csr_q16_t *csr,
+                              const void *bias,
+                              const cq_fixed16_t *x,
+                              cq_fixed16_t *y,
+                              uint32_t row_begin,
+                              uint32_t row_end,
+                              bool fast,
+                              const cq_epilogue_t *epi,
+                              cq_fault_flags_t *faults)
+{
+    const int32_t shift = acc_shift(hdr);
+    cq_fault_counts_t *counts = epi_counts(epi);
+
+    for (uint32_t r = row_begin; r < row_end; r++) {
+        const uint32_t k0 = csr->row_ptr[r];
+        const uint32_t k1 = csr->row_ptr[r + 1];
+        cq_fault_flags_t local;
+        cq_fault_flags_t *f = output_faults(&local, faults, counts);
+        cq_accum64_t acc = 0;
+
+        if (fast) {
+            for (uint32_t k = k0; k < k1; k++) {
+                acc += (int64_t)csr->values[k] * (int64_t)x[csr->col_idx[k]];
+            }
+        } else {
+            /* Skipped zeros would add 0: no change, even once saturated */
+            for (uint32_t k = k0; k < k1; k++) {
+                cq_mac_q16(&acc, csr->values[k], x[csr->col_idx[k]], f);
+            }
+        }
+
+        y[r] = epilogue(acc, hdr, bias, r, shift, epi, f);
+        output_done(&local, faults, counts);
+    }
+}
+
+void cq_layer_linear_csr(const cq_layer_header_t *hdr,
+                         const cq_csr_q16_t *csr,
+                         const void *bias,
+                         const cq_fixed16_t *x,
+                         cq_fixed16_t *y,
+                         bool fast,
+                         const cq_epilogue_t *epi,
+                         cq_fault_flags_t *faults)
+{
+    cq_layer_linear_csr_rows(hdr, csr, bias, x, y, 0, csr->rows, fast, epi, faults);
+}
+
+void cq_layer_linear_panel_rows(const cq_layer_header_t *hdr,
+                                const cq_fixed16_t *Wp,
+                                const void *bias,
+                                const cq_fixed16_t *x,
+                                cq_fixed16_t *y,
+                                uint32_t row_begin,
+                                uint32_t row_end,
+                                bool fast,
+                                const cq_epilogue_t *epi,
+                                cq_fault_flags_t *faults)
+{
+    const uint32_t cols = hdr->weight_cols;
+    const int32_t shift = acc_shift(hdr);
+    cq_fault_counts_t *counts = epi_counts(epi);
+    uint32_t r = row_begin;
+
+    while (r < row_end) {
+        const uint32_t lane = r % CQ_PANEL_ROWS;
+        const cq_fixed16_t *panel = Wp + (size_t)(r / CQ_PANEL_ROWS) * cols * CQ_PANEL_ROWS;
+
+        if (lane == 0 && row_end - r >= CQ_PANEL_ROWS) {
+            /* Whole panel: P accumulators share each x[c] */
+            cq_accum64_t acc[CQ_PANEL_ROWS] = { 0 };
+            cq_fault_flags_t local[CQ_PANEL_ROWS];
+            cq_fault_flags_t *f[CQ_PANEL_ROWS];
+
+            for (uint32_t k = 0; k < CQ_PANEL_ROWS; k++) {
+                f[k] = output_faults(&local[k], faults, counts);
+            }
+
+            if (fast) {
+                for (uint32_t c = 0; c < cols; c++) {
+                    const int64_t xc = x[c];
+                    const cq_fixed16_t *w = panel + (size_t)c * CQ_PANEL_ROWS;
+                    for (uint32_t k = 0; k < CQ_PANEL_ROWS; k++) {
+                        acc[k] += (int64_t)w[k] * xc;
+                    }
+                }
+            } else {
+                for (uint32_t c = 0; c < cols; c++) {
+                    const cq_fixed16_t *w = panel + (size_t)c * CQ_PANEL_ROWS;
+                    for (uint32_t k = 0; k < CQ_PANEL_ROWS; k++) {
+                        cq_mac_q16(&acc[k], w[k], x[c], f[k]);
+                    }
+                }
+            }
+
+            for (uint32_t k = 0; k < CQ_PANEL_ROWS; k++) {
+                y[r + k] = epilogue(acc[k], hdr, bias, r + k, shift, epi, f[k]);
+                output_done(&local[k], faults, counts);
+            }
+            r += CQ_PANEL_ROWS;
+            continue;
+        }
+
+        /* Row of a panel cut by the range: stride P through the panel */
+        cq_fault_flags_t local;
+        cq_fault_flags_t *f = output_faults(&local, faults, counts);
+        cq_accum64_t acc = 0;
+        if (fast) {
+            for (uint32_t c = 0; c < cols; c++) {
+                acc += (int64_t)panel[(size_t)c * CQ_PANEL_ROWS + lane] * (int64_t)x[c];
+            }
+        } else {
+            for (uint32_t c = 0; c < cols; c++) {
+                cq_mac_q16(&acc, panel[(size_t)c * CQ_PANEL_ROWS + lane], x[c], f);
+            }
+        }
+        y[r] = epilogue(acc, hdr, bias, r, shift, epi, f);
+        output_done(&local, faults, counts);
+        r++;
+    }
+}
+
+void cq_layer_linear_panel(const cq_layer_header_t *hdr,
+                           const cq_fixed16_t *Wp,
+                           const void *bias,
+                           const cq_fixed16_t *x,
+                           cq_fixed16_t *y,
+                           bool fast,
+                           const cq_epilogue_t *epi,
+                           cq_fault_flags_t *faults)
+{
+    cq_layer_linear_panel_rows(hdr, Wp, bias, x, y, 0, hdr->weight_rows, fast, epi, faults);
+}
+
+void cq_layer_linear_batch_rows(const cq_layer_header_t *hdr,
+                                const void *W,
+                                const void *bias,
+                                const cq_fixed16_t *X,
+                                cq_fixed16_t *Y,
+                                uint32_t batch,
+                                uint32_t tile_rows,
+                                uint32_t row_begin,
+                                uint32_t row_end,
+                                bool fast,
+                                const cq_epilogue_t *epi,
+                                cq_fault_flags_t *faults)
+{
+    const uint32_t rows = hdr->weight_rows;
+    const uint32_t cols = hdr->weight_cols;
+    const int32_t shift = acc_shift(hdr);
+    cq_fault_counts_t *counts = epi_counts(epi);
+
+    for (uint32_t r0 = row_begin; r0 < row_end; r0 += tile_rows) {
+        const uint32_t r1 = (row_end - r0 > tile_rows) ? r0 + tile_rows : row_end;
+
+        for (uint32_t b = 0; b < batch; b++) {
+            const cq_fixed16_t *x = X + (size_t)b * cols;
+            cq_fixed16_t *y = Y + (size_t)b * rows;
+
+            for (uint32_t r = r0; r < r1; r++) {
+                cq_fault_flags_t local;
+                cq_fault_flags_t *f = output_faults(&local, faults, counts);
+                cq_accum64_t acc = dot_row(hdr, W, r, x, fast, f);
+
+                y[r] = epilogue(acc, hdr, bias, r, shift, epi, f);
+                output_done(&local, faults, counts);
+            }
+        }
+    }
+}
+
+void cq_layer_linear_batch(const cq_layer_header_t *hdr,
+                           const void *W,
+                           const void *bias,
+                           const cq_fixed16_t *X,
+                           cq_fixed16_t *Y,
+                           uint32_t batch,
+                           uint32_t tile_rows,
+                           bool fast,
+                           const cq_epilogue_t *epi,
+                           cq_fault_flags_t *faults)
+{
+    cq_layer_linear_batch_rows(hdr, W, bias, X, Y, batch, tile_rows,
+                               0, hdr->weight_rows, fast, epi, faults);
+}
+
+/* ============================================================================
+ * Conv2D
+ * ============================================================================ */
+
+void cq_layer_conv2d_channels(const cq_layer_header_t *hdr,
+                              const cq_layer_shape_t *shape,
+                              const void *W,
+                              const void *bias,
+                              const cq_fixed16_t *x,
+                              cq_fixed16_t *y,
+                              uint32_t oc_begin,
+                              uint32_t oc_end,
+                              bool fast,
+                              const cq_epilogue_t *epi,
+                              cq_fault_flags_t *faults)
+{
+    const uint32_t C = shape->in_channels;
+    const uint32_t H = shape->in_height;
+    const uint32_t Wd = shape->in_width;
+    const uint32_t kh = shape->kernel_h;
+    const uint32_t kw = shape->kernel_w;
+    const uint32_t s = shape->stride;
+    const uint32_t p = shape->padding;
+    const uint32_t OH = (H + 2 * p - kh) / s + 1;
+    const uint32_t OW = (Wd + 2 * p - kw) / s + 1;
+    const int32_t shift = acc_shift(hdr);
+    cq_fault_counts_t *counts = epi_counts(epi);
+
+    for (uint32_t oc = oc_begin; oc < oc_end; oc++) {
+        const size_t w_oc = (size_t)oc * hdr->weight_cols;
+
+        for (uint32_t oy = 0; oy < OH; oy++) {
+            for (uint32_t ox = 0; ox < OW; ox++) {
+                cq_fault_flags_t local;
+                cq_fault_flags_t *f = output_faults(&local, faults, counts);
+                cq_accum64_t acc = 0;
+
+                for (uint32_t ic = 0; ic < C; ic++) {
+                    for (uint32_t ky = 0; ky < kh; ky++) {
+                        /* Unsigned wrap marks rows in the zero padding */
+                        uint32_t iy = oy * s + ky - p;
+                        if (oy * s + ky < p || iy >= H) {
+                            continue;
+                        }
+                        const cq_fixed16_t *x_row = x + ((size_t)ic * H + iy) * Wd;
+                        const size_t w_row = w_oc + ((size_t)ic * kh + ky) * kw;
+
+                        for (uint32_t kx = 0; kx < kw; kx++) {
+                            uint32_t ix = ox * s + kx - p;
+                            if (ox * s + kx < p || ix >= Wd) {
+                                continue;
+                            }
+                            const cq_fixed16_t w = weight_at(hdr, W, w_row + kx);
+                            if (fast) {
+                                acc += (int64_t)w * (int64_t)x_row[ix];
+                            } else {
+                                cq_mac_q16(&acc, w, x_row[ix], f);
+                            }
+                        }
+                    }
+                }
+
+                y[((size_t)oc * OH + oy) * OW + ox] =
+                    epilogue(acc, hdr, bias, oc, shift, epi, f);
+                output_done(&local, faults, counts);
+            }
+        }
+    }
+}
+
+void cq_layer_conv2d(const cq_layer_header_t *hdr,
+                     const cq_layer_shape_t *shape,
+                     const void *W,
+                     const void *bias,
+                     const cq_fixed16_t *x,
+                     cq_fixed16_t *y,
+                     bool fast,
+                     const cq_epilogue_t *epi,
+                     cq_fault_flags_t *faults)
+{
+    cq_layer_conv2d_channels(hdr, shape, W, bias, x, y, 0, hdr->weight_rows,
+                             fast, epi, faults);
+}
+
+/* ============================================================================
+ * Exact 128-bit Accumulation
+ * ============================================================================ */
+
+void cq_layer_linear_rows_wide(const cq_layer_header_t *hdr,
+                               const void *W,
+                               const void *bias,
+                               const cq_fixed16_t *x,
+                               cq_fixed16_t *y,
+                               uint32_t row_begin,
+                               uint32_t row_end,
+                               uint32_t chunk,
+                               const cq_epilogue_t *epi,
+                               cq_fault_flags_t *faults)
+{
+    const uint32_t cols = hdr->weight_cols;
+    const int32_t shift = acc_shift(hdr);
+    cq_fault_counts_t *counts = epi_counts(epi);
+
+    for (uint32_t r = row_begin; r < row_end; r++) {
+        const size_t base = (size_t)r * cols;
+        cq_fault_flags_t local;
+        cq_fault_flags_t *f = output_faults(&local, faults, counts);
+        cq_accum128_t acc;
+
+        cq_acc128_set(&acc, 0);
+        for (uint32_t c0 = 0; c0 < cols; c0 += chunk) {
+            const uint32_t c1 = (cols - c0 > chunk) ? c0 + chunk : cols;
+            int64_t part = 0;
+
+            /* chunk products cannot overflow int64 (cq_acc128_chunk_len()) */
+            for (uint32_t c = c0; c < c1; c++) {
+                part += (int64_t)weight_at(hdr, W, base + c) * (int64_t)x[c];
+            }
+            cq_acc128_add64(&acc, part);
+        }
+
+        y[r] = epilogue128(&acc, hdr, bias, r, shift, epi, f);
+        output_done(&local, faults, counts);
+    }
+}
+
+void cq_layer_conv2d_channels_wide(const cq_layer_header_t *hdr,
+                                   const cq_layer_shape_t *shape,
+                                   const void *W,
+                                   const void *bias,
+                                   const cq_fixed16_t *x,
+                                   cq_fixed16_t *y,
+                                   uint32_t oc_begin,
+                                   uint32_t oc_end,
+                                   uint32_t chunk,
+                                   const cq_epilogue_t *epi,
+                                   cq_fault_flags_t *faults)
+{
+    const uint32_t C = shape->in_channels;
+    const uint32_t H = shape->in_height;
+    const uint32_t Wd = shape->in_width;
+    const uint32_t kh = shape->kernel_h;
+    const uint32_t kw = shape->kernel_w;
+    const uint32_t s = shape->stride;
+    const uint32_t p = shape->padding;
+    const uint32_t OH = (H + 2 * p - kh) / s + 1;
+    const uint32_t OW = (Wd + 2 * p - kw) / s + 1;
+    const int32_t shift = acc_shift(hdr);
+    cq_fault_counts_t *counts = epi_counts(epi);
+
+    for (uint32_t oc = oc_begin; oc < oc_end; oc++) {
+        const size_t w_oc = (size_t)oc * hdr->weight_cols;
+
+        for (uint32_t oy = 0; oy < OH; oy++) {
+            for (uint32_t ox = 0; ox < OW; ox++) {
+                cq_fault_flags_t local;
+                cq_fault_flags_t *f = output_faults(&local, faults, counts);
+                cq_accum128_t acc;
+                int64_t part = 0;
+                uint32_t n = 0;
+
+                cq_acc128_set(&acc, 0);
+                for (uint32_t ic = 0; ic < C; ic++) {
+                    for (uint32_t ky = 0; ky < kh; ky++) {
+                        uint32_t iy = oy * s + ky - p;
+                        if (oy * s + ky < p || iy >= H) {
+                            continue;
+                        }
+                        const cq_fixed16_t *x_row = x + ((size_t)ic * H + iy) * Wd;
+                        const size_t w_row = w_oc + ((size_t)ic * kh + ky) * kw;
+
+                        for (uint32_t kx = 0; kx < kw; kx++) {
+                            uint32_t ix = ox * s + kx - p;
+                            if (ox * s + kx < p || ix >= Wd) {
+                                continue;
+                            }
+                            part += (int64_t)weight_at(hdr, W, w_row + kx) * (int64_t)x_row[ix];
+                            if (++n == chunk) {
+                                cq_acc128_add64(&acc, part);
+                                part = 0;
+                                n = 0;
+                            }
+                        }
+                    }
+                }
+                cq_acc128_add64(&acc, part);
+
+                y[((size_t)oc * OH + oy) * OW + ox] =
+                    epilogue128(&acc, hdr, bias, oc, shift, epi, f);
+                output_done(&local, faults, counts);
+            }
+        }
+    }
+}
+
+/* ============================================================================
+ * Split-K
+ * ============================================================================ */
+
+void cq_layer_linear_partial(const cq_layer_header_t *hdr,
+                             const void *W,
+                             const cq_fixed16_t *x,
+                             uint32_t row_begin,
+                             uint32_t row_end,
+                             uint32_t col_begin,
+                             uint32_t col_end,
+                             cq_accum64_t *acc)
+{
+    const uint32_t cols = hdr->weight_cols;
+
+    for (uint32_t r = row_begin; r < row_end; r++) {
+        const size_t base = (size_t)r * cols;
+        cq_accum64_t sum = 0;
+
+        /* Overflow proof holds: the partial is bounded like the full sum */
+        if (hdr->weight_spec.storage == CQ_STORAGE_INT16) {
+            const int16_t *w = (const int16_t *)W + base;
+            for (uint32_t c = col_begin; c < col_end; c++) {
+                sum += (int64_t)w[c] * (int64_t)x[c];
+            }
+        } else {
+            const cq_fixed16_t *w = (const cq_fixed16_t *)W + base;
+            for (uint32_t c = col_begin; c < col_end; c++) {
+                sum += (int64_t)w[c] * (int64_t)x[c];
+            }
+        }
+        acc[r - row_begin] = sum;
+    }
+}
+
+void cq_layer_conv2d_partial(const cq_layer_header_t *hdr,
+                             const cq_layer_shape_t *shape,
+                             const void *W,
+                             const cq_fixed16_t *x,
+                             uint32_t oc_begin,
+                             uint32_t oc_end,
+                             uint32_t ic_begin,
+                             uint32_t ic_end,
+                             cq_accum64_t *acc)
+{
+    const uint32_t H = shape->in_height;
+    const uint32_t Wd = shape->in_width;
+    const uint32_t kh = shape->kernel_h;
+    const uint32_t kw = shape->kernel_w;
+    const uint32_t s = shape->stride;
+    const uint32_t p = shape->padding;
+    const uint32_t OH = (H + 2 * p - kh) / s + 1;
+    const uint32_t OW = (Wd + 2 * p - kw) / s + 1;
+
+    for (uint32_t oc = oc_begin; oc < oc_end; oc++) {
+        const size_t w_oc = (size_t)oc * hdr->weight_cols;
+
+        for (uint32_t oy = 0; oy < OH; oy++) {
+            for (uint32_t ox = 0; ox < OW; ox++) {
+                cq_accum64_t sum = 0;
+
+                for (uint32_t ic = ic_begin; ic < ic_end; ic++) {
+                    for (uint32_t ky = 0; ky < kh; ky++) {
+                        uint32_t iy = oy * s + ky - p;
+                        if (oy * s + ky < p || iy >= H) {
+                            continue;
+                        }
+                        const cq_fixed16_t *x_row = x + ((size_t)ic * H + iy) * Wd;
+                        const size_t w_row = w_oc + ((size_t)ic * kh + ky) * kw;
+
+                        for (uint32_t kx = 0; kx < kw; kx++) {
+                            uint32_t ix = ox * s + kx - p;
+                            if (ox * s + kx < p || ix >= Wd) {
+                                continue;
+                            }
+                            sum += (int64_t)weight_at(hdr, W, w_row + kx) * (int64_t)x_row[ix];
+                        }
+                    }
+                }
+                acc[((size_t)(oc - oc_begin) * OH + oy) * OW + ox] = sum;
+            }
+        }
+    }
+}
+
+void cq_layer_finish_rows(const cq_layer_header_t *hdr,
+                          const void *bias,
+                          const cq_accum64_t *acc,
+                          cq_fixed16_t *y,
+                          uint32_t row_begin,
+                          uint32_t row_end,
+                          uint32_t per_row,
+                          const cq_epilogue_t *epi,
+                          cq_fault_flags_t *faults)
+{
+    const int32_t shift = acc_shift(hdr);
+    cq_fault_counts_t *counts = epi_counts(epi);
+
+    for (uint32_t r = row_begin; r < row_end; r++) {
+        for (uint32_t j = 0; j < per_row; j++) {
+            const size_t k = (size_t)(r - row_begin) * per_row + j;
+            cq_fault_flags_t local;
+            cq_fault_flags_t *f = output_faults(&local, faults, counts);
+
+            y[(size_t)r * per_row + j] = epilogue(acc[k], hdr, bias, r, shift, epi, f);
+            output_done(&local, faults, counts);
+        }
+    }
+}
+
+/* ============================================================================
+ * ReLU (CQ-MATH-001 §4.1)
+ * ============================================================================ */
+
+void cq_layer_relu(const cq_layer_header_t *hdr,
+                   const cq_fixed16_t *x,
+                   cq_fixed16_t *y,
+                   size_t n,
+                   cq_fault_flags_t *faults,
+                   cq_fault_counts_t *counts)
+{
+    const int32_t shift = act_shift(hdr);
+
+    for (size_t i = 0; i < n; i++) {
+        cq_fault_flags_t local;
+        cq_fault_flags_t *f = output_faults(&local, faults, counts);
+        cq_fixed16_t v = (x[i] > 0) ? x[i] : 0;
+
+        y[i] = (shift == 0) ? v : cq_requantize(v, shift, f);
+        output_done(&local, faults, counts);
+    }
+}
+
+/* ============================================================================
+ * Pooling
+ * ============================================================================ */
+
+void cq_layer_pool(const cq_layer_header_t *hdr,
+                   const cq_layer_shape_t *shape,
+                   const cq_fixed16_t *x,
+                   cq_fixed16_t *y,
+                   cq_fault_flags_t *faults,
+                   cq_fault_counts_t *counts)
+{
+    const uint32_t C = shape->in_channels;
+    const uint32_t H = shape->in_height;
+    const uint32_t Wd = shape->in_width;
+    const uint32_t kh = shape->kernel_h;
+    const uint32_t kw = shape->kernel_w;
+    const uint32_t s = shape->stride;
+    const uint32_t OH = (H - kh) / s + 1;
+    const uint32_t OW = (Wd - kw) / s + 1;
+    const int64_t count = (int64_t)kh * kw;
+    const bool is_max = (hdr->layer_type == CQ_LAYER_MAXPOOL);
+    const int32_t shift = act_shift(hdr);
+    cq_divisor_t window;
+
+    /* One reciprocal per layer instead of a divide per output */
+    cq_divisor_init(&window, count);
+
+    for (uint32_t c = 0; c < C; c++) {
+        const cq_fixed16_t *x_c = x + (size_t)c * H * Wd;
+
+        for (uint32_t oy = 0; oy < OH; oy++) {
+            for (uint32_t ox = 0; ox < OW; ox++) {
+                int64_t acc = is_max ? INT64_MIN : 0;
+
+                for (uint32_t ky = 0; ky < kh; ky++) {
+                    const cq_fixed16_t *row = x_c + (size_t)(oy * s + ky) * Wd + ox * s;
+                    for (uint32_t kx = 0; kx < kw; kx++) {
+                        if (is_max) {
+                            acc = (row[kx] > acc) ? row[kx] : acc;
+                        } else {
+                            acc += row[kx];
+                        }
+                    }
+                }
+
+                if (!is_max) {
+                    acc = div_rne_inv(acc, &window);
+                }
+
+                cq_fault_flags_t local;
+                cq_fault_flags_t *f = output_faults(&local, faults, counts);
+                y[((size_t)c * OH + oy) * OW + ox] = cq_requantize(acc, shift, f);
+                output_done(&local, faults, counts);
+            }
+        }
+    }
+}
+
+/* ============================================================================
+ * Softmax (CQ-MATH-001 §4.2)
+ * ============================================================================ */
+
+/* 2^(d·log2 e) for d ≤ 0 in Q16.16 (§4.2.2) */
+static int64_t exp_q16(int64_t d)
+{
+    int64_t t = rne_shift64(d * SOFTMAX_LOG2E, 16);     /* t ≤ 0 */
+    int64_t k = t / 65536;
+    int64_t f;
+
+    /* k = ⌊t⌋, f = t − k ∈ [0, 1) */
+    if (k * 65536 > t) {
+        k -= 1;
+    }
+    f = t - k * 65536;
+
+    int64_t f2 = rne_shift64(f * f, 16);
+    int64_t poly = 65536 + rne_shift64(SOFTMAX_C1 * f, 16)
+                         + rne_shift64(SOFTMAX_C2 * f2, 16);
+
+    /* 2^k: exact shift (k ≤ 0); beyond 40 bits the result is 0 */
+    if (k == 0) {
+        return poly;
+    }
+    if (-k > 40) {
+        return 0;
+    }
+    return rne_shift64(poly, (uint32_t)(-k));
+}
+
+void cq_layer_softmax(const cq_layer_header_t *hdr,
+                      const cq_fixed16_t *x,
+                      cq_fixed16_t *y,
+                      size_t n,
+                      cq_fault_flags_t *faults,
+                      cq_fault_counts_t *counts)
+{
+    const int32_t in_exp = hdr->input_spec.scale_exp;
+    const int32_t out_shift = CQ_Q16_SHIFT - (int32_t)hdr->output_spec.scale_exp;
+    const int64_t floor_q16 = -((int64_t)1 << 31);
+
+    if (n == 0) {
+        return;
+    }
+
+    /* §4.2.1 Stability transform */
+    cq_fixed16_t m = x[0];
+    for (size_t i = 1; i < n; i++) {
+        m = (x[i] > m) ? x[i] : m;
+    }
+
+    /* Exponentials into y (as Q16.16, < 2^17) and their sum */
+    int64_t sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        int64_t d = (int64_t)x[i] - m;  /* ≤ 0, at input scale */
+
+        /* To Q16.16; anything below −2^15 underflows exp to 0 anyway */
+        if (in_exp > CQ_Q16_SHIFT) {
+            d = (d == 0) ? 0 : -rne_shift64(-d, (uint32_t)(in_exp - CQ_Q16_SHIFT));
+        } else if (in_exp < CQ_Q16_SHIFT) {
+            int32_t up = CQ_Q16_SHIFT - in_exp;
+            d = (up >= 32 || d < (floor_q16 / ((int64_t)1 << up)))
+              ? floor_q16 : d * ((int64_t)1 << up);
+        }
+        if (d < floor_q16) {
+            d = floor_q16;
+        }
+
+        int64_t e = exp_q16(d);
+        y[i] = (cq_fixed16_t)e;
+        sum += e;
+    }
+
+    /* §4.2.3 Reciprocal in Q0.32, then one multiply per element; sum ≥ 1.0 */
+    int64_t recip = div_rne((int64_t)1 << 48, sum);
+
+    for (size_t i = 0; i < n; i++) {
+        cq_fault_flags_t local;
+        cq_fault_flags_t *f = output_faults(&local, faults, counts);
+        int64_t p = rne_shift64((int64_t)y[i] * recip, 32);
+
+        y[i] = cq_requantize(p, out_shift, f);
+        output_done(&local, faults, counts);
+    }
+}
@@ -0,0 +1,540 @@
+/**
+ * @file pipeline.c
+ * @project Certifiable-Quant
+ * @brief Layer-pipelined streaming inference
+ *
+ * @details Each stage thread loops: take a filled buffer from its input
+ *          link, take an empty buffer from its output link, run its layers,
+ *          then return the input buffer and publish the output buffer. A
+ *          link never holds more than depth buffers, so neither push can
+ *          fail. Waiting threads spin with sched_yield() on the queues,
+ *          which keeps per-sample handoff free of locks and syscalls.
+ *
+ * @traceability CQ-MATH-001 §6, CQ-STRUCT-001 §5.3
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "pipeline.h"
+#include <sched.h>
+#include <string.h>
+#include <unistd.h>
+
+#if CQ_SPSC_LOCK_FREE
+#define LOAD_RELAXED(p)         __atomic_load_n((p), __ATOMIC_RELAXED)
+#define LOAD_ACQUIRE(p)         __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define STORE_RELEASE(p, v)     __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#endif
+
+/* ============================================================================
+ * SPSC Queue
+ * ============================================================================ */
+
+int cq_spsc_init(cq_spsc_queue_t *q, uint32_t capacity)
+{
+    if (q == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (capacity == 0 || capacity > CQ_SPSC_MAX_DEPTH || (capacity & (capacity - 1)) != 0) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+
+    memset(q, 0, sizeof(*q));
+    q->capacity = capacity;
+    q->mask = capacity - 1;
+
+#if !CQ_SPSC_LOCK_FREE
+    if (pthread_mutex_init(&q->lock, NULL) != 0) {
+        return CQ_ERROR_IO;
+    }
+#endif
+    return 0;
+}
+
+void cq_spsc_destroy(cq_spsc_queue_t *q)
+{
+#if !CQ_SPSC_LOCK_FREE
+    if (q != NULL) {
+        pthread_mutex_destroy(&q->lock);
+    }
+#else
+    (void)q;
+#endif
+}
+
+bool cq_spsc_push(cq_spsc_queue_t *q, uint32_t item)
+{
+#if CQ_SPSC_LOCK_FREE
+    uint32_t tail = LOAD_RELAXED(&q->tail);
+    uint32_t head = LOAD_ACQUIRE(&q->head);
+
+    if (tail - head == q->capacity) {
+        return false;
+    }
+    q->items[tail & q->mask] = item;
+    STORE_RELEASE(&q->tail, tail + 1);
+    return true;
+#else
+    bool ok = false;
+
+    pthread_mutex_lock(&q->lock);
+    if (q->tail - q->head != q->capacity) {
+        q->items[q->tail & q->mask] = item;
+        q->tail++;
+        ok = true;
+    }
+    pthread_mutex_unlock(&q->lock);
+    return ok;
+#endif
+}
+
+bool cq_spsc_pop(cq_spsc_queue_t *q, uint32_t *item)
+{
+#if CQ_SPSC_LOCK_FREE
+    uint32_t head = LOAD_RELAXED(&q->head);
+    uint32_t tail = LOAD_ACQUIRE(&q->tail);
+
+    if (tail == head) {
+        return false;
+    }
+    *item = q->items[head & q->mask];
+    STORE_RELEASE(&q->head, head + 1);
+    return true;
+#else
+    bool ok = false;
+
+    pthread_mutex_lock(&q->lock);
+    if (q->tail != q->head) {
+        *item = q->items[q->head & q->mask];
+        q->head++;
+        ok = true;
+    }
+    pthread_mutex_unlock(&q->lock);
+    return ok;
+#endif
+}
+
+/* ============================================================================
+ * Stage Planning
+ * ============================================================================ */
+
+static bool is_weighted(uint32_t type)
+{
+    return type == CQ_LAYER_LINEAR || type == CQ_LAYER_CONV2D;
+}
+
+/* End of the smallest unsplittable layer group starting at i */
+static uint32_t unit_end(const cq_engine_t *engine, uint32_t i)
+{
+    if (engine->fusion_enabled &&
+        i + 1 < engine->layer_count &&
+        is_weighted(engine->headers[i].layer_type) &&
+        engine->headers[i + 1].layer_type == CQ_LAYER_RELU) {
+        return i + 2;
+    }
+    return i + 1;
+}
+
+static uint64_t range_cost(const cq_engine_t *engine, uint32_t first, uint32_t end)
+{
+    uint64_t cost = 0;
+    for (uint32_t i = first; i < end; i++) {
+        cost += engine->state[i].macs + engine->state[i].out_len;
+    }
+    return cost;
+}
+
+/*
+ * Fill stages greedily up to cap; returns the stage count. With stages
+ * non-NULL the stage ranges are recorded as well.
+ */
+static uint32_t fill_stages(const cq_engine_t *engine, uint64_t cap, cq_pipeline_stage_t *stages)
+{
+    uint32_t count = 0;
+    uint32_t i = 0;
+
+    while (i < engine->layer_count) {
+        uint32_t first = i;
+        uint64_t acc = 0;
+
+        while (i < engine->layer_count) {
+            uint32_t e = unit_end(engine, i);
+            uint64_t c = range_cost(engine, i, e);
+
+            if (acc > 0 && acc + c > cap) {
+                break;
+            }
+            acc += c;
+            i = e;
+        }
+
+        if (stages != NULL) {
+            cq_pipeline_stage_t *s = &stages[count];
+            s->first_layer = first;
+            s->end_layer = i;
+            s->cost = acc;
+            s->in_len = engine->state[first].in_len;
+            s->out_len = engine->state[i - 1].out_len;
+        }
+        count++;
+    }
+    return count;
+}
+
+int cq_pipeline_plan(const cq_engine_t *engine,
+                     uint32_t max_stages,
+                     cq_pipeline_stage_t *stages,
+                     uint32_t *stage_count)
+{
+    if (engine == NULL || stages == NULL || stage_count == NULL || engine->state == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (max_stages == 0 || max_stages > CQ_PIPELINE_MAX_STAGES) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+
+    /* Bottleneck bounds: the costliest unit, and everything in one stage */
+    uint64_t lo = 0;
+    for (uint32_t i = 0; i < engine->layer_count; i = unit_end(engine, i)) {
+        uint64_t c = range_cost(engine, i, unit_end(engine, i));
+        lo = (c > lo) ? c : lo;
+    }
+    uint64_t hi = range_cost(engine, 0, engine->layer_count);
+
+    /* Smallest cap that needs no more than max_stages stages */
+    while (lo < hi) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (fill_stages(engine, mid, NULL) <= max_stages) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+
+    memset(stages, 0, (size_t)max_stages * sizeof(*stages));
+    *stage_count = fill_stages(engine, lo, stages);
+    return 0;
+}
+
+/* ============================================================================
+ * Stage Threads
+ * ============================================================================ */
+
+static uint32_t stop_requested(cq_pipeline_t *pipe)
+{
+#if CQ_SPSC_LOCK_FREE
+    return LOAD_ACQUIRE(&pipe->stop);
+#else
+    uint32_t stop;
+    pthread_mutex_lock(&pipe->lock);
+    stop = pipe->stop;
+    pthread_mutex_unlock(&pipe->lock);
+    return stop;
+#endif
+}
+
+static bool wait_pop(cq_pipeline_t *pipe, cq_spsc_queue_t *q, uint32_t *item)
+{
+    while (!cq_spsc_pop(q, item)) {
+        if (stop_requested(pipe) != 0) {
+            return false;
+        }
+        sched_yield();
+    }
+    return true;
+}
+
+static void *stage_main(void *arg)
+{
+    const cq_pipeline_worker_t *wa = (const cq_pipeline_worker_t *)arg;
+    cq_pipeline_t *pipe = (cq_pipeline_t *)wa->pipeline;
+    const cq_pipeline_stage_t *stage = &pipe->stages[wa->stage];
+    cq_pipeline_link_t *in = &pipe->links[wa->stage];
+    cq_pipeline_link_t *out = &pipe->links[wa->stage + 1];
+    cq_fixed16_t *scratch = pipe->scratch[wa->stage];
+
+    for (;;) {
+        uint32_t src, dst;
+
+        if (!wait_pop(pipe, &in->full, &src) || !wait_pop(pipe, &out->free, &dst)) {
+            break;
+        }
+
+        (void)cq_engine_run_layers(pipe->engine, stage->first_layer, stage->end_layer,
+                                   in->buffers + (size_t)src * in->len,
+                                   out->buffers + (size_t)dst * out->len,
+                                   scratch);
+
+        /* Each link circulates exactly depth buffers: neither push can fail */
+        (void)cq_spsc_push(&in->free, src);
+        (void)cq_spsc_push(&out->full, dst);
+    }
+    return NULL;
+}
+
+/* ============================================================================
+ * Pipeline
+ * ============================================================================ */
+
+int cq_pipeline_init(cq_pipeline_t *pipe,
+                     cq_engine_t *engine,
+                     uint32_t max_stages,
+                     uint32_t depth)
+{
+    if (pipe == NULL || engine == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (depth == 0) {
+        depth = CQ_PIPELINE_DEFAULT_DEPTH;
+    }
+    if (depth > CQ_SPSC_MAX_DEPTH || (depth & (depth - 1)) != 0) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+    if (max_stages == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        max_stages = (online > 0) ? (uint32_t)online : 1u;
+    }
+    if (max_stages > CQ_PIPELINE_MAX_STAGES) {
+        max_stages = CQ_PIPELINE_MAX_STAGES;
+    }
+
+    memset(pipe, 0, sizeof(*pipe));
+    pipe->engine = engine;
+    pipe->depth = depth;
+
+    int ret = cq_pipeline_plan(engine, max_stages, pipe->stages, &pipe->stage_count);
+    if (ret != 0) {
+        return ret;
+    }
+
+    for (uint32_t s = 0; s < pipe->stage_count; s++) {
+        pipe->links[s].len = pipe->stages[s].in_len;
+    }
+    pipe->links[pipe->stage_count].len = pipe->stages[pipe->stage_count - 1].out_len;
+    return 0;
+}
+
+size_t cq_pipeline_workspace_size(const cq_pipeline_t *pipe)
+{
+    if (pipe == NULL || pipe->engine == NULL) {
+        return 0;
+    }
+
+    size_t bytes = 0;
+    for (uint32_t l = 0; l <= pipe->stage_count; l++) {
+        bytes += (size_t)pipe->depth * pipe->links[l].len * sizeof(cq_fixed16_t);
+    }
+    for (uint32_t s = 0; s < pipe->stage_count; s++) {
+        bytes += cq_engine_layers_workspace_size(pipe->engine, pipe->stages[s].first_layer,
+                                                 pipe->stages[s].end_layer);
+    }
+    return bytes;
+}
+
+static void destroy_links(cq_pipeline_t *pipe, uint32_t count)
+{
+    for (uint32_t l = 0; l < count; l++) {
+        cq_spsc_destroy(&pipe->links[l].full);
+        cq_spsc_destroy(&pipe->links[l].free);
+    }
+}
+
+static int init_links(cq_pipeline_t *pipe)
+{
+    for (uint32_t l = 0; l <= pipe->stage_count; l++) {
+        cq_pipeline_link_t *link = &pipe->links[l];
+
+        if (cq_spsc_init(&link->full, pipe->depth) != 0) {
+            destroy_links(pipe, l);
+            return CQ_ERROR_IO;
+        }
+        if (cq_spsc_init(&link->free, pipe->depth) != 0) {
+            cq_spsc_destroy(&link->full);
+            destroy_links(pipe, l);
+            return CQ_ERROR_IO;
+        }
+        for (uint32_t b = 0; b < pipe->depth; b++) {
+            (void)cq_spsc_push(&link->free, b);
+        }
+    }
+    return 0;
+}
+
+static void clear_layer_faults(cq_engine_t *engine)
+{
+    for (uint32_t i = 0; i < engine->layer_count; i++) {
+        cq_fault_clear(&engine->state[i].faults);
+    }
+}
+
+int cq_pipeline_start(cq_pipeline_t *pipe, void *workspace)
+{
+    if (pipe == NULL || pipe->engine == NULL || workspace == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (pipe->ready) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+
+    /* Carve the workspace: link buffers, then per-stage scratch */
+    cq_fixed16_t *p = (cq_fixed16_t *)workspace;
+    for (uint32_t l = 0; l <= pipe->stage_count; l++) {
+        pipe->links[l].buffers = p;
+        p += (size_t)pipe->depth * pipe->links[l].len;
+    }
+    for (uint32_t s = 0; s < pipe->stage_count; s++) {
+        pipe->scratch[s] = p;
+        p += cq_engine_layers_workspace_size(pipe->engine, pipe->stages[s].first_layer,
+                                             pipe->stages[s].end_layer) / sizeof(cq_fixed16_t);
+    }
+
+#if !CQ_SPSC_LOCK_FREE
+    if (pthread_mutex_init(&pipe->lock, NULL) != 0) {
+        return CQ_ERROR_IO;
+    }
+#endif
+    if (init_links(pipe) != 0) {
+#if !CQ_SPSC_LOCK_FREE
+        pthread_mutex_destroy(&pipe->lock);
+#endif
+        return CQ_ERROR_IO;
+    }
+
+    pipe->stop = 0;
+    pipe->started = 0;
+    pipe->pushed = 0;
+    pipe->popped = 0;
+    pipe->ready = true;
+    clear_layer_faults(pipe->engine);
+
+    for (uint32_t s = 0; s < pipe->stage_count; s++) {
+        pipe->worker_args[s].pipeline = pipe;
+        pipe->worker_args[s].stage = s;
+
+        if (pthread_create(&pipe->threads[s], NULL, stage_main, &pipe->worker_args[s]) != 0) {
+            cq_pipeline_stop(pipe);
+            return CQ_ERROR_IO;
+        }
+        pipe->started++;
+    }
+    return 0;
+}
+
+bool cq_pipeline_try_push(cq_pipeline_t *pipe, const cq_fixed16_t *input)
+{
+    if (pipe == NULL || input == NULL || !pipe->ready) {
+        return false;
+    }
+
+    cq_pipeline_link_t *link = &pipe->links[0];
+    uint32_t b;
+
+    if (!cq_spsc_pop(&link->free, &b)) {
+        return false;
+    }
+    memcpy(link->buffers + (size_t)b * link->len, input, (size_t)link->len * sizeof(cq_fixed16_t));
+    (void)cq_spsc_push(&link->full, b);
+    pipe->pushed++;
+    return true;
+}
+
+bool cq_pipeline_try_pop(cq_pipeline_t *pipe, cq_fixed16_t *output)
+{
+    if (pipe == NULL || output == NULL || !pipe->ready) {
+        return false;
+    }
+
+    cq_pipeline_link_t *link = &pipe->links[pipe->stage_count];
+    uint32_t b;
+
+    if (!cq_spsc_pop(&link->full, &b)) {
+        return false;
+    }
+    memcpy(output, link->buffers + (size_t)b * link->len, (size_t)link->len * sizeof(cq_fixed16_t));
+    (void)cq_spsc_push(&link->free, b);
+    pipe->popped++;
+    return true;
+}
+
+void cq_pipeline_faults(const cq_pipeline_t *pipe, cq_fault_flags_t *faults)
+{
+    if (pipe == NULL || faults == NULL || pipe->engine == NULL) {
+        return;
+    }
+
+    cq_fault_clear(faults);
+    for (uint32_t i = 0; i < pipe->engine->layer_count; i++) {
+        cq_fault_merge(faults, &pipe->engine->state[i].faults);
+    }
+}
+
+int cq_pipeline_run(cq_pipeline_t *pipe,
+                    const cq_fixed16_t *inputs,
+                    cq_fixed16_t *outputs,
+                    size_t count,
+                    cq_fault_flags_t *faults)
+{
+    if (pipe == NULL || inputs == NULL || outputs == NULL || faults == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (!pipe->ready || pipe->started != pipe->stage_count || pipe->pushed != pipe->popped) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+
+    const size_t in_len = pipe->links[0].len;
+    const size_t out_len = pipe->links[pipe->stage_count].len;
+    size_t in = 0;
+    size_t out = 0;
+
+    /* Stage threads are idle with nothing in flight */
+    clear_layer_faults(pipe->engine);
+
+    while (out < count) {
+        bool progress = false;
+
+        while (in < count && cq_pipeline_try_push(pipe, inputs + in * in_len)) {
+            in++;
+            progress = true;
+        }
+        while (out < in && cq_pipeline_try_pop(pipe, outputs + out * out_len)) {
+            out++;
+            progress = true;
+        }
+        if (!progress) {
+            sched_yield();
+        }
+    }
+
+    cq_pipeline_faults(pipe, faults);
+    return 0;
+}
+
+void cq_pipeline_stop(cq_pipeline_t *pipe)
+{
+    if (pipe == NULL || !pipe->ready) {
+        return;
+    }
+
+#if CQ_SPSC_LOCK_FREE
+    STORE_RELEASE(&pipe->stop, 1u);
+#else
+    pthread_mutex_lock(&pipe->lock);
+    pipe->stop = 1;
+    pthread_mutex_unlock(&pipe->lock);
+#endif
+
+    for (uint32_t s = 0; s < pipe->started; s++) {
+        pthread_join(pipe->threads[s], NULL);
+    }
+
+    destroy_links(pipe, pipe->stage_count + 1);
+#if !CQ_SPSC_LOCK_FREE
+    pthread_mutex_destroy(&pipe->lock);
+#endif
+    pipe->started = 0;
+    pipe->ready = false;
+}
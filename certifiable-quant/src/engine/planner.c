@@ -0,0 +1,182 @@
+/**
+ * @file planner.c
+ * @project Certifiable-Quant
+ * @brief Liveness-based static activation arena planner
+ *
+ * @details Activations are intervals [first_use, last_use] over the layer
+ *          sequence. Two slots may share arena bytes iff their intervals are
+ *          disjoint. Placement is greedy by size (largest first, lowest
+ *          non-conflicting offset), which is deterministic and bounded by
+ *          O(n^3) in the layer count, with no allocation.
+ *
+ * @traceability CQ-STRUCT-001 §5.3
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include "engine.h"
+#include <string.h>
+
+/* Placement marker for slots not yet assigned an offset */
+#define SLOT_UNPLACED   UINT32_MAX
+
+/* ============================================================================
+ * Helpers
+ * ============================================================================ */
+
+/* Element-wise layers whose kernels read x[i] before writing y[i] */
+static bool runs_in_place(uint32_t type)
+{
+    return type == CQ_LAYER_RELU || type == CQ_LAYER_SOFTMAX;
+}
+
+static bool lifetimes_overlap(const cq_activation_slot_t *a, const cq_activation_slot_t *b)
+{
+    return a->first_use <= b->last_use && b->first_use <= a->last_use;
+}
+
+/* Placed root slot that is live at the same time as slots[s] */
+static bool conflicts(const cq_activation_slot_t *slots, uint32_t o, uint32_t s)
+{
+    return o != s && slots[o].offset != SLOT_UNPLACED && !slots[o].in_place &&
+           lifetimes_overlap(&slots[o], &slots[s]);
+}
+
+static bool fits_at(const cq_activation_slot_t *slots, uint32_t count, uint32_t s, uint64_t off)
+{
+    for (uint32_t o = 0; o < count; o++) {
+        if (conflicts(slots, o, s) &&
+            off < (uint64_t)slots[o].offset + slots[o].length &&
+            slots[o].offset < off + slots[s].length) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Lowest offset for slots[s]: 0 or the end of a conflicting slot */
+static uint64_t lowest_offset(const cq_activation_slot_t *slots, uint32_t count, uint32_t s)
+{
+    uint64_t best = UINT64_MAX;
+
+    if (fits_at(slots, count, s, 0)) {
+        return 0;
+    }
+    for (uint32_t c = 0; c < count; c++) {
+        if (!conflicts(slots, c, s)) {
+            continue;
+        }
+        uint64_t cand = (uint64_t)slots[c].offset + slots[c].length;
+        if (cand < best && fits_at(slots, count, s, cand)) {
+            best = cand;
+        }
+    }
+    return best;
+}
+
+/* ============================================================================
+ * Planning
+ * ============================================================================ */
+
+int cq_engine_plan(cq_engine_t *engine,
+                   cq_activation_slot_t *slots,
+                   cq_activation_plan_t *report)
+{
+    if (engine == NULL || slots == NULL || engine->state == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    const uint32_t n = engine->layer_count;
+    const uint32_t last = n - 1;
+    uint64_t naive = 0;
+    uint32_t in_place = 0;
+
+    memset(slots, 0, (size_t)n * sizeof(*slots));
+
+    /* Lifetimes; slot i is the output of layer i, consumed by layer i + 1 */
+    for (uint32_t i = 0; i < n; i++) {
+        cq_activation_slot_t *s = &slots[i];
+
+        s->first_use = i;
+        s->last_use = i;
+        s->alias_of = i;
+        s->offset = SLOT_UNPLACED;
+
+        if (i == last) {
+            continue;               /* Caller's output buffer */
+        }
+
+        s->length = engine->state[i].out_len;
+        s->last_use = i + 1;
+        naive += s->length;
+
+        if (i > 0 && runs_in_place(engine->headers[i].layer_type)) {
+            /* Share the input's storage and extend its lifetime */
+            uint32_t root = slots[i - 1].alias_of;
+            s->alias_of = root;
+            s->in_place = true;
+            slots[root].last_use = i + 1;
+            in_place++;
+        }
+    }
+
+    /* Greedy by size over root slots: largest first, lowest index on ties */
+    uint64_t arena = 0;
+    for (;;) {
+        uint32_t pick = SLOT_UNPLACED;
+
+        for (uint32_t i = 0; i < last; i++) {
+            if (slots[i].in_place || slots[i].offset != SLOT_UNPLACED) {
+                continue;
+            }
+            if (pick == SLOT_UNPLACED || slots[i].length > slots[pick].length) {
+                pick = i;
+            }
+        }
+        if (pick == SLOT_UNPLACED) {
+            break;
+        }
+
+        uint64_t off = lowest_offset(slots, last, pick);
+        uint64_t end = off + slots[pick].length;
+        if (end > UINT32_MAX) {
+            return CQ_ERROR_DIMENSION_MISMATCH;
+        }
+        slots[pick].offset = (uint32_t)off;
+        arena = (end > arena) ? end : arena;
+    }
+
+    for (uint32_t i = 0; i < last; i++) {
+        if (slots[i].in_place) {
+            slots[i].offset = slots[slots[i].alias_of].offset;
+        }
+    }
+    slots[last].offset = 0;
+
+    /* Liveness lower bound: root slots live while each layer runs */
+    uint32_t live_peak = 0;
+    for (uint32_t l = 0; l < n; l++) {
+        uint64_t live = 0;
+        for (uint32_t i = 0; i < last; i++) {
+            if (!slots[i].in_place && slots[i].first_use <= l && l <= slots[i].last_use) {
+                live += slots[i].length;
+            }
+        }
+        live_peak = (live > live_peak) ? (uint32_t)live : live_peak;
+    }
+
+    engine->slots = slots;
+    engine->arena_len = (uint32_t)arena;
+
+    if (report != NULL) {
+        memset(report, 0, sizeof(*report));
+        report->arena_len = (uint32_t)arena;
+        report->live_peak = live_peak;
+        report->naive_len = naive;
+        report->in_place_count = in_place;
+    }
+
+    return 0;
+}
@@ -0,0 +1,182 @@
+/**
+ * @file profile.c
+ * @project Certifiable-Quant
+ * @brief Per-layer execution profiler and Chrome trace export
+ *
+ * @traceability CQ-MATH-001 §6
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "profile.h"
+#include <string.h>
+#include <time.h>
+
+/* ============================================================================
+ * Clocks
+ * ============================================================================ */
+
+uint64_t cq_profile_now_ns(void)
+{
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0) {
+        return 0;
+    }
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t cq_profile_cycles(void)
+{
+#if CQ_PROFILE_HAS_CYCLES && (defined(__x86_64__) || defined(__i386__))
+    uint32_t lo, hi;
+    __asm__ __volatile__("rdtsc" : "=a"(lo), "=d"(hi));
+    return ((uint64_t)hi << 32) | lo;
+#elif CQ_PROFILE_HAS_CYCLES && defined(__aarch64__)
+    uint64_t v;
+    __asm__ __volatile__("isb; mrs %0, cntvct_el0" : "=r"(v) : : "memory");
+    return v;
+#else
+    return 0;
+#endif
+}
+
+double cq_profile_gops(uint64_t macs, uint64_t wall_ns)
+{
+    /* 2 operations per MAC; ops per ns = 10^9 ops per s */
+    return (wall_ns == 0) ? 0.0 : 2.0 * (double)macs / (double)wall_ns;
+}
+
+/* ============================================================================
+ * Recording
+ * ============================================================================ */
+
+int cq_profile_init(cq_profile_t *prof,
+                    cq_layer_profile_t *layers,
+                    uint32_t layer_count,
+                    cq_profile_event_t *events,
+                    uint32_t event_capacity)
+{
+    if (prof == NULL || layers == NULL || (events == NULL && event_capacity != 0)) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (layer_count == 0) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+
+    memset(prof, 0, sizeof(*prof));
+    prof->layers = layers;
+    prof->layer_count = layer_count;
+    prof->events = events;
+    prof->event_capacity = event_capacity;
+    cq_profile_reset(prof);
+    return 0;
+}
+
+void cq_profile_reset(cq_profile_t *prof)
+{
+    if (prof == NULL) {
+        return;
+    }
+    memset(prof->layers, 0, (size_t)prof->layer_count * sizeof(cq_layer_profile_t));
+    prof->event_count = 0;
+    prof->events_dropped = 0;
+    prof->epoch_ns = cq_profile_now_ns();
+}
+
+void cq_profile_record(cq_profile_t *prof,
+                       uint32_t layer,
+                       uint32_t samples,
+                       bool fused,
+                       uint64_t macs,
+                       uint64_t bytes,
+                       uint64_t start_ns,
+                       uint64_t start_cycles)
+{
+    /* Read the clocks first so bookkeeping is not timed */
+    const uint64_t end_cycles = cq_profile_cycles();
+    const uint64_t end_ns = cq_profile_now_ns();
+
+    if (prof == NULL || layer >= prof->layer_count) {
+        return;
+    }
+
+    const uint64_t wall = (end_ns > start_ns) ? end_ns - start_ns : 0;
+    const uint64_t cycles = (end_cycles > start_cycles) ? end_cycles - start_cycles : 0;
+    cq_layer_profile_t *lp = &prof->layers[layer];
+
+    lp->runs += 1;
+    lp->samples += samples;
+    lp->wall_ns += wall;
+    lp->cycles += cycles;
+    lp->macs += macs;
+    lp->bytes += bytes;
+
+    if (prof->event_count >= prof->event_capacity) {
+        prof->events_dropped += 1;
+        return;
+    }
+
+    cq_profile_event_t *ev = &prof->events[prof->event_count++];
+    memset(ev, 0, sizeof(*ev));
+    ev->start_ns = (start_ns > prof->epoch_ns) ? start_ns - prof->epoch_ns : 0;
+    ev->wall_ns = wall;
+    ev->cycles = cycles;
+    ev->macs = macs;
+    ev->bytes = bytes;
+    ev->layer = layer;
+    ev->samples = samples;
+    ev->fused = fused;
+}
+
+/* ============================================================================
+ * Chrome Trace
+ * ============================================================================ */
+
+static const char *layer_name(uint32_t type)
+{
+    switch (type) {
+    case CQ_LAYER_LINEAR:   return "Linear";
+    case CQ_LAYER_CONV2D:   return "Conv2D";
+    case CQ_LAYER_RELU:     return "ReLU";
+    case CQ_LAYER_SOFTMAX:  return "Softmax";
+    case CQ_LAYER_MAXPOOL:  return "MaxPool";
+    case CQ_LAYER_AVGPOOL:  return "AvgPool";
+    default:                return "Unknown";
+    }
+}
+
+int cq_profile_write_trace(const cq_profile_t *prof,
+                           const cq_layer_header_t *headers,
+                           FILE *out)
+{
+    if (prof == NULL || headers == NULL || out == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+    /* Timestamps are microseconds; ns precision is kept as 3 decimals */
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", out);
+    for (uint32_t e = 0; e < prof->event_count; e++) {
+        const cq_profile_event_t *ev = &prof->events[e];
+
+        fprintf(out,
+                "{\"name\":\"L%u %s%s\",\"cat\":\"layer\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+                "\"ts\":%llu.%03u,\"dur\":%llu.%03u,\"args\":{\"layer\":%u,\"samples\":%u,"
+                "\"macs\":%llu,\"bytes\":%llu,\"cycles\":%llu,\"gops\":%.6f}}%s\n",
+                (unsigned)ev->layer, layer_name(headers[ev->layer].layer_type),
+                ev->fused ? "+ReLU" : "",
+                (unsigned long long)(ev->start_ns / 1000u), (unsigned)(ev->start_ns % 1000u),
+                (unsigned long long)(ev->wall_ns / 1000u), (unsigned)(ev->wall_ns % 1000u),
+                (unsigned)ev->layer, (unsigned)ev->samples,
+                (unsigned long long)ev->macs, (unsigned long long)ev->bytes,
+                (unsigned long long)ev->cycles, cq_profile_gops(ev->macs, ev->wall_ns),
+                (e + 1 < prof->event_count) ? "," : "");
+    }
+    fputs("]}\n", out);
+
+    return ferror(out) ? CQ_ERROR_IO : 0;
+}
@@ -0,0 +1,232 @@
+/**
+ * @file dequant.c
+ * @project Certifiable-Quant
+ * @brief Array dequantization and classifier post-processing
+ *
+ * Q16.16 → FP conversion is one int→float conversion and an exact scale
+ * by 2^-16, so the SSE2 lanes produce the same bits as the scalar
+ * cq_q16_to_float(). Argmax and top-k compare the integers, which keeps
+ * the selection exact and independent of the float rounding.
+ *
+ * @traceability SRS-004-VERIFY, CQ-MATH-001 §7
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304, DO-178C
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ * @license GPL-3.0 or Commercial (contact: william@fstopify.com)
+ */
+
+#include "verify.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+
+/* 2^-16, exact in both formats */
+#define Q16_INV_F32     (1.0f / 65536.0f)
+#define Q16_INV_F64     (1.0 / 65536.0)
+
+/* ============================================================================
+ * Contiguous
+ * ============================================================================ */
+
+/* Row kernel shared with argmax/top-k; no argument checks */
+static void dequant_f32(const cq_fixed16_t *q, float *y, size_t n)
+{
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    const __m128 s = _mm_set1_ps(Q16_INV_F32);
+    for (; i + 8u <= n; i += 8u) {
+        const __m128i a = _mm_loadu_si128((const __m128i *)(q + i));
+        const __m128i b = _mm_loadu_si128((const __m128i *)(q + i + 4u));
+        _mm_storeu_ps(y + i, _mm_mul_ps(_mm_cvtepi32_ps(a), s));
+        _mm_storeu_ps(y + i + 4u, _mm_mul_ps(_mm_cvtepi32_ps(b), s));
+    }
+#endif
+    for (; i < n; i++) {
+        y[i] = cq_q16_to_float(q[i]);
+    }
+}
+
+int cq_dequantize_f32(const cq_fixed16_t *q, float *y, size_t n)
+{
+    if (q == NULL || y == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    dequant_f32(q, y, n);
+    return 0;
+}
+
+int cq_dequantize_f64(const cq_fixed16_t *q, double *y, size_t n)
+{
+    size_t i = 0;
+
+    if (q == NULL || y == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+
+#if defined(__SSE2__)
+    const __m128d s = _mm_set1_pd(Q16_INV_F64);
+    for (; i + 4u <= n; i += 4u) {
+        const __m128i a = _mm_loadu_si128((const __m128i *)(q + i));
+        _mm_storeu_pd(y + i, _mm_mul_pd(_mm_cvtepi32_pd(a), s));
+        _mm_storeu_pd(y + i + 2u, _mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(a, 8)), s));
+    }
+#endif
+    for (; i < n; i++) {
+        y[i] = (double)q[i] * Q16_INV_F64;
+    }
+    return 0;
+}
+
+/* ============================================================================
+ * Strided
+ * ============================================================================ */
+
+int cq_dequantize_f32_strided(const cq_fixed16_t *q, size_t q_stride,
+                              float *y, size_t y_stride, size_t n)
+{
+    if (q == NULL || y == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (q_stride == 1u && y_stride == 1u) {
+        dequant_f32(q, y, n);
+        return 0;
+    }
+
+    /* Gathers defeat the vector unit; four independent chains instead */
+    size_t i = 0;
+    for (; i + 4u <= n; i += 4u) {
+        const cq_fixed16_t a = q[i * q_stride];
+        const cq_fixed16_t b = q[(i + 1u) * q_stride];
+        const cq_fixed16_t c = q[(i + 2u) * q_stride];
+        const cq_fixed16_t d = q[(i + 3u) * q_stride];
+        y[i * y_stride] = cq_q16_to_float(a);
+        y[(i + 1u) * y_stride] = cq_q16_to_float(b);
+        y[(i + 2u) * y_stride] = cq_q16_to_float(c);
+        y[(i + 3u) * y_stride] = cq_q16_to_float(d);
+    }
+    for (; i < n; i++) {
+        y[i * y_stride] = cq_q16_to_float(q[i * q_stride]);
+    }
+    return 0;
+}
+
+int cq_dequantize_f64_strided(const cq_fixed16_t *q, size_t q_stride,
+                              double *y, size_t y_stride, size_t n)
+{
+    if (q == NULL || y == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (q_stride == 1u && y_stride == 1u) {
+        return cq_dequantize_f64(q, y, n);
+    }
+    for (size_t i = 0; i < n; i++) {
+        y[i * y_stride] = (double)q[i * q_stride] * Q16_INV_F64;
+    }
+    return 0;
+}
+
+/* ============================================================================
+ * Classifier Outputs
+ * ============================================================================ */
+
+/* First index of the row maximum (n ≥ 1) */
+static uint32_t row_argmax(const cq_fixed16_t *q, size_t n)
+{
+    cq_fixed16_t best = q[0];
+    size_t i = 1;
+
+#if defined(__SSE4_1__)
+    /* Maximum first, vectorized; then its first position */
+    if (n >= 8u) {
+        __m128i m = _mm_loadu_si128((const __m128i *)q);
+        for (i = 4u; i + 4u <= n; i += 4u) {
+            m = _mm_max_epi32(m, _mm_loadu_si128((const __m128i *)(q + i)));
+        }
+        m = _mm_max_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+        m = _mm_max_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+        best = _mm_cvtsi128_si32(m);
+        for (; i < n; i++) {
+            best = (q[i] > best) ? q[i] : best;
+        }
+        for (i = 0; q[i] != best; i++) {
+        }
+        return (uint32_t)i;
+    }
+#endif
+    uint32_t arg = 0;
+    for (; i < n; i++) {
+        if (q[i] > best) {
+            best = q[i];
+            arg = (uint32_t)i;
+        }
+    }
+    return arg;
+}
+
+int cq_dequantize_argmax(const cq_fixed16_t *q, float *y, size_t rows, size_t cols,
+                         uint32_t *argmax)
+{
+    if (q == NULL || argmax == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (cols == 0u) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+
+    /* Row by row, so the second read of each row hits cache */
+    for (size_t r = 0; r < rows; r++) {
+        const cq_fixed16_t *row = q + r * cols;
+        argmax[r] = row_argmax(row, cols);
+        if (y != NULL) {
+            dequant_f32(row, y + r * cols, cols);
+        }
+    }
+    return 0;
+}
+
+int cq_dequantize_topk(const cq_fixed16_t *q, float *y, size_t rows, size_t cols,
+                       uint32_t k, uint32_t *idx, float *val)
+{
+    if (q == NULL || idx == NULL) {
+        return CQ_ERROR_NULL_POINTER;
+    }
+    if (k == 0u || k > cols) {
+        return CQ_ERROR_DIMENSION_MISMATCH;
+    }
+
+    for (size_t r = 0; r < rows; r++) {
+        const cq_fixed16_t *row = q + r * cols;
+        uint32_t *top = idx + r * k;
+        uint32_t filled = 0;
+
+        /* Sorted insertion; strictly greater, so earlier indices win ties */
+        for (size_t c = 0; c < cols; c++) {
+            const cq_fixed16_t v = row[c];
+            if (filled == k && v <= row[top[k - 1u]]) {
+                continue;
+            }
+            uint32_t pos = (filled < k) ? filled++ : k - 1u;
+            while (pos > 0u && v > row[top[pos - 1u]]) {
+                top[pos] = top[pos - 1u];
+                pos--;
+            }
+            top[pos] = (uint32_t)c;
+        }
+
+        if (val != NULL) {
+            for (uint32_t j = 0; j < k; j++) {
+                val[r * k + j] = cq_q16_to_float(row[top[j]]);
+            }
+        }
+        if (y != NULL) {
+            dequant_f32(row, y + r * cols, cols);
+        }
+    }
+    return 0;
+}
@@ -57,6 +57,38 @@ double cq_linf_norm_q16(const float *fp, const cq_fixed16_t *q16, size_t n)
     return max_diff;
 }
 
+typedef struct {
+    const float *const *fp;
+    const cq_fixed16_t *const *q16;
+    const size_t *lens;
+    double *norms;
+} linf_job_t;
+
+static void linf_chunk(void *ctx, size_t begin, size_t end, uint32_t worker)
+{
+    const linf_job_t *job = (const linf_job_t *)ctx;
+    (void)worker;
+
+    for (size_t t = begin; t < end; t++) {
+        job->norms[t] = cq_linf_norm_q16(job->fp[t], job->q16[t], job->lens[t]);
+    }
+}
+
+void cq_linf_norm_q16_parallel(cq_pool_t *pool,
+                               const float *const *fp,
+                               const cq_fixed16_t *const *q16,
+                               const size_t *lens,
+                               uint32_t count,
+                               double *norms)
+{
+    if (fp == NULL || q16 == NULL || lens == NULL || norms == NULL) {
+        return;
+    }
+
+    linf_job_t job = { fp, q16, lens, norms };
+    cq_pool_run(pool, count, 1, linf_chunk, &job);
+}
+
 /* ============================================================================
  * FR-VER-03, FR-VER-04: Bound Checking
  * ============================================================================ */
@@ -0,0 +1,310 @@
+/**
+ * @file cq_verify.c
+ * @project Certifiable-Quant
+ * @brief cq-verify: parallel bulk certificate audit
+ *
+ * Usage:
+ *   cq-verify [-j threads] [-m model_dir] [-k public_key_hex] -s store
+ *   cq-verify [-j threads] [-m model_dir] [-k public_key_hex] path...
+ *
+ * Each path is a certificate file or a directory whose *.cqcr files are
+ * audited. With -m, the model for each certificate is re-hashed from
+ * <model_dir>/<target_model_hash hex>. With -k, signatures are verified.
+ * A JSON summary is written to stdout. The store is opened read-only: a
+ * torn trailing record is left on disk and reported as torn_tail_bytes.
+ *
+ * Exit status: 0 all certificates pass, 1 some fail, 2 usage or I/O error.
+ *
+ * @traceability SRS-005-CERTIFICATE, CQ-STRUCT-001 §7.2
+ * @compliance MISRA-C:2012
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "cert_audit.h"
+#include "cert_store.h"
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define CERT_FILE_EXT ".cqcr"
+
+typedef struct {
+    char **items;
+    size_t count;
+    size_t cap;
+} path_list_t;
+
+/* ============================================================================
+ * Input Collection
+ * ============================================================================ */
+
+static int path_push(path_list_t *list, const char *path)
+{
+    if (list->count == list->cap) {
+        size_t cap = list->cap ? list->cap * 2 : 256;
+        char **items = (char **)realloc(list->items, cap * sizeof(char *));
+        if (items == NULL) {
+            return -1;
+        }
+        list->items = items;
+        list->cap = cap;
+    }
+
+    size_t len = strlen(path);
+    char *copy = (char *)malloc(len + 1);
+    if (copy == NULL) {
+        return -1;
+    }
+    memcpy(copy, path, len + 1);
+    list->items[list->count++] = copy;
+    return 0;
+}
+
+static bool has_cert_ext(const char *name)
+{
+    size_t len = strlen(name);
+    size_t ext = sizeof(CERT_FILE_EXT) - 1;
+    return len > ext && strcmp(name + len - ext, CERT_FILE_EXT) == 0;
+}
+
+static int collect_dir(path_list_t *list, const char *dir)
+{
+    DIR *d = opendir(dir);
+    if (d == NULL) {
+        return -1;
+    }
+
+    struct dirent *e;
+    char path[CQ_AUDIT_PATH_MAX];
+    int ret = 0;
+
+    while ((e = readdir(d)) != NULL) {
+        if (!has_cert_ext(e->d_name)) {
+            continue;
+        }
+        int n = snprintf(path, sizeof(path), "%s/%s", dir, e->d_name);
+        if (n < 0 || (size_t)n >= sizeof(path) || path_push(list, path) != 0) {
+            ret = -1;
+            break;
+        }
+    }
+
+    closedir(d);
+    return ret;
+}
+
+static int compare_paths(const void *a, const void *b)
+{
+    return strcmp(*(const char *const *)a, *(const char *const *)b);
+}
+
+static int parse_key(const char *hex, uint8_t key[32])
+{
+    if (strlen(hex) != 64) {
+        return -1;
+    }
+    for (int i = 0; i < 32; i++) {
+        unsigned v;
+        if (sscanf(hex + 2 * i, "%2x", &v) != 1) {
+            return -1;
+        }
+        key[i] = (uint8_t)v;
+    }
+    return 0;
+}
+
+/* ============================================================================
+ * JSON Summary
+ * ============================================================================ */
+
+static void json_string(const char *s)
+{
+    putchar('"');
+    for (; *s != '\0'; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            printf("\\%c", c);
+        } else if (c < 0x20) {
+            printf("\\u%04x", c);
+        } else {
+            putchar(c);
+        }
+    }
+    putchar('"');
+}
+
+static void json_reasons(uint32_t status)
+{
+    bool first = true;
+    printf("\"reasons\": [");
+    for (uint32_t bit = 1; bit != 0 && bit <= status; bit <<= 1) {
+        if (status & bit) {
+            printf("%s\"%s\"", first ? "" : ", ", cq_cert_audit_reason(bit));
+            first = false;
+        }
+    }
+    printf("]");
+}
+
+static void print_summary(const char *source,
+                          const path_list_t *files,
+                          uint32_t torn_tail_bytes,
+                          size_t count,
+                          size_t passed,
+                          const cq_cert_audit_opts_t *opts,
+                          unsigned threads,
+                          const uint32_t *status,
+                          double elapsed_ms)
+{
+    bool first = true;
+
+    printf("{\n");
+    printf("  \"source\": \"%s\",\n", source);
+    printf("  \"total\": %zu,\n", count);
+    printf("  \"passed\": %zu,\n", passed);
+    printf("  \"failed\": %zu,\n", count - passed);
+    if (files == NULL) {
+        printf("  \"torn_tail_bytes\": %u,\n", (unsigned)torn_tail_bytes);
+    }
+    printf("  \"threads\": %u,\n", threads);
+    printf("  \"checks\": {\"signature\": %s, \"model_hash\": %s},\n",
+           opts->public_key ? "true" : "false",
+           opts->model_dir ? "true" : "false");
+    printf("  \"elapsed_ms\": %.3f,\n", elapsed_ms);
+    printf("  \"failures\": [");
+
+    for (size_t i = 0; i < count; i++) {
+        if (status[i] == 0) {
+            continue;
+        }
+        printf("%s\n    {", first ? "" : ",");
+        if (files != NULL) {
+            printf("\"certificate\": ");
+            json_string(files->items[i]);
+        } else {
+            printf("\"record\": %zu", i);
+        }
+        printf(", ");
+        json_reasons(status[i]);
+        printf("}");
+        first = false;
+    }
+
+    printf("%s]\n}\n", first ? "" : "\n  ");
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "usage: cq-verify [-j threads] [-m model_dir] [-k public_key_hex] -s store\n"
+        "       cq-verify [-j threads] [-m model_dir] [-k public_key_hex] path...\n");
+}
+
+int main(int argc, char **argv)
+{
+    cq_cert_audit_opts_t opts = { 0, NULL, NULL };
+    const char *store_path = NULL;
+    uint8_t key[32];
+    int opt;
+
+    while ((opt = getopt(argc, argv, "j:m:k:s:h")) != -1) {
+        switch (opt) {
+        case 'j':
+            opts.threads = (unsigned)strtoul(optarg, NULL, 10);
+            break;
+        case 'm':
+            opts.model_dir = optarg;
+            break;
+        case 'k':
+            if (parse_key(optarg, key) != 0) {
+                fprintf(stderr, "cq-verify: public key must be 64 hex digits\n");
+                return 2;
+            }
+            opts.public_key = key;
+            break;
+        case 's':
+            store_path = optarg;
+            break;
+        default:
+            usage();
+            return 2;
+        }
+    }
+
+    if ((store_path == NULL) == (optind >= argc)) {
+        usage();
+        return 2;
+    }
+
+    struct timespec t0, t1;
+    cq_cert_store_t store;
+    path_list_t files = { NULL, 0, 0 };
+    size_t count;
+
+    if (store_path != NULL) {
+        if (cq_cert_store_open_readonly(&store, store_path) != 0) {
+            fprintf(stderr, "cq-verify: cannot open store %s\n", store_path);
+            return 2;
+        }
+        count = store.record_count;
+    } else {
+        for (int i = optind; i < argc; i++) {
+            struct stat st;
+            int ret = (stat(argv[i], &st) == 0 && S_ISDIR(st.st_mode))
+                    ? collect_dir(&files, argv[i])
+                    : path_push(&files, argv[i]);
+            if (ret != 0) {
+                fprintf(stderr, "cq-verify: cannot read %s\n", argv[i]);
+                return 2;
+            }
+        }
+        if (files.count > 1) {
+            qsort(files.items, files.count, sizeof(char *), compare_paths);
+        }
+        count = files.count;
+    }
+
+    uint32_t *status = (uint32_t *)calloc(count ? count : 1, sizeof(uint32_t));
+    if (status == NULL) {
+        fprintf(stderr, "cq-verify: out of memory\n");
+        return 2;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    size_t passed = (store_path != NULL)
+        ? cq_cert_audit_records(store.records, count, &opts, status)
+        : cq_cert_audit_files((const char *const *)files.items, count, &opts, status);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    double elapsed_ms = (double)(t1.tv_sec - t0.tv_sec) * 1e3
+                      + (double)(t1.tv_nsec - t0.tv_nsec) / 1e6;
+
+    print_summary(store_path ? "store" : "files",
+                  store_path ? NULL : &files,
+                  store_path ? store.torn_tail_bytes : 0u,
+                  count, passed, &opts, cq_cert_audit_threads(&opts, count),
+                  status, elapsed_ms);
+
+    if (store_path != NULL) {
+        cq_cert_store_close(&store);
+    }
+    for (size_t i = 0; i < files.count; i++) {
+        free(files.items[i]);
+    }
+    free(files.items);
+    free(status);
+
+    return (passed == count) ? 0 : 1;
+}